@@ -0,0 +1,112 @@
+/*
+ *  benchmarks/Benchmark.cc
+ *  avida-core
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "Benchmark.h"
+
+#include "apto/platform.h"
+
+#include "cWorld.h"
+
+#include <algorithm>
+#include <ctime>
+
+#if APTO_PLATFORM(UNIX)
+#include <sys/time.h>
+#endif
+
+
+Avida::Benchmark::Run::Run(cWorld* world, double min_time, int repetitions)
+  : m_world(world), m_min_time(min_time), m_repetitions(repetitions), m_calibrating(true), m_skipped(false)
+  , m_batch(1), m_remaining(0), m_start(-1.0)
+{
+}
+
+cAvidaContext& Avida::Benchmark::Run::GetContext()
+{
+  return m_world->GetDefaultContext();
+}
+
+
+bool Avida::Benchmark::Run::nextBatch()
+{
+  if (m_skipped) return false;
+
+  const double now = Now();
+  if (m_start >= 0.0) {
+    const double elapsed = now - m_start;
+    if (m_calibrating) {
+      if (elapsed < m_min_time && m_batch < (1L << 30)) {
+        // Grow toward the minimum time, but never by more than 10x on a single (possibly noisy) short batch
+        long next = (elapsed > 0.0) ? (long)(m_batch * 1.2 * m_min_time / elapsed) : m_batch * 10;
+        m_batch = std::min(std::max(next, m_batch * 2), m_batch * 10);
+      } else {
+        m_calibrating = false;
+      }
+    } else {
+      m_samples.push_back(elapsed * 1.0e9 / m_batch);
+      if ((int)m_samples.size() >= m_repetitions) return false;
+    }
+  }
+
+  m_remaining = m_batch - 1;
+  m_start = Now();
+  return true;
+}
+
+
+double Avida::Benchmark::Run::GetMedian() const
+{
+  if (m_samples.size() == 0) return 0.0;
+  std::vector<double> sorted(m_samples);
+  std::sort(sorted.begin(), sorted.end());
+  const size_t mid = sorted.size() / 2;
+  return (sorted.size() % 2) ? sorted[mid] : (sorted[mid - 1] + sorted[mid]) / 2.0;
+}
+
+double Avida::Benchmark::Run::GetMinimum() const
+{
+  if (m_samples.size() == 0) return 0.0;
+  return *std::min_element(m_samples.begin(), m_samples.end());
+}
+
+
+std::vector<Avida::Benchmark::Entry>& Avida::Benchmark::Registry()
+{
+  // Function local so that registrars in other translation units can run during static initialization
+  static std::vector<Entry> registry;
+  return registry;
+}
+
+
+double Avida::Benchmark::Now()
+{
+#if APTO_PLATFORM(UNIX) && defined(CLOCK_MONOTONIC)
+  timespec ts;
+  if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) return ts.tv_sec + ts.tv_nsec * 1.0e-9;
+#endif
+#if APTO_PLATFORM(UNIX)
+  timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + tv.tv_usec * 1.0e-6;
+#else
+  return (double)std::clock() / CLOCKS_PER_SEC;
+#endif
+}
@@ -0,0 +1,109 @@
+/*
+ *  benchmarks/Benchmark.h
+ *  avida-core
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef AvidaBenchmark_h
+#define AvidaBenchmark_h
+
+#include <string>
+#include <vector>
+
+class cAvidaContext;
+class cWorld;
+
+
+namespace Avida {
+  namespace Benchmark {
+
+    // Benchmark::Run - Timing state handed to each benchmark function
+    // --------------------------------------------------------------------------------------------------------------
+    //
+    // A benchmark does its setup, then times its inner loop with
+    //   while (run.KeepRunning()) { ... one operation ... }
+    // The first batches calibrate how many operations it takes to fill the minimum time; after that the same batch
+    // is timed once per repetition.  Results are reported per operation, as the median and the fastest batch.
+
+    class Run
+    {
+    private:
+      cWorld* m_world;
+      double m_min_time;        // Seconds each timed batch should last
+      int m_repetitions;
+
+      bool m_calibrating;
+      bool m_skipped;
+      std::string m_skip_reason;
+      long m_batch;             // Operations per batch
+      long m_remaining;         // Operations left in the current batch
+      double m_start;
+      std::vector<double> m_samples;  // Nanoseconds per operation, one per timed batch
+
+      Run(const Run&); // @not_implemented
+      Run& operator=(const Run&); // @not_implemented
+
+    public:
+      Run(cWorld* world, double min_time, int repetitions);
+
+      cWorld* GetWorld() { return m_world; }
+      cAvidaContext& GetContext();
+
+      inline bool KeepRunning() { if (m_remaining > 0) { m_remaining--; return true; } return nextBatch(); }
+
+      //! Mark the benchmark as unable to run in this configuration; KeepRunning() will return false.
+      void Skip(const std::string& reason) { m_skipped = true; m_skip_reason = reason; }
+
+      bool IsSkipped() const { return m_skipped; }
+      const std::string& GetSkipReason() const { return m_skip_reason; }
+      long GetIterations() const { return m_calibrating ? 0 : m_batch; }
+      int GetRepetitions() const { return m_samples.size(); }
+      double GetMedian() const;
+      double GetMinimum() const;
+
+    private:
+      bool nextBatch();
+    };
+
+
+    typedef void (*Function)(Run& run);
+
+    struct Entry
+    {
+      const char* name;
+      Function function;
+    };
+
+    std::vector<Entry>& Registry();
+
+    struct Registrar
+    {
+      Registrar(const char* name, Function function) { Entry e = { name, function }; Registry().push_back(e); }
+    };
+
+    //! Monotonic wall clock time in seconds
+    double Now();
+
+  };
+};
+
+//! Register a benchmark function under a dotted name (area.component.operation) for the avida-bench driver.
+#define AVIDA_BENCHMARK(NAME, FUNCTION) \
+  static Avida::Benchmark::Registrar s_registrar_ ## FUNCTION(NAME, FUNCTION)
+
+#endif
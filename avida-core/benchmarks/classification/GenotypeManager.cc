@@ -0,0 +1,87 @@
+/*
+ *  benchmarks/classification/GenotypeManager.cc
+ *  avida-core
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../Benchmark.h"
+
+#include "avida/core/Genome.h"
+
+#include "cAvidaContext.h"
+#include "cBioGroup.h"
+#include "cBioGroupManager.h"
+#include "cClassificationManager.h"
+#include "cDemePlaceholderUnit.h"
+#include "cHardwareManager.h"
+#include "cInstSet.h"
+#include "cRandom.h"
+#include "cWorld.h"
+
+#include <vector>
+
+using namespace Avida;
+
+
+namespace {
+  // Population turnover as the genotype manager sees it: a random one of 3600 units dies and is replaced by a unit
+  // carrying one of 500 genomes (point mutants of a common ancestor), found by hash lookup or classified as new.
+  void ClassifyTurnover(Benchmark::Run& run)
+  {
+    const int num_units = 3600;
+    const int num_genomes = 500;
+
+    cWorld* world = run.GetWorld();
+    cAvidaContext& ctx = run.GetContext();
+    cRandom& rng = ctx.GetRandom();
+    cBioGroupManager* bgm = world->GetClassificationManager().GetBioGroupManager("genotype");
+
+    const cInstSet& is = world->GetHardwareManager().GetDefaultInstSet();
+    Sequence ancestor(100);
+    for (int i = 0; i < ancestor.GetSize(); i++) ancestor[i] = is.GetRandomInst(ctx);
+    std::vector<Genome> genomes;
+    for (int i = 0; i < num_genomes; i++) {
+      Sequence seq(ancestor);
+      for (int m = 0; m < 3; m++) seq[rng.GetUInt(seq.GetSize())] = is.GetRandomInst(ctx);
+      genomes.push_back(Genome(is.GetHardwareType(), is.GetInstSetName(), seq));
+    }
+
+    std::vector<cDemePlaceholderUnit*> units(num_units);
+    std::vector<cBioGroup*> groups(num_units);
+    for (int i = 0; i < num_units; i++) {
+      units[i] = new cDemePlaceholderUnit(SRC_ORGANISM_RANDOM, genomes[rng.GetUInt(num_genomes)]);
+      groups[i] = bgm->ClassifyNewBioUnit(units[i]);
+    }
+
+    while (run.KeepRunning()) {
+      const int slot = rng.GetUInt(num_units);
+      groups[slot]->RemoveBioUnit(units[slot]);
+      delete units[slot];
+      units[slot] = new cDemePlaceholderUnit(SRC_ORGANISM_RANDOM, genomes[rng.GetUInt(num_genomes)]);
+      groups[slot] = bgm->ClassifyNewBioUnit(units[slot]);
+    }
+
+    for (int i = 0; i < num_units; i++) {
+      groups[i]->RemoveBioUnit(units[i]);
+      delete units[i];
+    }
+  }
+}
+
+
+AVIDA_BENCHMARK("classification.genotype_manager.classify", ClassifyTurnover);
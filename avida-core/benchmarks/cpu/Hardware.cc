@@ -0,0 +1,148 @@
+/*
+ *  benchmarks/cpu/Hardware.cc
+ *  avida-core
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../Benchmark.h"
+
+#include "avida/core/Genome.h"
+
+#include "cAvidaContext.h"
+#include "cCPUTestInfo.h"
+#include "cHardwareBase.h"
+#include "cHardwareManager.h"
+#include "cInstSet.h"
+#include "cOrganism.h"
+#include "cStringList.h"
+#include "cTestCPU.h"
+#include "cTestCPUInterface.h"
+#include "cUserFeedback.h"
+#include "cWorld.h"
+
+using namespace Avida;
+
+
+namespace {
+  // Build a genome for the named instruction set from a space separated list of instruction names
+  bool buildGenome(cWorld* world, const cString& instset_name, const cString& insts, Genome& genome)
+  {
+    cHardwareManager& hwm = world->GetHardwareManager();
+    if (!hwm.IsInstSet(instset_name)) return false;
+    const cInstSet& is = hwm.GetInstSet(instset_name);
+
+    cStringList names(insts);
+    Sequence seq(names.GetSize());
+    for (int i = 0; i < seq.GetSize(); i++) {
+      seq[i] = is.GetInst(names.Pop());
+      if (seq[i] == is.GetInstError()) return false;
+    }
+    genome = Genome(is.GetHardwareType(), instset_name, seq);
+    return true;
+  }
+
+  // Time single instruction executions of a test organism looping over genome
+  void runOrganism(Benchmark::Run& run, const Genome& genome)
+  {
+    cAvidaContext& ctx = run.GetContext();
+    ctx.SetTestMode();
+
+    cTestCPU* testcpu = run.GetWorld()->GetHardwareManager().CreateTestCPU(ctx);
+    cCPUTestInfo test_info;
+    cOrganism* organism = new cOrganism(run.GetWorld(), ctx, genome, -1, SRC_TEST_CPU);
+    organism->SetOrgInterface(ctx, new cTestCPUInterface(testcpu, test_info, 0));
+    organism->GetPhenotype().SetupInject(genome.GetSequence());
+
+    cHardwareBase& hw = organism->GetHardware();
+    while (run.KeepRunning()) hw.SingleProcess(ctx);
+
+    organism->NotifyDeath(ctx);
+    delete organism;
+    delete testcpu;
+    ctx.ClearTestMode();
+  }
+
+  void runDispatch(Benchmark::Run& run, const cString& instset_name)
+  {
+    // Straight line arithmetic, stack and register instructions with no flow control, repeated to fill a genome
+    cString insts;
+    for (int i = 0; i < 10; i++) insts += "inc dec shift-l shift-r nand add sub swap push pop ";
+
+    Genome genome;
+    if (!buildGenome(run.GetWorld(), instset_name, insts, genome)) {
+      run.Skip("instruction set unavailable");
+      return;
+    }
+    runOrganism(run, genome);
+  }
+
+  void runLabelSearch(Benchmark::Run& run, const cString& instset_name, const cString& search, const cString& target)
+  {
+    // Search forward across 200 instructions for the target label, then jump there and wrap around to search again
+    cString insts(search);
+    insts += " nop-A nop-B nop-C mov-head";
+    for (int i = 0; i < 200; i++) insts += " inc";
+    insts += " ";
+    insts += target;
+
+    Genome genome;
+    if (!buildGenome(run.GetWorld(), instset_name, insts, genome)) {
+      run.Skip("instruction set unavailable");
+      return;
+    }
+    runOrganism(run, genome);
+  }
+
+
+  void HeadsDispatch(Benchmark::Run& run) { runDispatch(run, "heads_default"); }
+  void ExperimentalDispatch(Benchmark::Run& run) { runDispatch(run, "bench-experimental"); }
+
+  // h-search looks for the complement label, nop-(A,B,C) -> nop-(B,C,A)
+  void HeadsLabelSearch(Benchmark::Run& run) { runLabelSearch(run, "heads_default", "h-search", "nop-B nop-C nop-A"); }
+  void ExperimentalLabelSearch(Benchmark::Run& run)
+  {
+    runLabelSearch(run, "bench-experimental", "search-seq-direct-f", "nop-A nop-B nop-C");
+  }
+
+
+  void TestGenome(Benchmark::Run& run)
+  {
+    cWorld* world = run.GetWorld();
+    cUserFeedback feedback;
+    Genome genome;
+    if (!genome.LoadFromDetailFile("default-heads.org", world->GetWorkingDir(), world->GetHardwareManager(), feedback)) {
+      run.Skip("default-heads.org not found in the config directory");
+      return;
+    }
+
+    cAvidaContext& ctx = run.GetContext();
+    cTestCPU* testcpu = world->GetHardwareManager().CreateTestCPU(ctx);
+    while (run.KeepRunning()) {
+      cCPUTestInfo test_info;
+      testcpu->TestGenome(ctx, test_info, genome);
+    }
+    delete testcpu;
+  }
+}
+
+
+AVIDA_BENCHMARK("cpu.heads.dispatch", HeadsDispatch);
+AVIDA_BENCHMARK("cpu.experimental.dispatch", ExperimentalDispatch);
+AVIDA_BENCHMARK("cpu.heads.label_search", HeadsLabelSearch);
+AVIDA_BENCHMARK("cpu.experimental.label_search", ExperimentalLabelSearch);
+AVIDA_BENCHMARK("cpu.test_cpu.test_genome", TestGenome);
@@ -0,0 +1,222 @@
+/*
+ *  benchmarks/main.cc
+ *  avida-core
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// avida-bench - Microbenchmarks of the core simulation hot paths
+//
+//   avida-bench [-c config_dir] [-f filter] [-t min_seconds] [-r repetitions] [-o results.json]
+//               [-b baseline.json [-s slowdown_percent]]
+//
+// The world is built from avida.cfg in config_dir (default: the current directory) with a fixed random seed.  Each
+// benchmark whose name contains the filter string is run and reported to stdout; with -o the results are also
+// written one JSON object per line:
+//   {"name":"cpu.heads.dispatch","iterations":65536,"repetitions":5,"ns_per_op":41.2,"min_ns_per_op":40.8}
+// Passing the results file of an earlier build with -b prints the change for each benchmark and exits with status 1
+// if any of them got slower (by median) than the allowed percentage, which defaults to 10.
+//
+// The timing harness lives here rather than on top of the googletest copy that apto bundles for its unit-tests
+// target: gtest reports pass/fail per test, and has no batch calibration, per-operation timing or comparison against
+// the results of an earlier build.
+
+#include "Benchmark.h"
+
+#include "apto/core/FileSystem.h"
+#include "avida/Avida.h"
+
+#include "cAvidaConfig.h"
+#include "cUserFeedback.h"
+#include "cWorld.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+
+using namespace std;
+
+
+namespace {
+  void usage(const char* prog)
+  {
+    cerr << "usage: " << prog << " [-c config_dir] [-f filter] [-t min_seconds] [-r repetitions] [-o results.json]"
+         << " [-b baseline.json [-s slowdown_percent]]" << endl;
+  }
+
+  // Pull "key":value out of one of our own result lines; not a general JSON parser
+  bool findField(const string& line, const string& key, string& value)
+  {
+    const string tag = "\"" + key + "\":";
+    size_t pos = line.find(tag);
+    if (pos == string::npos) return false;
+    pos += tag.size();
+    if (pos < line.size() && line[pos] == '"') {
+      const size_t end = line.find('"', pos + 1);
+      if (end == string::npos) return false;
+      value = line.substr(pos + 1, end - pos - 1);
+    } else {
+      const size_t end = line.find_first_of(",}", pos);
+      if (end == string::npos) return false;
+      value = line.substr(pos, end - pos);
+    }
+    return true;
+  }
+
+  bool loadBaseline(const char* filename, map<string, double>& baseline)
+  {
+    ifstream in(filename);
+    if (!in.good()) return false;
+    string line, name, ns;
+    while (getline(in, line)) {
+      if (findField(line, "name", name) && findField(line, "ns_per_op", ns)) baseline[name] = atof(ns.c_str());
+    }
+    return true;
+  }
+
+  cWorld* setupWorld(const cString& config_dir)
+  {
+    cAvidaConfig* cfg = new cAvidaConfig();
+    cUserFeedback feedback;
+    cfg->Load("avida.cfg", config_dir, &feedback, NULL, false);
+    cfg->RANDOM_SEED.Set(101);
+    cfg->VERBOSITY.Set(0);
+
+    // The experimental hardware benchmarks need an instruction set for it, whatever the configuration uses
+    const char* experimental_insts[] = {
+      "nop-A", "nop-B", "nop-C", "nop-D", "inc", "dec", "shift-l", "shift-r", "nand", "add", "sub", "swap", "push",
+      "pop", "search-seq-direct-f", "mov-head", "h-alloc", "h-copy", "h-divide", "IO", NULL
+    };
+    cfg->INSTSETS.Add("INSTSET bench-experimental:hw_type=3");
+    for (int i = 0; experimental_insts[i]; i++) cfg->INSTSETS.Add(cString("INST ") + experimental_insts[i]);
+
+    cWorld* world = cWorld::Initialize(cfg, config_dir, &feedback);
+    for (int i = 0; i < feedback.GetNumMessages(); i++) {
+      if (feedback.GetMessageType(i) == cUserFeedback::UF_ERROR) cerr << "error: " << feedback.GetMessage(i) << endl;
+    }
+    return world;
+  }
+}
+
+
+int main(int argc, char* argv[])
+{
+  cString config_dir(Apto::FileSystem::GetCWD());
+  const char* filter = "";
+  const char* output_file = NULL;
+  const char* baseline_file = NULL;
+  double min_time = 0.2;
+  int repetitions = 5;
+  double threshold = 10.0;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
+      usage(argv[0]);
+      return 0;
+    }
+    if (i + 1 >= argc || argv[i][0] != '-' || strlen(argv[i]) != 2) {
+      usage(argv[0]);
+      return 2;
+    }
+    const char* arg = argv[++i];
+    switch (argv[i - 1][1]) {
+      case 'c': config_dir = arg; break;
+      case 'f': filter = arg; break;
+      case 't': min_time = atof(arg); break;
+      case 'r': repetitions = atoi(arg); break;
+      case 'o': output_file = arg; break;
+      case 'b': baseline_file = arg; break;
+      case 's': threshold = atof(arg); break;
+      default: usage(argv[0]); return 2;
+    }
+  }
+  if (min_time <= 0.0 || repetitions < 1) {
+    usage(argv[0]);
+    return 2;
+  }
+
+  map<string, double> baseline;
+  if (baseline_file && !loadBaseline(baseline_file, baseline)) {
+    cerr << "error: unable to read baseline '" << baseline_file << "'" << endl;
+    return 2;
+  }
+
+  Avida::Initialize();
+  cWorld* world = setupWorld(config_dir);
+  if (!world) return 2;
+
+  ofstream out;
+  if (output_file) {
+    out.open(output_file);
+    if (!out.good()) {
+      cerr << "error: unable to open '" << output_file << "'" << endl;
+      return 2;
+    }
+  }
+
+  printf("%-40s %12s %14s %14s", "benchmark", "iterations", "ns/op", "min ns/op");
+  if (baseline_file) printf(" %10s", "change");
+  printf("\n");
+
+  int regressions = 0;
+  vector<Avida::Benchmark::Entry>& registry = Avida::Benchmark::Registry();
+  for (size_t i = 0; i < registry.size(); i++) {
+    const string name(registry[i].name);
+    if (name.find(filter) == string::npos) continue;
+
+    Avida::Benchmark::Run run(world, min_time, repetitions);
+    registry[i].function(run);
+    if (run.IsSkipped() || run.GetRepetitions() == 0) {
+      printf("%-40s skipped: %s\n", name.c_str(), run.IsSkipped() ? run.GetSkipReason().c_str() : "never ran");
+      continue;
+    }
+
+    printf("%-40s %12ld %14.1f %14.1f", name.c_str(), run.GetIterations(), run.GetMedian(), run.GetMinimum());
+    if (baseline_file) {
+      map<string, double>::iterator it = baseline.find(name);
+      if (it != baseline.end() && it->second > 0.0) {
+        const double change = (run.GetMedian() - it->second) * 100.0 / it->second;
+        printf(" %+9.1f%%", change);
+        if (change > threshold) {
+          printf("  REGRESSION");
+          regressions++;
+        }
+      } else {
+        printf(" %10s", "new");
+      }
+    }
+    printf("\n");
+    fflush(stdout);
+
+    if (output_file) {
+      char line[512];
+      snprintf(line, sizeof(line), "{\"name\":\"%s\",\"iterations\":%ld,\"repetitions\":%d,\"ns_per_op\":%.3f,\"min_ns_per_op\":%.3f}",
+               name.c_str(), run.GetIterations(), run.GetRepetitions(), run.GetMedian(), run.GetMinimum());
+      out << line << endl;
+    }
+  }
+
+  if (regressions) {
+    printf("%d benchmark(s) slowed by more than %.1f%%\n", regressions, threshold);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,90 @@
+/*
+ *  benchmarks/main/Environment.cc
+ *  avida-core
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../Benchmark.h"
+
+#include "avida/core/Genome.h"
+
+#include "cAvidaContext.h"
+#include "cCPUTestInfo.h"
+#include "cEnvironment.h"
+#include "cHardwareBase.h"
+#include "cHardwareManager.h"
+#include "cOrganism.h"
+#include "cReactionResult.h"
+#include "cTaskContext.h"
+#include "cTestCPU.h"
+#include "cTestCPUInterface.h"
+#include "cWorld.h"
+#include "tBuffer.h"
+#include "tList.h"
+
+using namespace Avida;
+
+
+namespace {
+  // Check one output against every task and reaction in the environment, as an organism's IO does
+  void TestOutput(Benchmark::Run& run)
+  {
+    cWorld* world = run.GetWorld();
+    cAvidaContext& ctx = run.GetContext();
+    const cEnvironment& env = world->GetEnvironment();
+    ctx.SetTestMode();
+
+    const cInstSet& is = world->GetHardwareManager().GetDefaultInstSet();
+    Genome genome(is.GetHardwareType(), is.GetInstSetName(), Sequence(100));
+    cTestCPU* testcpu = world->GetHardwareManager().CreateTestCPU(ctx);
+    cCPUTestInfo test_info;
+    cOrganism* organism = new cOrganism(world, ctx, genome, -1, SRC_TEST_CPU);
+    organism->SetOrgInterface(ctx, new cTestCPUInterface(testcpu, test_info, 0));
+
+    tArray<int> input_array;
+    env.SetupInputs(ctx, input_array, false);
+    tBuffer<int> inputs(env.GetInputSize());
+    for (int i = 0; i < input_array.GetSize(); i++) inputs.Add(input_array[i]);
+    tBuffer<int> outputs(env.GetOutputSize());
+    if (input_array.GetSize() >= 2) outputs.Add(~(input_array[0] & input_array[1]));
+    else outputs.Add(0);
+
+    tList<tBuffer<int> > other_inputs;
+    tList<tBuffer<int> > other_outputs;
+    cTaskContext taskctx(organism, inputs, outputs, other_inputs, other_outputs, organism->GetHardware().GetExtendedMemory());
+
+    const int num_resources = env.GetResourceLib().GetSize();
+    tArray<int> task_count(env.GetNumTasks(), 0);
+    tArray<int> reaction_count(env.GetNumReactions(), 0);
+    tArray<double> resource_count(num_resources, 0.0);
+    tArray<double> rbins_count(num_resources, 0.0);
+
+    while (run.KeepRunning()) {
+      cReactionResult result(num_resources, env.GetNumTasks(), env.GetNumReactions());
+      env.TestOutput(ctx, result, taskctx, task_count, reaction_count, resource_count, rbins_count);
+    }
+
+    organism->NotifyDeath(ctx);
+    delete organism;
+    delete testcpu;
+    ctx.ClearTestMode();
+  }
+}
+
+
+AVIDA_BENCHMARK("main.environment.test_output", TestOutput);
@@ -0,0 +1,57 @@
+/*
+ *  benchmarks/main/GenomeUtil.cc
+ *  avida-core
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../Benchmark.h"
+
+#include "avida/core/Sequence.h"
+
+#include "cAvidaContext.h"
+#include "cGenomeUtil.h"
+#include "cRandom.h"
+
+
+namespace {
+  // Default-sized HGT fragments (HGT_FRAGMENT_SIZE_MEAN) placed into a default-sized genome
+  const int GENOME_SIZE = 100;
+  const int FRAGMENT_SIZE = 10;
+  const int NUM_INSTS = 26;
+
+  volatile int s_sink;  // keeps the matches from being optimized away
+
+  Avida::Sequence randomSequence(cRandom& rng, int size)
+  {
+    Avida::Sequence seq(size);
+    for (int i = 0; i < size; i++) seq[i].SetOp(rng.GetUInt(NUM_INSTS));
+    return seq;
+  }
+
+  void CircularMatch(Avida::Benchmark::Run& run)
+  {
+    cAvidaContext& ctx = run.GetContext();
+    const Avida::Sequence genome = randomSequence(ctx.GetRandom(), GENOME_SIZE);
+    const Avida::Sequence fragment = randomSequence(ctx.GetRandom(), FRAGMENT_SIZE);
+
+    while (run.KeepRunning()) s_sink = cGenomeUtil::FindUnbiasedCircularMatch(ctx, genome, fragment).cost;
+  }
+}
+
+
+AVIDA_BENCHMARK("main.genome_util.circular_match", CircularMatch);
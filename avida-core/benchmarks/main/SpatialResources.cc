@@ -0,0 +1,43 @@
+/*
+ *  benchmarks/main/SpatialResources.cc
+ *  avida-core
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../Benchmark.h"
+
+#include "cAvidaContext.h"
+#include "cRandom.h"
+#include "cSpatialResCount.h"
+#include "nGeometry.h"
+
+
+namespace {
+  // One diffusion and gravity step of a spatial resource over a 60x60 torus
+  void FlowAll(Avida::Benchmark::Run& run)
+  {
+    cSpatialResCount res(60, 60, nGeometry::TORUS, 0.1, 0.1, 0.05, -0.05);
+    cRandom& rng = run.GetContext().GetRandom();
+    for (int i = 0; i < res.GetSize(); i++) res.SetCellAmount(i, rng.GetDouble(100.0));
+
+    while (run.KeepRunning()) res.FlowAll();
+  }
+}
+
+
+AVIDA_BENCHMARK("main.spatial_res_count.flow_all", FlowAll);
@@ -0,0 +1,55 @@
+/*
+ *  benchmarks/tools/DataFile.cc
+ *  avida-core
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../Benchmark.h"
+
+#include "cDataFile.h"
+#include "cString.h"
+
+#include <cstdio>
+
+
+namespace {
+  // One line of a typical stats file: an update, a handful of averages and counts
+  void WriteLine(Avida::Benchmark::Run& run)
+  {
+    cString filename("avida-bench-datafile.dat");
+    {
+      cDataFile df(filename);
+      int update = 0;
+      while (run.KeepRunning()) {
+        df.Write(update, "Update");
+        df.Write(0.0421 + update * 1e-6, "Average Merit");
+        df.Write(387.25, "Average Gestation Time");
+        df.Write(0.000108, "Average Fitness");
+        df.Write(3600, "Organisms");
+        df.Write(412, "Genotypes");
+        df.Write(12.5, "Average Generation");
+        df.Endl();
+        update++;
+      }
+    }
+    remove(filename);
+  }
+}
+
+
+AVIDA_BENCHMARK("tools.data_file.write_line", WriteLine);
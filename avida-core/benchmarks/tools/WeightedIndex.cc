@@ -0,0 +1,61 @@
+/*
+ *  benchmarks/tools/WeightedIndex.cc
+ *  avida-core
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../Benchmark.h"
+
+#include "cAvidaContext.h"
+#include "cRandom.h"
+#include "cWeightedIndex.h"
+
+
+namespace {
+  // A weighted index the size of a default (60x60) world, as used by the probabilistic schedulers
+  const int INDEX_SIZE = 3600;
+
+  volatile int s_sink;  // keeps the draws from being optimized away
+
+  void fillIndex(cWeightedIndex& index, cRandom& rng)
+  {
+    for (int i = 0; i < index.GetSize(); i++) index.SetWeight(i, rng.GetDouble(0.5, 2.0));
+  }
+
+  void Draw(Avida::Benchmark::Run& run)
+  {
+    cRandom& rng = run.GetContext().GetRandom();
+    cWeightedIndex index(INDEX_SIZE);
+    fillIndex(index, rng);
+
+    while (run.KeepRunning()) s_sink = index.FindPosition(rng.GetDouble(index.GetTotalWeight()));
+  }
+
+  void SetWeight(Avida::Benchmark::Run& run)
+  {
+    cRandom& rng = run.GetContext().GetRandom();
+    cWeightedIndex index(INDEX_SIZE);
+    fillIndex(index, rng);
+
+    while (run.KeepRunning()) index.SetWeight(rng.GetUInt(INDEX_SIZE), rng.GetDouble(0.5, 2.0));
+  }
+}
+
+
+AVIDA_BENCHMARK("tools.weighted_index.draw", Draw);
+AVIDA_BENCHMARK("tools.weighted_index.set_weight", SetWeight);
@@ -0,0 +1,89 @@
+/*
+ *  private/viewer-core/PopulationSnapshot.h
+ *  Avida
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef AvidaCoreViewPopulationSnapshot_h
+#define AvidaCoreViewPopulationSnapshot_h
+
+// A PopulationSnapshot holds the per-cell state that map modes and listeners draw from, copied out of the population
+// in a single pass at the end of an update.  Everything in it is plain data, so once captured on the simulation
+// thread it can be handed to another thread and read there while the simulation moves on.
+//
+// Genotype colors are assigned by ClassificationInfo, which walks the live classification manager; that also has
+// to happen on the simulation thread, so the assigned color is captured alongside the genotype ID.
+
+#include "apto/core.h"
+
+class cWorld;
+
+
+namespace Avida {
+  namespace CoreView {
+
+    class ClassificationInfo;
+
+
+    // PopulationSnapshot Definition
+    // --------------------------------------------------------------------------------------------------------------
+
+    class PopulationSnapshot
+    {
+    public:
+      static const int NUM_GENOTYPE_COLORS = 10;  // Distinct colors handed out to the most abundant genotypes
+      
+    private:
+      int m_update;
+      int m_num_tasks;
+      int m_task_words;  // Words of task bits stored per cell
+
+      Apto::Array<int> m_genotype_id;       // -1 for empty cells
+      Apto::Array<int> m_genotype_color;    // ClassificationInfo color, -1 if none assigned
+      Apto::Array<double> m_fitness;
+      Apto::Array<double> m_merit;
+      Apto::Array<unsigned int> m_tasks;    // Tasks performed during the last gestation, m_task_words per cell
+
+      PopulationSnapshot(const PopulationSnapshot&); // @not_implemented
+      PopulationSnapshot& operator=(const PopulationSnapshot&); // @not_implemented
+
+    public:
+      PopulationSnapshot() : m_update(-1), m_num_tasks(0), m_task_words(0) { ; }
+
+      //! Copy the state of every cell; must be called on the thread running the world.  genotype_info may be NULL.
+      void Capture(cWorld* world, ClassificationInfo* genotype_info);
+
+      inline int GetUpdate() const { return m_update; }
+      inline int GetSize() const { return m_genotype_id.GetSize(); }
+      inline int GetNumTasks() const { return m_num_tasks; }
+
+      inline bool IsOccupied(int cell) const { return m_genotype_id[cell] >= 0; }
+      inline int GetGenotypeID(int cell) const { return m_genotype_id[cell]; }
+      inline int GetGenotypeColor(int cell) const { return m_genotype_color[cell]; }
+      inline double GetFitness(int cell) const { return m_fitness[cell]; }
+      inline double GetMerit(int cell) const { return m_merit[cell]; }
+      inline bool HasTask(int cell, int task) const
+      {
+        return (m_tasks[cell * m_task_words + task / 32] >> (task % 32)) & 1;
+      }
+    };
+
+  };
+};
+
+#endif
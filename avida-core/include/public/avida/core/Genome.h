@@ -83,6 +83,14 @@ namespace Avida {
     LIB_EXPORT Genome& operator=(const Genome& gen)
       { m_hw_type = gen.m_hw_type; m_inst_set = gen.m_inst_set; m_seq = gen.m_seq; return *this; }
 
+    // Exchange contents with gen without copying the sequence
+    LIB_EXPORT void Swap(Genome& gen)
+    {
+      const int hw_type = m_hw_type; m_hw_type = gen.m_hw_type; gen.m_hw_type = hw_type;
+      const cString inst_set(m_inst_set); m_inst_set = gen.m_inst_set; gen.m_inst_set = inst_set;
+      m_seq.Swap(gen.m_seq);
+    }
+
     
     LIB_EXPORT void Load(const tDictionary<cString>& props, cHardwareManager& hwm);
     LIB_EXPORT void Save(cDataFile& df);
@@ -93,6 +93,13 @@ namespace Avida {
     
     inline void Append(const cInstruction& inst) { Insert(GetSize(), inst); }
     inline void Append(const Sequence& seq) { Insert(GetSize(), seq); }
+
+    // Replace the contents with [start, end) of seq, reusing the existing storage when it is large enough
+    void Assign(const Sequence& seq, int start, int end);
+    
+    // Exchange contents (including mutation steps) without copying; for plain sequences only, as the per-site state
+    // that subclasses keep alongside is not exchanged
+    void Swap(Sequence& other);
     
     int FindInst(const cInstruction& inst, int start_index = 0) const;
     int CountInst(const cInstruction& inst) const;
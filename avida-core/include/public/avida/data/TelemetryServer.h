@@ -0,0 +1,85 @@
+/*
+ *  data/TelemetryServer.h
+ *  avida-core
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef AvidaDataTelemetryServer_h
+#define AvidaDataTelemetryServer_h
+
+#include "apto/core.h"
+#include "apto/platform.h"
+#include "avida/core/Types.h"
+#include "avida/data/Recorder.h"
+
+#include <string>
+
+
+namespace Avida {
+  namespace Data {
+
+    // Data::TelemetryServer - Streams the requested data values to clients of a local (Unix domain) socket
+    // --------------------------------------------------------------------------------------------------------------
+    //
+    // Each update the recorder formats the requested values as a single JSON object on one line, e.g.
+    //   {"update":120,"core.world.organisms":3600,"core.world.ave_fitness":0.0421}
+    // and appends it to a fixed size ring of recent lines.  A server thread accepts clients and writes the ring out
+    // to each of them with non-blocking sends.  The simulation thread only ever formats the line and swaps it into
+    // the ring, so a slow or stalled client cannot hold up the run; a client that falls more than a ring's length
+    // behind skips ahead to the oldest line still held.  Clients receive lines from the update they connect on.
+
+    class TelemetryServer : public Recorder, public Apto::Thread
+    {
+    private:
+      Apto::String m_path;
+      ConstDataSetPtr m_requested;
+
+      int m_listen_fd;
+      int m_wake_fd[2];  // Self-pipe used to wake the server thread when a new line is ready or on shutdown
+
+      Apto::Mutex m_mutex;
+      Apto::Array<std::string> m_ring;
+      int m_next_line;   // Sequence number of the next line to be added; line n is at m_ring[n % size]
+      bool m_done;
+
+      TelemetryServer(); // @not_implemented
+      TelemetryServer(const TelemetryServer&); // @not_implemented
+      TelemetryServer& operator=(const TelemetryServer&); // @not_implemented
+
+    public:
+      LIB_EXPORT TelemetryServer(const Apto::String& path, ConstDataSetPtr requested, int buffer_lines);
+      LIB_EXPORT ~TelemetryServer();
+
+      //! Create the socket and start serving; returns false if the socket could not be set up.
+      LIB_EXPORT bool Open();
+
+      // Data::Recorder Interface
+      LIB_EXPORT ConstDataSetPtr GetRequested() { return m_requested; }
+      LIB_EXPORT void NotifyData(Update current_update, DataRetrievalFunctor retrieve_data);
+
+    protected:
+      void Run();
+
+    private:
+      void closeSocket();
+    };
+
+  };
+};
+
+#endif
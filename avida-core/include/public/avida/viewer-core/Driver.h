@@ -39,8 +39,10 @@ namespace Avida {
     // Class Declarations
     // --------------------------------------------------------------------------------------------------------------  
     
+    class ClassificationInfo;
     class Map;
     class Listener;
+    class PopulationSnapshot;
 
 
     // Enumerations
@@ -57,6 +59,9 @@ namespace Avida {
     
     class Driver : public Apto::Thread, public Avida::WorldDriver
     {
+    private:
+      class SnapshotConsumer;
+      
     private:
       cWorld* m_world;
       
@@ -69,6 +74,22 @@ namespace Avida {
       Map* m_map;
       
       Apto::Set<Listener*> m_listeners;
+      Apto::Mutex m_listener_mutex;  // Held while listeners are attached, detached or notified
+      
+      // Display pipeline: at the end of each update the simulation thread captures the population into
+      // m_snapshot_back and swaps it into m_snapshot_ready; the consumer thread swaps that out into m_snapshot_front
+      // and updates the map and notifies listeners from it.  Only pointer swaps happen under m_snapshot_mutex, so
+      // the simulation never waits on the display.  If the display falls behind, older snapshots are dropped.
+      ClassificationInfo* m_genotype_info;  // Simulation thread only
+      PopulationSnapshot* m_snapshot_back;
+      PopulationSnapshot* m_snapshot_ready;
+      PopulationSnapshot* m_snapshot_front;
+      Apto::Mutex m_snapshot_mutex;
+      Apto::ConditionVariable m_snapshot_cv;
+      bool m_snapshot_pending;
+      bool m_snapshot_done;
+      int m_num_listeners;
+      SnapshotConsumer* m_consumer;  // NULL if no consumer thread is running; snapshots are then consumed inline
       
       
       Driver(); // @not_implemented
@@ -87,7 +108,7 @@ namespace Avida {
       bool IsPaused() const { return m_paused; }
       
       void AttachListener(Listener* listener);
-      void DetachListener(Listener* listener) { m_listeners.Remove(listener); }
+      void DetachListener(Listener* listener);
 
       void AttachRecorder(Data::RecorderPtr recorder);
       void DetachRecorder(Data::RecorderPtr recorder);
@@ -115,6 +136,12 @@ namespace Avida {
       
     protected:
       void Run();
+      
+      
+    private:
+      void publishSnapshot();
+      void consumeSnapshot();
+      void stopConsumer();
     };
 
   };
@@ -26,12 +26,13 @@
 
 #include "apto/core.h"
 
-class cPopulation;
 class cWorld;
 
 
 namespace Avida {
   namespace CoreView {
+
+    class PopulationSnapshot;
     
     // Map Mode/Type Enumerations
     // --------------------------------------------------------------------------------------------------------------  
@@ -83,7 +84,7 @@ namespace Avida {
       
       virtual int GetSupportedTypes() const = 0;
       
-      virtual void Update(cPopulation& pop) = 0;
+      virtual void Update(const PopulationSnapshot& snapshot) = 0;
     };
     
     
@@ -148,11 +149,7 @@ namespace Avida {
       
       
       // Core Viewer Internal Methods
-      void UpdateMaps(cPopulation& pop);
-      
-      
-    protected:
-      void updateMap(cPopulation& pop, int map_id);
+      void UpdateMaps(const PopulationSnapshot& snapshot);
     };
     
   };
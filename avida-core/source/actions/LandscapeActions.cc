@@ -811,6 +811,7 @@ class cActionMutationalNeighborhood : public cAction  // @parallelized
 private:
   cString m_filename;
   int m_target;
+  bool m_prune_unexecuted;
   
   struct sBatchEntry {
     cMutationalNeighborhood* mutn;
@@ -823,16 +824,17 @@ private:
   
 public:
   cActionMutationalNeighborhood(cWorld* world, const cString& args, Feedback&)
-    : cAction(world, args), m_filename("mut-neighborhood.dat"), m_target(-1)
+    : cAction(world, args), m_filename("mut-neighborhood.dat"), m_target(-1), m_prune_unexecuted(false)
   {
       cString largs(args);
       if (largs.GetSize()) m_filename = largs.PopWord();
       if (largs.GetSize()) m_target = largs.PopWord().AsInt();
+      if (largs.GetSize()) m_prune_unexecuted = largs.PopWord().AsInt();
   }
   
   static const cString GetDescription()
   {
-    return "Arguments: [string fname='mut-neighborhood.dat'] [int target=-1]";
+    return "Arguments: [string fname='mut-neighborhood.dat'] [int target=-1] [int prune_unexecuted=0]";
   }
   
   void Process(cAvidaContext& ctx)
@@ -852,7 +854,7 @@ public:
       tListIterator<cAnalyzeGenotype> batch_it(m_world->GetAnalyze().GetCurrentBatch().List());
       cAnalyzeGenotype* genotype = NULL;
       while ((genotype = batch_it.Next())) {
-        mutn = new cMutationalNeighborhood(m_world, genotype->GetGenome(), m_target);
+        mutn = new cMutationalNeighborhood(m_world, genotype->GetGenome(), m_target, m_prune_unexecuted);
         m_batch.PushRear(new sBatchEntry(mutn, genotype->GetDepth()));
         jobqueue.AddJob(new tAnalyzeJob<cMutationalNeighborhood>(mutn, &cMutationalNeighborhood::Process));
       }
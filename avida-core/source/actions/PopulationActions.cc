@@ -4086,8 +4086,8 @@ public:
       cerr << "cellB: " << temp_x << " " << temp_y << endl;
 #endif
       
-      tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-      tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
+      cPopulationCell::connection_list_type& cellA_list = cellA.ConnectionList();
+      cPopulationCell::connection_list_type& cellB_list = cellB.ConnectionList();
       cellA_list.Remove(&m_world->GetPopulation().GetCell(idB));
       cellA_list.Remove(&m_world->GetPopulation().GetCell(idB0));
       cellA_list.Remove(&m_world->GetPopulation().GetCell(idB1));
@@ -4163,8 +4163,8 @@ public:
       cerr << "cellB: " << temp_x << " " << temp_y << endl;
 #endif
       
-      tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-      tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
+      cPopulationCell::connection_list_type& cellA_list = cellA.ConnectionList();
+      cPopulationCell::connection_list_type& cellB_list = cellB.ConnectionList();
       cellA_list.Remove(&m_world->GetPopulation().GetCell(idB));
       cellA_list.Remove(&m_world->GetPopulation().GetCell(idB0));
       cellA_list.Remove(&m_world->GetPopulation().GetCell(idB1));
@@ -4225,8 +4225,8 @@ public:
       cPopulationCell& cellB = m_world->GetPopulation().GetCell(idB);
       
       //grab the cell lists
-      tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-      tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
+      cPopulationCell::connection_list_type& cellA_list = cellA.ConnectionList();
+      cPopulationCell::connection_list_type& cellB_list = cellB.ConnectionList();
       
       //these cells are always joined
       if (cellA_list.FindPtr(&cellB)  == NULL) cellA_list.Push(&cellB);
@@ -4301,8 +4301,8 @@ public:
       cPopulationCell& cellB = m_world->GetPopulation().GetCell(idB);
       
       //grab the cell lists
-      tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-      tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
+      cPopulationCell::connection_list_type& cellA_list = cellA.ConnectionList();
+      cPopulationCell::connection_list_type& cellB_list = cellB.ConnectionList();
       
       //these cells are always joined
       if (cellA_list.FindPtr(&cellB)  == NULL) cellA_list.Push(&cellB);
@@ -4360,8 +4360,8 @@ public:
     int idB = m_b_y * world_x + m_b_x;
     cPopulationCell& cellA = m_world->GetPopulation().GetCell(idA);
     cPopulationCell& cellB = m_world->GetPopulation().GetCell(idB);
-    tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-    tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
+    cPopulationCell::connection_list_type& cellA_list = cellA.ConnectionList();
+    cPopulationCell::connection_list_type& cellB_list = cellB.ConnectionList();
     cellA_list.PushRear(&cellB);
     cellB_list.PushRear(&cellA);
   }
@@ -4400,8 +4400,8 @@ public:
     int idB = m_b_y * world_x + m_b_x;
     cPopulationCell& cellA = m_world->GetPopulation().GetCell(idA);
     cPopulationCell& cellB = m_world->GetPopulation().GetCell(idB);
-    tList<cPopulationCell>& cellA_list = cellA.ConnectionList();
-    tList<cPopulationCell>& cellB_list = cellB.ConnectionList();
+    cPopulationCell::connection_list_type& cellA_list = cellA.ConnectionList();
+    cPopulationCell::connection_list_type& cellB_list = cellB.ConnectionList();
     cellA_list.Remove(&cellB);
     cellB_list.Remove(&cellA);
   }
@@ -26,6 +26,8 @@
 #include "cArgContainer.h"
 #include "cArgSchema.h"
 #include "cClassificationManager.h"
+#include "cDataFileManager.h"
+#include "cEventList.h"
 #include "cPopulation.h"
 #include "cStats.h"
 #include "cStringUtil.h"
@@ -162,9 +164,42 @@ public:
   }
 };
 
+/*
+ Writes all pending events to a preparsed binary event file, which can be used in place of a (large) text event file
+ via EVENT_FILE to skip event list parsing at startup.
+ 
+ Parameters:
+   filename (string) default: events.bin
+     The name of the file to write.
+ */
+class cActionSaveEventList : public cAction
+{
+private:
+  cString m_filename;
+  
+public:
+  cActionSaveEventList(cWorld* world, const cString& args, Feedback& feedback)
+  : cAction(world, args), m_filename("events.bin")
+  {
+    cString largs(args);
+    if (largs.GetSize()) m_filename = largs.PopWord();
+  }
+  
+  static const cString GetDescription() { return "Arguments: [string filename='events.bin']"; }
+  
+  void Process(cAvidaContext& ctx)
+  {
+    cString filename = cStringUtil::Stringf("%s%s", (const char*)m_world->GetDataFileManager().GetTargetDir(), (const char*)m_filename);
+    if (!m_world->GetEventsList()->SaveBinaryEventFile(filename)) {
+      m_world->GetDriver().RaiseException("unable to write binary event list");
+    }
+  }
+};
+
 void RegisterSaveLoadActions(cActionLibrary* action_lib)
 {
   action_lib->Register<cActionLoadPopulation>("LoadPopulation");
   action_lib->Register<cActionSavePopulation>("SavePopulation");
   action_lib->Register<cActionSaveFlameData>("SaveFlameData");
+  action_lib->Register<cActionSaveEventList>("SaveEventList");
 }
@@ -41,6 +41,7 @@
 #include "cCPUTestInfo.h"
 #include "cDataFile.h"
 #include "cEnvironment.h"
+#include "cGenotypeColumns.h"
 #include "cHardwareBase.h"
 #include "cHardwareManager.h"
 #include "cHardwareStatusPrinter.h"
@@ -49,6 +50,7 @@
 #include "cInstSet.h"
 #include "cLandscape.h"
 #include "cModularityAnalysis.h"
+#include "cMutantBatch.h"
 #include "cPhenotype.h"
 #include "cPhenPlastGenotype.h"
 #include "cPlasticPhenotype.h"
@@ -771,15 +773,17 @@ void cAnalyze::LoadFile(cString cur_string)
   Genome default_genome(is.GetHardwareType(), is.GetInstSetName(), Sequence(1));
   int load_count = 0;
   
+  tArray<cString> fields;
+  const cString empty_field;
   for (int line_id = 0; line_id < input_file.GetNumLines(); line_id++) {
-    cString cur_line = input_file.GetLine(line_id);
+    input_file.GetLineFields(line_id, fields);
     
     cAnalyzeGenotype* genotype = new cAnalyzeGenotype(m_world, default_genome);
     
     output_it.Reset();
     tDataEntryCommand<cAnalyzeGenotype>* data_command = NULL;
-    while ((data_command = output_it.Next()) != NULL) {
-      data_command->SetValue(genotype, cur_line.PopWord());
+    for (int col = 0; (data_command = output_it.Next()) != NULL; col++) {
+      data_command->SetValue(genotype, (col < fields.GetSize()) ? fields[col] : empty_field);
     }
     
     // Give this genotype a name.  Base it on the ID if possible.
@@ -860,15 +864,15 @@ void cAnalyze::CommandFilter(cString cur_string)
   }
   
   
-  // Loop through the genotypes and remove the entries that don't match.
+  // Compare the whole stat column at once, then remove the entries that don't match.
+  cGenotypeColumns columns(batch[cur_batch]);
+  tArray<int> compare;
+  columns.Compare(columns.AddColumn(*stat_command), cFlexVar(test_value), compare);
+  
   tListIterator<cAnalyzeGenotype> batch_it(batch[cur_batch].List());
-  cAnalyzeGenotype * cur_genotype = NULL;
-  while ((cur_genotype = batch_it.Next()) != NULL) {
-    const cFlexVar value = stat_command->GetValue(cur_genotype);
-    int compare = 1 + CompareFlexStat(value, test_value);
-    
+  for (int row = 0; batch_it.Next() != NULL; row++) {
     // Check if we should eliminate this genotype...
-    if (rel_ok[compare] == false) {
+    if (rel_ok[1 + compare[row]] == false) {
       delete batch_it.Remove();
     }
   }
@@ -2349,6 +2353,7 @@ void cAnalyze::CommandHistogram_Body(ostream& fp, int format_type,
   output_it.Reset();
   tDataEntryCommand<cAnalyzeGenotype> * data_command = NULL;
   cAnalyzeGenotype* first_genotype = batch[cur_batch].List().GetFirst();
+  cGenotypeColumns columns(batch[cur_batch]);
   
   while ((data_command = output_it.Next()) != NULL) {
     if (format_type == FILE_TYPE_TEXT) {
@@ -2361,16 +2366,11 @@ void cAnalyze::CommandHistogram_Body(ostream& fp, int format_type,
     
     tDictionary<int> count_dict;
     
-    // Loop through all genotypes in this batch to collect the info we need.
-    tListIterator<cAnalyzeGenotype> batch_it(batch[cur_batch].List());
-    cAnalyzeGenotype * cur_genotype;
-    while ((cur_genotype = batch_it.Next()) != NULL) {
-      const cString cur_name(data_command->GetValue(cur_genotype).AsString());
-      int count = 0;
-      count_dict.Find(cur_name, count);
-      count += cur_genotype->GetNumCPUs();
-      count_dict.Set(cur_name, count);
-    }
+    // Collect the stat for every genotype in this batch, and total up the organisms with each value.
+    tArray<cString> value_names;
+    tArray<int> value_counts;
+    columns.Tally(columns.AddColumn(*data_command), columns.GetNumCPUs(), value_names, value_counts);
+    for (int i = 0; i < value_names.GetSize(); i++) count_dict.Set(value_names[i], value_counts[i]);
     
     tList<cString> name_list;
     tList<int> count_list;
@@ -4346,26 +4346,21 @@ void cAnalyze::AnalyzeKnockouts(cString cur_string)
     
     const int max_line = genotype->GetLength();
     const Genome& base_genome = genotype->GetGenome();
-    const Sequence& base_seq = base_genome.GetSequence();
-    Genome mod_genome(base_genome);
-    Sequence& seq = mod_genome.GetSequence();
     cInstruction null_inst = m_world->GetHardwareManager().GetInstSet(base_genome.GetInstSet()).ActivateNullInst();
     
-    // Loop through all the lines of code, testing the removal of each.
+    // Test the removal of each line of code, all at once on the job queue.
     // -2=lethal, -1=detrimental, 0=neutral, 1=beneficial
+    cMutantBatch knockouts(m_world, base_genome);
+    for (int line_num = 0; line_num < max_line; line_num++) knockouts.Add(line_num, null_inst);
+    knockouts.Run(m_jobqueue);
+    
     int dead_count = 0;
     int neg_count = 0;
     int neut_count = 0;
     int pos_count = 0;
     tArray<int> ko_effect(max_line);
     for (int line_num = 0; line_num < max_line; line_num++) {
-      // Save a copy of the current instruction and replace it with "NULL"
-      int cur_inst = base_seq[line_num].GetOp();
-      seq[line_num] = null_inst;
-      cAnalyzeGenotype ko_genotype(m_world, mod_genome);
-      ko_genotype.Recalculate(m_ctx);
-      
-      double ko_fitness = ko_genotype.GetFitness();
+      double ko_fitness = knockouts.GetFitness(line_num);
       if (ko_fitness == 0.0) {
         dead_count++;
         ko_effect[line_num] = -2;
@@ -4381,23 +4376,26 @@ void cAnalyze::AnalyzeKnockouts(cString cur_string)
       } else {
         cerr << "ERROR: illegal state in AnalyzeKnockouts()" << endl;
       }
-      
-      // Reset the mod_genome back to the original sequence.
-      seq[line_num].SetOp(cur_inst);
     }
     
     tArray<int> ko_pair_effect(ko_effect);
     if (max_knockouts > 1) {
+      // A pair can only change the classification of its lines when both are harmful (lethal or detrimental) or both
+      // are not, so pairs mixing the two -- say a lethal knockout with a neutral one -- are not tested at all.
+      cMutantBatch pairs(m_world, base_genome);
       for (int line1 = 0; line1 < max_line; line1++) {
       	for (int line2 = line1+1; line2 < max_line; line2++) {
-          int cur_inst1 = base_seq[line1].GetOp();
-          int cur_inst2 = base_seq[line2].GetOp();
-          seq[line1] = null_inst;
-          seq[line2] = null_inst;
-          cAnalyzeGenotype ko_genotype(m_world, mod_genome);
-          ko_genotype.Recalculate(m_ctx);
-          
-          double ko_fitness = ko_genotype.GetFitness();
+          if ((ko_effect[line1] < 0) != (ko_effect[line2] < 0)) continue;
+          pairs.Add(line1, null_inst, line2, null_inst);
+        }
+      }
+      pairs.Run(m_jobqueue);
+      
+      int pair = 0;
+      for (int line1 = 0; line1 < max_line; line1++) {
+      	for (int line2 = line1+1; line2 < max_line; line2++) {
+          if ((ko_effect[line1] < 0) != (ko_effect[line2] < 0)) continue;
+          double ko_fitness = pairs.GetFitness(pair++);
           
           // If both individual knockouts are both harmful, but in combination
           // they are neutral or even beneficial, they should not count as 
@@ -4416,10 +4414,6 @@ void cAnalyze::AnalyzeKnockouts(cString cur_string)
             ko_pair_effect[line1] = -1;
             ko_pair_effect[line2] = -1;
           }	
-          
-          // Reset the mod_genome back to the original sequence.
-          seq[line1].SetOp(cur_inst1);
-          seq[line2].SetOp(cur_inst2);
         }
       }
     }    
@@ -7287,13 +7281,23 @@ void cAnalyze::AnalyzeFitnessLandscapeTwoSites(cString cur_string)
     genotype->Recalculate(m_ctx, &test_info);
     const int max_line = genotype->GetLength();
     const Genome& base_genome = genotype->GetGenome();
-    const Sequence& base_seq = base_genome.GetSequence();
-    Genome mod_genome(base_genome);
-    Sequence& seq = mod_genome.GetSequence();
     const int num_insts = m_world->GetHardwareManager().GetInstSet(base_genome.GetInstSet()).GetSize();
 
-    // run throught sites in genome
+    // run throught sites in genome, testing every site pair with the same
+    // first site together on the job queue
+    cMutantBatch mutants(m_world, base_genome);
     for (int site1 = 0; site1 < max_line; site1++) {
+      mutants.Clear();
+      for (int site2 = site1+1; site2 < max_line; site2++) {
+        for (int mod_inst1 = 0; mod_inst1 < num_insts; mod_inst1++) {
+          for (int mod_inst2 = 0; mod_inst2 < num_insts; mod_inst2++) {
+            mutants.Add(site1, cInstruction(mod_inst1), site2, cInstruction(mod_inst2));
+          }
+        }
+      }
+      mutants.Run(m_jobqueue);
+      
+      int mutant = 0;
       for (int site2 = site1+1; site2 < max_line; site2++) {
         
         // Construct filename for this site combination
@@ -7306,33 +7310,16 @@ void cAnalyze::AnalyzeFitnessLandscapeTwoSites(cString cur_string)
         fit_land_fp.WriteComment( "Columns #- instruction, site 2" );
         fit_land_fp.WriteTimeStamp();
 
-        // get current instructions at site 1 and site 2
-        int curr_inst1 = base_seq[site1].GetOp();
-        int curr_inst2 = base_seq[site2].GetOp();
-      
-        // get current fitness
-        //double curr_fitness = genotype->GetFitness();
-        
-        // run through all possible instruction combinations
-        // at two sites
+        // all possible instruction combinations at two sites
         for (int mod_inst1 = 0; mod_inst1 < num_insts; mod_inst1++) {
           for (int mod_inst2 = 0; mod_inst2 < num_insts; mod_inst2++) {
-            // modify mod_genome at two sites
-            seq[site1].SetOp(mod_inst1);
-            seq[site2].SetOp(mod_inst2);
-            // analyze mod_genome
-            cAnalyzeGenotype test_genotype(m_world, mod_genome);
-            test_genotype.Recalculate(m_ctx);
-            double mod_fitness = test_genotype.GetFitness();
+            double mod_fitness = mutants.GetFitness(mutant++);
              
             // write to file
             fit_land_fp.Write(mod_fitness, cStringUtil::Stringf("Instruction, site 2: %d ", mod_inst2));
           }
           fit_land_fp.Endl();
         }   
-        // Reset the mod_genome back to the original sequence.
-        seq[site1].SetOp(curr_inst1);
-        seq[site2].SetOp(curr_inst2);
         
         // close file
         m_world->GetDataFileManager().Remove(fl_filename);
@@ -7651,9 +7638,6 @@ void cAnalyze::AnalyzeComplexityTwoSites(cString cur_string)
     cout << "  - Convergence accuracy: " << converg_accuracy << endl;
   }
 
-  // test cpu
-  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(m_ctx);
-  
   // get current batch
   tListIterator<cAnalyzeGenotype> batch_it(batch[cur_batch].List());
   cAnalyzeGenotype * genotype = NULL;
@@ -7702,8 +7686,6 @@ void cAnalyze::AnalyzeComplexityTwoSites(cString cur_string)
     const int max_line = genotype->GetLength();
     const Genome& base_genome = genotype->GetGenome();
     const Sequence& base_seq = base_genome.GetSequence();
-    Genome mod_genome(base_genome);
-    Sequence& seq = mod_genome.GetSequence();
     const int num_insts = m_world->GetHardwareManager().GetInstSet(base_genome.GetInstSet()).GetSize();
     
     /*
@@ -7711,6 +7693,29 @@ void cAnalyze::AnalyzeComplexityTwoSites(cString cur_string)
      *  ONE SITE CALCULATIONS
      * 
      */
+    
+    // recalculate every single site mutant on the job queue; the base
+    // genome (each site's current instruction) only needs to be run once.
+    // The results are kept, since the two site landscapes contain them
+    // too, wherever one of the two sites holds its current instruction.
+    cMutantBatch mutants(m_world, base_genome);
+    const int base_mutant = mutants.Add(0, base_seq[0]);
+    for (int line_num = 0; line_num < max_line; line_num++) {
+      for (int mod_inst = 0; mod_inst < num_insts; mod_inst++) {
+        if (mod_inst != base_seq[line_num].GetOp()) mutants.Add(line_num, cInstruction(mod_inst));
+      }
+    }
+    mutants.Run(m_jobqueue);
+    
+    const double base_genome_fitness = mutants.GetFitness(base_mutant);
+    tMatrix<double> fitness_ss(max_line, num_insts);
+    int mutant = base_mutant + 1;
+    for (int line_num = 0; line_num < max_line; line_num++) {
+      for (int mod_inst = 0; mod_inst < num_insts; mod_inst++) {
+        if (mod_inst == base_seq[line_num].GetOp()) fitness_ss[line_num][mod_inst] = base_genome_fitness;
+        else fitness_ss[line_num][mod_inst] = mutants.GetFitness(mutant++);
+      }
+    }
      
     // single site entropies for use with
     // two site calculations (below)
@@ -7726,12 +7731,9 @@ void cAnalyze::AnalyzeComplexityTwoSites(cString cur_string)
       // get the current instruction at this line/site
       int cur_inst = base_seq[line_num].GetOp();
       
-      // recalculate fitness of each mutant.
+      // fitness of each mutant.
       for (int mod_inst = 0; mod_inst < num_insts; mod_inst++) {
-        seq[line_num].SetOp(mod_inst);
-        cAnalyzeGenotype test_genotype(m_world, mod_genome);
-        test_genotype.Recalculate(m_ctx);
-        test_fitness[mod_inst] = test_genotype.GetFitness();
+        test_fitness[mod_inst] = fitness_ss[line_num][mod_inst];
       }
       
       // Adjust fitness
@@ -7822,9 +7824,6 @@ void cAnalyze::AnalyzeComplexityTwoSites(cString cur_string)
       // save entropy for this line/site number
       entropy_ss_mers[line_num] = entropy_mers;
       entropy_ss_bits[line_num] = entropy_bits;
-      
-      // Reset the mod_genome back to the original sequence.
-      seq[line_num].SetOp(cur_inst);
     }
     
     /*
@@ -7845,6 +7844,23 @@ void cAnalyze::AnalyzeComplexityTwoSites(cString cur_string)
     // - only consider lin_num2 > lin_num1 so that we don't consider
     // Mut Info [1][45] and Mut Info [45][1]
     for (int line_num1 = 0; line_num1 < max_line; line_num1++) {
+      // recalculate the two site mutants for every pair starting at this
+      // line together, leaving out those already run as single site mutants
+      mutants.Clear();
+      if (genotype->GetFitness() > 0.0) {
+        for (int line_num2 = line_num1+1; line_num2 < max_line; line_num2++) {
+          for (int mod_inst1 = 0; mod_inst1 < num_insts; mod_inst1++) {
+            if (mod_inst1 == base_seq[line_num1].GetOp()) continue;
+            for (int mod_inst2 = 0; mod_inst2 < num_insts; mod_inst2++) {
+              if (mod_inst2 == base_seq[line_num2].GetOp()) continue;
+              mutants.Add(line_num1, cInstruction(mod_inst1), line_num2, cInstruction(mod_inst2));
+            }
+          }
+        }
+        mutants.Run(m_jobqueue);
+      }
+      mutant = 0;
+      
       for (int line_num2 = line_num1+1; line_num2 < max_line; line_num2++) {
         // debug
         //cout << "line #1, #2: " << line_num1 << ", " << line_num2 << endl; 
@@ -7865,13 +7881,10 @@ void cAnalyze::AnalyzeComplexityTwoSites(cString cur_string)
           // run through all possible instructions
           for (int mod_inst1 = 0; mod_inst1 < num_insts; mod_inst1++) {
             for (int mod_inst2 = 0; mod_inst2 < num_insts; mod_inst2++) {
-              // modify mod_genome at two sites
-              seq[line_num1].SetOp(mod_inst1);
-              seq[line_num2].SetOp(mod_inst2);
-              // analyze mod_genome
-              cAnalyzeGenotype test_genotype(m_world, mod_genome);
-              test_genotype.Recalculate(m_ctx);
-              test_fitness_2s[mod_inst1][mod_inst2] = test_genotype.GetFitness();
+              // fitness of the mutant at the two sites
+              if (mod_inst1 == cur_inst1) test_fitness_2s[mod_inst1][mod_inst2] = fitness_ss[line_num2][mod_inst2];
+              else if (mod_inst2 == cur_inst2) test_fitness_2s[mod_inst1][mod_inst2] = fitness_ss[line_num1][mod_inst1];
+              else test_fitness_2s[mod_inst1][mod_inst2] = mutants.GetFitness(mutant++);
               
               // if modified fitness is greater than current fitness
               //  - set equal to current fitness
@@ -8048,10 +8061,6 @@ void cAnalyze::AnalyzeComplexityTwoSites(cString cur_string)
         fp_2s.Write(entropy_ds_mers,              "Joint Entropy (MERS), Site 1 & 2 -- TWO site mut-sel balance");
         fp_2s.Write(mutual_information_mers,      "Mutual Information (MERS), Site 1 & 2 -- TWO site mut-sel balance");
         fp_2s.Endl();
-                    
-        // Reset the mod_genome back to the original sequence.
-        seq[line_num1].SetOp(cur_inst1);
-        seq[line_num2].SetOp(cur_inst2);
         
       }// end line 2
     }// end line 1
@@ -8089,8 +8098,6 @@ void cAnalyze::AnalyzeComplexityTwoSites(cString cur_string)
   }
   
   m_world->GetDataFileManager().Remove(summary_filename);
-  
-  delete testcpu;
 }
 
 void cAnalyze::AnalyzePopComplexity(cString cur_string)
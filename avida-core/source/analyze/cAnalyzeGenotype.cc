@@ -24,16 +24,20 @@
 
 #include "avida/core/WorldDriver.h"
 
+#include "cAnalyze.h"
+#include "cAnalyzeJobQueue.h"
 #include "cAvidaContext.h"
 #include "cCPUTestInfo.h"
 #include "cHardwareBase.h"
 #include "cHardwareManager.h"
 #include "cInstSet.h"
+#include "cMutantBatch.h"
 #include "cOrganism.h"
 #include "cPhenotype.h"
 #include "cPhenPlastGenotype.h"
 #include "cPlasticPhenotype.h"
 #include "cTestCPU.h"
+#include "cTestResultCache.h"
 #include "cEnvironment.h"
 #include "cHardwareManager.h"
 #include "cWorld.h"
@@ -380,8 +384,7 @@ void cAnalyzeGenotype::CalcKnockouts(bool check_pairs, bool check_chart) const
   }
   
   cAvidaContext& ctx = m_world->GetDefaultContext();
-  
-  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+  cAnalyzeJobQueue& jobqueue = m_world->GetAnalyze().GetJobQueue();
   
   // Calculate the base fitness for the genotype we're working with...
   // (This may not have been run already, and cost negligiably more time
@@ -394,14 +397,11 @@ void cAnalyzeGenotype::CalcKnockouts(bool check_pairs, bool check_chart) const
   // If the base fitness is 0, the organism is dead and has no complexity.
   if (base_fitness == 0.0) {
     knockout_stats->neut_count = length;
-    delete testcpu;
     return;
   }
   
-  Genome mod_genome(m_genome);
-  
   // Setup a NULL instruction needed for testing
-  const cInstruction null_inst = m_world->GetHardwareManager().GetInstSet(mod_genome.GetInstSet()).ActivateNullInst();
+  const cInstruction null_inst = m_world->GetHardwareManager().GetInstSet(m_genome.GetInstSet()).ActivateNullInst();
   
   // If we are keeping track of the specific effects on tasks from the
   // knockouts, setup the matrix.
@@ -410,21 +410,19 @@ void cAnalyzeGenotype::CalcKnockouts(bool check_pairs, bool check_chart) const
     knockout_stats->has_chart_info = true;
   }
   
-  // Loop through all the lines of code, testing the removal of each.
+  // Test the removal of each line of code, all at once on the job queue.
   // -2=lethal, -1=detrimental, 0=neutral, 1=beneficial
+  cMutantBatch knockouts(m_world, m_genome, check_chart);
+  for (int line_num = 0; line_num < length; line_num++) knockouts.Add(line_num, null_inst);
+  knockouts.Run(jobqueue);
+  
   tArray<int> ko_effect(length);
   for (int line_num = 0; line_num < length; line_num++) {
-    // Save a copy of the current instruction and replace it with "NULL"
-    int cur_inst = mod_genome.GetSequence()[line_num].GetOp();
-    mod_genome.GetSequence()[line_num] = null_inst;
-    cAnalyzeGenotype ko_genotype(m_world, mod_genome);
-    ko_genotype.Recalculate(ctx);
     if (check_chart == true) {
-      const tArray<int> ko_task_counts( ko_genotype.GetTaskCounts() );
-      knockout_stats->task_counts[line_num] = ko_task_counts;
+      knockout_stats->task_counts[line_num] = knockouts.GetTaskCounts(line_num);
     }
     
-    double ko_fitness = ko_genotype.GetFitness();
+    double ko_fitness = knockouts.GetFitness(line_num);
     if (ko_fitness == 0.0) {
       knockout_stats->dead_count++;
       ko_effect[line_num] = -2;
@@ -440,24 +438,24 @@ void cAnalyzeGenotype::CalcKnockouts(bool check_pairs, bool check_chart) const
     } else {
       m_world->GetDriver().RaiseException("internal: illegal state in CalcKnockouts()");
     }
-    
-    // Reset the mod_genome back to the original sequence.
-    mod_genome.GetSequence()[line_num].SetOp(cur_inst);
   }
   
   // Only continue from here if we are looking at all pairs of knockouts
   // as well.
-  if (check_pairs == false) {
-    delete testcpu;
-    return;
-  }
+  if (check_pairs == false) return;
   
+  // Pairs are tested a row (all pairs with the same first line) at a time.  Only a pair's two lines change as it is
+  // tested, so the lines a row would skip are all known before the row starts, and its pairs can run together.
   tArray<int> ko_pair_effect(ko_effect);
+  cMutantBatch pairs(m_world, m_genome);
+  tArray<int> row_lines;
   for (int line1 = 0; line1 < length; line1++) {
     // If this line has already been changed, keep going...
     if (ko_effect[line1] != ko_pair_effect[line1]) continue;
     
     // Loop through all possibilities for the next line.
+    pairs.Clear();
+    row_lines.Resize(0);
     for (int line2 = line1+1; line2 < length; line2++) {
       // If this line has already been changed, keep going...
       if (ko_effect[line2] != ko_pair_effect[line2]) continue;
@@ -470,17 +468,17 @@ void cAnalyzeGenotype::CalcKnockouts(bool check_pairs, bool check_chart) const
         continue;
       }
       
+      pairs.Add(line1, null_inst, line2, null_inst);
+      row_lines.Push(line2);
+    }
+    pairs.Run(jobqueue);
+    
+    for (int i = 0; i < row_lines.GetSize(); i++) {
+      const int line2 = row_lines[i];
+      
       // Calculate the fitness for this pair of knockouts to determine if its
       // something other than what we expected.
-      
-      int cur_inst1 = mod_genome.GetSequence()[line1].GetOp();
-      int cur_inst2 = mod_genome.GetSequence()[line2].GetOp();
-      mod_genome.GetSequence()[line1] = null_inst;
-      mod_genome.GetSequence()[line2] = null_inst;
-      cAnalyzeGenotype ko_genotype(m_world, mod_genome);
-      ko_genotype.Recalculate(ctx);
-      
-      double ko_fitness = ko_genotype.GetFitness();
+      double ko_fitness = pairs.GetFitness(i);
       
       // If the individual knockouts are both harmful, but in combination
       // they are neutral or even beneficial, they should not count as 
@@ -499,10 +497,6 @@ void cAnalyzeGenotype::CalcKnockouts(bool check_pairs, bool check_chart) const
         ko_pair_effect[line1] = -1;
         ko_pair_effect[line2] = -1;
       }	
-      
-      // Reset the mod_genome back to the original sequence.
-      mod_genome.GetSequence()[line1].SetOp(cur_inst1);
-      mod_genome.GetSequence()[line2].SetOp(cur_inst2);
     }
   }
   
@@ -514,7 +508,6 @@ void cAnalyzeGenotype::CalcKnockouts(bool check_pairs, bool check_chart) const
   }
   
   knockout_stats->has_pair_info = true;
-  delete testcpu;
 }
 
 void cAnalyzeGenotype::CheckLand() const
@@ -559,6 +552,19 @@ void cAnalyzeGenotype::Recalculate(cAvidaContext& ctx, cCPUTestInfo* test_info,
     local_test_info.Set(test_info);
   }
   
+  // A single trial of a repeatable test may already have been run, by this session or an earlier one
+  cTestResultCache* cache = m_world->GetTestResultCache();
+  cString cache_key;
+  if (cache && num_trials == 1 && cTestResultCache::BuildKey("recalc", m_genome, *test_info, cache_key)) {
+    cTestResultCache::cRecord record;
+    if (cache->Find(cache_key, record) && loadTestResults(record)) {
+      recalculateParentStats(parent_genotype);
+      return;
+    }
+  } else {
+    cache_key = "";
+  }
+  
   // Handling recalculation here
   cPhenPlastGenotype recalc_data(m_genome, num_trials, *test_info, m_world, ctx);
   
@@ -590,7 +596,24 @@ void cAnalyzeGenotype::Recalculate(cAvidaContext& ctx, cCPUTestInfo* test_info,
   m_mating_display_a    = likely_phenotype->GetCurMatingDisplayA();
   m_mating_display_b    = likely_phenotype->GetCurMatingDisplayB();
 
+  if (cache_key.GetSize()) {
+    cTestResultCache::cRecord record;
+    saveTestResults(record);
+    cache->Add(cache_key, record);
+  }
   
+  recalculateParentStats(parent_genotype);
+  
+  // Summarize plasticity information if multiple recalculations performed
+  if (num_trials > 1){
+    if (m_phenplast_stats != NULL)
+      delete m_phenplast_stats;
+    m_phenplast_stats = new cPhenPlastSummary(recalc_data);
+  }
+}
+
+void cAnalyzeGenotype::recalculateParentStats(cAnalyzeGenotype* parent_genotype)
+{
   // Setup a new parent stats if we have a parent to work with.
   if (parent_genotype != NULL) {
     fitness_ratio = GetFitness() / parent_genotype->GetFitness();
@@ -600,13 +623,50 @@ void cAnalyzeGenotype::Recalculate(cAvidaContext& ctx, cCPUTestInfo* test_info,
     
     ancestor_dist = parent_genotype->GetAncestorDist() + parent_dist;
   }
-  
-  // Summarize plasticity information if multiple recalculations performed
-  if (num_trials > 1){
-    if (m_phenplast_stats != NULL)
-      delete m_phenplast_stats;
-    m_phenplast_stats = new cPhenPlastSummary(recalc_data);
-  }
+}
+
+
+// The test results set by Recalculate, in the order they are kept in the test result cache
+void cAnalyzeGenotype::saveTestResults(cTestResultCache::cRecord& record) const
+{
+  record.Write(viable ? 1 : 0);
+  record.Write(m_env_inputs);
+  record.Write(executed_flags);
+  record.Write(inst_executed_counts);
+  record.Write(length);
+  record.Write(copy_length);
+  record.Write(exe_length);
+  record.Write(merit);
+  record.Write(gest_time);
+  record.Write(fitness);
+  record.Write(errors);
+  record.Write(div_type);
+  record.Write(mate_id);
+  record.Write(task_counts);
+  record.Write(task_qualities);
+  record.Write(internal_task_counts);
+  record.Write(internal_task_qualities);
+  record.Write(rbins_total);
+  record.Write(rbins_avail);
+  record.Write(collect_spec_counts);
+  record.Write(m_mating_type);
+  record.Write(m_mate_preference);
+  record.Write(m_mating_display_a);
+  record.Write(m_mating_display_b);
+}
+
+bool cAnalyzeGenotype::loadTestResults(cTestResultCache::cRecord& record)
+{
+  int is_viable;
+  const bool ok = record.Read(is_viable) && record.Read(m_env_inputs) && record.Read(executed_flags) &&
+    record.Read(inst_executed_counts) && record.Read(length) && record.Read(copy_length) && record.Read(exe_length) &&
+    record.Read(merit) && record.Read(gest_time) && record.Read(fitness) && record.Read(errors) &&
+    record.Read(div_type) && record.Read(mate_id) && record.Read(task_counts) && record.Read(task_qualities) &&
+    record.Read(internal_task_counts) && record.Read(internal_task_qualities) && record.Read(rbins_total) &&
+    record.Read(rbins_avail) && record.Read(collect_spec_counts) && record.Read(m_mating_type) &&
+    record.Read(m_mate_preference) && record.Read(m_mating_display_a) && record.Read(m_mating_display_b);
+  viable = (is_viable != 0);
+  return ok;
 }
 
 
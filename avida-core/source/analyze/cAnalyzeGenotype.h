@@ -52,6 +52,9 @@
 #ifndef cStringUtil_h
 #include "cStringUtil.h"
 #endif
+#ifndef cTestResultCache_h
+#include "cTestResultCache.h"
+#endif
 #ifndef tArray_h
 #include "tArray.h"
 #endif
@@ -237,6 +240,10 @@ private:
   void CheckPhenPlast() const;
   void SummarizePhenotypicPlasticity(const cPhenPlastGenotype& pp) const;
   
+  void recalculateParentStats(cAnalyzeGenotype* parent_genotype);
+  void saveTestResults(cTestResultCache::cRecord& record) const;
+  bool loadTestResults(cTestResultCache::cRecord& record);
+  
   static tDataCommandManager<cAnalyzeGenotype>* buildDataCommandManager();
 
 
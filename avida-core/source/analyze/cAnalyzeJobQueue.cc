@@ -80,28 +80,32 @@ cAnalyzeJobQueue::~cAnalyzeJobQueue()
   }
 }
 
-inline void cAnalyzeJobQueue::queueJob(cAnalyzeJob* job)
+// Without worker threads the job is run as soon as it is added, and so never counts as waiting; it is run after the
+// queue lock is released, since the job may itself add jobs.
+inline bool cAnalyzeJobQueue::queueJob(cAnalyzeJob* job)
 {
-  if (m_workers.GetSize()) m_queue.PushRear(job);
-  else singleThreadedJobExecution(job);
+  job->SetID(m_last_jobid++);
+  if (!m_workers.GetSize()) return false;
+  m_queue.PushRear(job);
+  m_jobs++;
+  return true;
 }
 
 void cAnalyzeJobQueue::AddJob(cAnalyzeJob* job)
 {
-  Apto::MutexAutoLock lock(m_mutex);
-  job->SetID(m_last_jobid++);
-  queueJob(job);
-  m_jobs++;
+  m_mutex.Lock();
+  const bool queued = queueJob(job);
+  m_mutex.Unlock();
+  if (!queued) singleThreadedJobExecution(job);
 }
 
 void cAnalyzeJobQueue::AddJobImmediate(cAnalyzeJob* job)
 {
   m_mutex.Lock();
-  job->SetID(m_last_jobid++);
-  queueJob(job);
-  m_jobs++;
+  const bool queued = queueJob(job);
   m_mutex.Unlock(); // should unlock prior to signaling condition variable
-  m_cond.Signal();
+  if (queued) m_cond.Signal();
+  else singleThreadedJobExecution(job);
 }
 
 
@@ -70,7 +70,7 @@ private:
 
 
   void singleThreadedJobExecution(cAnalyzeJob* job);
-  inline void queueJob(cAnalyzeJob* job);
+  inline bool queueJob(cAnalyzeJob* job);
 
   
   cAnalyzeJobQueue(); // @not_implemented
@@ -88,6 +88,8 @@ public:
   void Start();
   void Execute();
   
+  int GetNumWorkers() const { return m_workers.GetSize(); }  // 0 when jobs are run as they are added
+  
   cRandom* GetRandom(int jobid) { return m_rng_pool[jobid & MT_RANDOM_INDEX_MASK]; } 
 };
 
@@ -0,0 +1,188 @@
+/*
+ *  cGenotypeColumns.cc
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cGenotypeColumns.h"
+
+#include "cAnalyzeGenotype.h"
+#include "cGenotypeBatch.h"
+#include "tDictionary.h"
+#include "tSmartArray.h"
+
+#include <cassert>
+#include <cstring>
+#include <map>
+
+
+namespace {
+  // Orders doubles by bit pattern, so every distinct value (NaNs and signed zeros included) gets its own entry
+  struct DoubleBitsLess {
+    bool operator()(double a, double b) const { return std::memcmp(&a, &b, sizeof(double)) < 0; }
+  };
+}
+
+
+cGenotypeColumns::cGenotypeColumns(cGenotypeBatch& batch)
+  : m_rows(batch.GetSize()), m_num_cpus(batch.GetSize())
+{
+  tListIterator<cAnalyzeGenotype> batch_it(batch.List());
+  cAnalyzeGenotype* genotype = NULL;
+  for (int row = 0; (genotype = batch_it.Next()) != NULL; row++) {
+    m_rows[row] = genotype;
+    m_num_cpus[row] = genotype->GetNumCPUs();
+  }
+}
+
+cGenotypeColumns::~cGenotypeColumns()
+{
+  for (int i = 0; i < m_columns.GetSize(); i++) delete m_columns[i];
+}
+
+
+int cGenotypeColumns::AddColumn(const tDataEntryCommand<cAnalyzeGenotype>& command)
+{
+  const int num_rows = m_rows.GetSize();
+  Column* column = new Column;
+  column->type = cFlexVar::TYPE_NONE;
+  column->numeric = true;
+  column->numbers.Resize(num_rows);
+
+  // Stats stored as plain numbers are copied straight into the column, without a cFlexVar for each row
+  if (num_rows && command.GetNumbers(m_rows.begin(), num_rows, column->numbers.begin(), column->type)) {
+    const int col = m_columns.GetSize();
+    m_columns.Resize(col + 1);
+    m_columns[col] = column;
+    return col;
+  }
+
+  for (int row = 0; row < num_rows; row++) {
+    const cFlexVar value = command.GetValue(m_rows[row]);
+    const cFlexVar::eFlexType type = value.GetType();
+    if (column->numeric) {
+      if (row == 0) column->type = type;
+      if (type == column->type && (type == cFlexVar::TYPE_INT || type == cFlexVar::TYPE_DOUBLE)) {
+        column->numbers[row] = value.AsDouble();
+        continue;
+      }
+
+      // Not a numeric column after all; convert what has been collected so far
+      column->numeric = false;
+      column->values.Resize(num_rows);
+      for (int i = 0; i < row; i++) {
+        if (column->type == cFlexVar::TYPE_INT) column->values[i] = (int)column->numbers[i];
+        else column->values[i] = column->numbers[i];
+      }
+      column->numbers.Resize(0);
+    }
+    column->values[row] = value;
+  }
+
+  const int col = m_columns.GetSize();
+  m_columns.Resize(col + 1);
+  m_columns[col] = column;
+  return col;
+}
+
+cFlexVar cGenotypeColumns::GetValue(int col, int row) const
+{
+  const Column& column = *m_columns[col];
+  if (!column.numeric) return column.values[row];
+  if (column.type == cFlexVar::TYPE_INT) return cFlexVar((int)column.numbers[row]);
+  return cFlexVar(column.numbers[row]);
+}
+
+
+void cGenotypeColumns::Compare(int col, const cFlexVar& value, tArray<int>& result) const
+{
+  const Column& column = *m_columns[col];
+  const int num_rows = m_rows.GetSize();
+  result.Resize(num_rows);
+
+  if (column.numeric) {
+    // Numeric stats compare against the numeric form of the value, whatever its type
+    const double test = value.AsDouble();
+    const double* numbers = column.numbers.begin();
+    int* out = result.begin();
+    for (int row = 0; row < num_rows; row++) {
+      const double x = numbers[row];
+      out[row] = (x == test) ? 0 : ((x > test) ? 1 : -1);
+    }
+  } else {
+    for (int row = 0; row < num_rows; row++) {
+      const cFlexVar& x = column.values[row];
+      result[row] = (x == value) ? 0 : ((x > value) ? 1 : -1);
+    }
+  }
+}
+
+
+void cGenotypeColumns::Tally(int col, const tArray<int>& weights, tArray<cString>& names, tArray<int>& totals) const
+{
+  const Column& column = *m_columns[col];
+  const int num_rows = m_rows.GetSize();
+  assert(weights.GetSize() == num_rows);
+
+  // Group rows with the same value first, so each distinct value is converted to a string only once
+  tSmartArray<cFlexVar> distinct_values;
+  tSmartArray<int> distinct_totals;
+  if (column.numeric) {
+    std::map<double, int, DoubleBitsLess> index;
+    for (int row = 0; row < num_rows; row++) {
+      const double x = column.numbers[row];
+      std::map<double, int, DoubleBitsLess>::iterator it = index.find(x);
+      if (it == index.end()) {
+        index[x] = distinct_totals.GetSize();
+        distinct_values.Push(GetValue(col, row));
+        distinct_totals.Push(weights[row]);
+      } else {
+        distinct_totals[it->second] += weights[row];
+      }
+    }
+  } else {
+    distinct_values.Resize(num_rows);
+    distinct_totals.Resize(num_rows);
+    for (int row = 0; row < num_rows; row++) {
+      distinct_values[row] = column.values[row];
+      distinct_totals[row] = weights[row];
+    }
+  }
+
+  // Merge values that print the same, keeping the order in which they first appeared
+  tDictionary<int> name_index;
+  tSmartArray<cString> out_names;
+  tSmartArray<int> out_totals;
+  for (int i = 0; i < distinct_values.GetSize(); i++) {
+    const cString name(distinct_values[i].AsString());
+    int idx = -1;
+    if (name_index.Find(name, idx)) {
+      out_totals[idx] += distinct_totals[i];
+    } else {
+      name_index.Set(name, out_names.GetSize());
+      out_names.Push(name);
+      out_totals.Push(distinct_totals[i]);
+    }
+  }
+
+  names.Resize(out_names.GetSize());
+  totals.Resize(out_totals.GetSize());
+  for (int i = 0; i < out_names.GetSize(); i++) {
+    names[i] = out_names[i];
+    totals[i] = out_totals[i];
+  }
+}
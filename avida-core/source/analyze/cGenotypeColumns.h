@@ -0,0 +1,88 @@
+/*
+ *  cGenotypeColumns.h
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cGenotypeColumns_h
+#define cGenotypeColumns_h
+
+#ifndef cFlexVar_h
+#include "cFlexVar.h"
+#endif
+#ifndef tArray_h
+#include "tArray.h"
+#endif
+#ifndef tDataEntryCommand_h
+#include "tDataEntryCommand.h"
+#endif
+
+// cGenotypeColumns    : Column-at-a-time view of the genotypes in a batch
+
+class cAnalyzeGenotype;
+class cGenotypeBatch;
+
+/*! A snapshot of a batch laid out by column rather than by genotype.
+
+ Each stat requested is evaluated for every row in a single pass and stored contiguously: integer and floating
+ point stats as an array of doubles, anything else as an array of cFlexVar.  Stats that a genotype stores as a plain
+ number are read through the entry's accessor straight into the array, with one virtual call for the column rather
+ than one per row; other stats still go through GetValue for each row.  Commands that only need to compare or count
+ the values of a stat (FILTER, HISTOGRAM) then run simple loops over the arrays.  A command builds the columns it
+ needs once for the batch it works on; the rows are in batch list order, and the snapshot is only valid until the
+ batch is next modified.
+ */
+class cGenotypeColumns
+{
+private:
+  struct Column {
+    cFlexVar::eFlexType type;  // TYPE_INT or TYPE_DOUBLE for numeric columns
+    bool numeric;
+    tArray<double> numbers;    // Values of a numeric column
+    tArray<cFlexVar> values;   // Values of any other column
+  };
+
+  tArray<cAnalyzeGenotype*> m_rows;
+  tArray<int> m_num_cpus;
+  tArray<Column*> m_columns;
+
+  cGenotypeColumns(); // @not_implemented
+  cGenotypeColumns(const cGenotypeColumns&); // @not_implemented
+  cGenotypeColumns& operator=(const cGenotypeColumns&); // @not_implemented
+
+public:
+  cGenotypeColumns(cGenotypeBatch& batch);
+  ~cGenotypeColumns();
+
+  int GetNumRows() const { return m_rows.GetSize(); }
+  cAnalyzeGenotype* GetRow(int row) const { return m_rows[row]; }
+  const tArray<int>& GetNumCPUs() const { return m_num_cpus; }
+
+  //! Evaluate the stat for every row and return the index of the new column.
+  int AddColumn(const tDataEntryCommand<cAnalyzeGenotype>& command);
+  int GetNumColumns() const { return m_columns.GetSize(); }
+  bool IsNumeric(int col) const { return m_columns[col]->numeric; }
+  cFlexVar GetValue(int col, int row) const;
+
+  //! Compare every value in a column to a fixed value: -1 if less (or unordered), 0 if equal, 1 if greater.
+  void Compare(int col, const cFlexVar& value, tArray<int>& result) const;
+
+  //! Sum the weight of each row by the string form of its value, in order of first appearance.
+  void Tally(int col, const tArray<int>& weights, tArray<cString>& names, tArray<int>& totals) const;
+};
+
+#endif
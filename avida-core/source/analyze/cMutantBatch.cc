@@ -0,0 +1,130 @@
+/*
+ *  cMutantBatch.cc
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cMutantBatch.h"
+
+#include "cAnalyzeGenotype.h"
+#include "cAnalyzeJobQueue.h"
+#include "cAvidaContext.h"
+#include "tAnalyzeJobBatch.h"
+
+#include <algorithm>
+
+
+// cMutantRange - a slice of the batch recalculated as one job, on a genome of its own
+//
+// The genome (including its instruction set name) is copied outright when the range is set up, since reference counted
+// strings may not be shared between the threads running the jobs.
+class cMutantBatch::cMutantRange
+{
+private:
+  cMutantBatch* m_batch;
+  int m_begin;
+  int m_end;
+  Genome m_genome;
+
+public:
+  cMutantRange(cMutantBatch* batch, int begin, int end)
+    : m_batch(batch), m_begin(begin), m_end(end)
+    , m_genome(batch->m_base_genome.GetHardwareType(), cString(static_cast<const char*>(batch->m_base_genome.GetInstSet())),
+               batch->m_base_genome.GetSequence()) { ; }
+
+  void Process(cAvidaContext& ctx) { m_batch->recalculate(ctx, m_genome, m_begin, m_end); }
+};
+
+
+cMutantBatch::cMutantBatch(cWorld* world, const Genome& base_genome, bool keep_task_counts)
+  : m_world(world), m_base_genome(base_genome), m_keep_task_counts(keep_task_counts), m_num_run(0)
+{
+}
+
+
+int cMutantBatch::Add(int site, const cInstruction& inst)
+{
+  return Add(site, inst, -1, inst);
+}
+
+int cMutantBatch::Add(int site1, const cInstruction& inst1, int site2, const cInstruction& inst2)
+{
+  sMutant mutant;
+  mutant.site1 = site1;
+  mutant.site2 = site2;
+  mutant.inst1 = inst1;
+  mutant.inst2 = inst2;
+  m_mutants.push_back(mutant);
+  return m_mutants.size() - 1;
+}
+
+
+void cMutantBatch::Run(cAnalyzeJobQueue& queue)
+{
+  const int num_mutants = m_mutants.size();
+  const int num_new = num_mutants - m_num_run;
+  if (num_new == 0) return;
+
+  m_fitness.resize(num_mutants, 0.0);
+  if (m_keep_task_counts) m_task_counts.resize(num_mutants);
+
+  // A few ranges per worker keeps them all busy when some mutants take much longer to run than others
+  const int num_ranges = std::min(num_new, std::max(1, queue.GetNumWorkers() * 4));
+  tArray<cMutantRange*> ranges(num_ranges);
+  tAnalyzeJobBatch<cMutantRange> jobbatch(queue);
+  int begin = m_num_run;
+  for (int i = 0; i < num_ranges; i++) {
+    const int end = m_num_run + static_cast<int>(static_cast<long long>(num_new) * (i + 1) / num_ranges);
+    ranges[i] = new cMutantRange(this, begin, end);
+    jobbatch.AddJob(ranges[i], &cMutantRange::Process);
+    begin = end;
+  }
+  jobbatch.RunBatch();
+
+  for (int i = 0; i < num_ranges; i++) delete ranges[i];
+  m_num_run = num_mutants;
+}
+
+
+void cMutantBatch::Clear()
+{
+  m_mutants.clear();
+  m_fitness.clear();
+  m_task_counts.clear();
+  m_num_run = 0;
+}
+
+
+void cMutantBatch::recalculate(cAvidaContext& ctx, Genome& genome, int begin, int end)
+{
+  Sequence& seq = genome.GetSequence();
+  const Sequence& base_seq = static_cast<const Genome&>(m_base_genome).GetSequence();
+
+  for (int i = begin; i < end; i++) {
+    const sMutant& mutant = m_mutants[i];
+    seq[mutant.site1] = mutant.inst1;
+    if (mutant.site2 >= 0) seq[mutant.site2] = mutant.inst2;
+
+    cAnalyzeGenotype genotype(m_world, genome);
+    genotype.Recalculate(ctx);
+    m_fitness[i] = genotype.GetFitness();
+    if (m_keep_task_counts) m_task_counts[i] = genotype.GetTaskCounts();
+
+    seq[mutant.site1] = base_seq[mutant.site1];
+    if (mutant.site2 >= 0) seq[mutant.site2] = base_seq[mutant.site2];
+  }
+}
@@ -0,0 +1,97 @@
+/*
+ *  cMutantBatch.h
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cMutantBatch_h
+#define cMutantBatch_h
+
+#include "avida/core/Genome.h"
+
+#ifndef cInstruction_h
+#include "cInstruction.h"
+#endif
+#ifndef tArray_h
+#include "tArray.h"
+#endif
+
+#include <vector>
+
+// cMutantBatch    : One and two site mutants of a genome, recalculated on the analyze job queue
+
+class cAnalyzeJobQueue;
+class cAvidaContext;
+class cWorld;
+
+using namespace Avida;
+
+
+/*! A list of mutants of one base genome, each differing from it at one or two sites.
+
+ Mutants are added in the order the caller wants their results, and Run() recalculates every mutant added since the
+ last call, split into ranges that run as independent jobs on the analyze job queue.  Each mutant is recalculated
+ just as a cAnalyzeGenotype of the mutant genome would be, so results match those of a serial loop.  Run() must be
+ called from the thread that owns the queue (never from within an analyze job), and blocks until the results are in.
+ */
+class cMutantBatch
+{
+private:
+  class cMutantRange;
+  friend class cMutantRange;
+
+  struct sMutant {
+    int site1;
+    int site2;  // -1 for a single site mutant
+    cInstruction inst1;
+    cInstruction inst2;
+  };
+
+  cWorld* m_world;
+  Genome m_base_genome;
+  bool m_keep_task_counts;
+
+  std::vector<sMutant> m_mutants;
+  std::vector<double> m_fitness;
+  std::vector<tArray<int> > m_task_counts;
+  int m_num_run;
+
+  cMutantBatch(); // @not_implemented
+  cMutantBatch(const cMutantBatch&); // @not_implemented
+  cMutantBatch& operator=(const cMutantBatch&); // @not_implemented
+
+  void recalculate(cAvidaContext& ctx, Genome& genome, int begin, int end);
+
+public:
+  cMutantBatch(cWorld* world, const Genome& base_genome, bool keep_task_counts = false);
+
+  //! Add a mutant, returning its index
+  int Add(int site, const cInstruction& inst);
+  int Add(int site1, const cInstruction& inst1, int site2, const cInstruction& inst2);
+  int GetSize() const { return m_mutants.size(); }
+
+  //! Recalculate the mutants added since the last run
+  void Run(cAnalyzeJobQueue& queue);
+
+  //! Forget all mutants (and their results), keeping the base genome
+  void Clear();
+
+  double GetFitness(int mutant) const { return m_fitness[mutant]; }
+  const tArray<int>& GetTaskCounts(int mutant) const { return m_task_counts[mutant]; }
+};
+
+#endif
@@ -25,10 +25,14 @@
 #include "cAnalyzeJobQueue.h"
 #include "cCPUTestInfo.h"
 #include "cEnvironment.h"
+#include "cHardwareBase.h"
+#include "cHardwareTracer.h"
+#include "cHeadCPU.h"
 #include "cInstSet.h"
 #include "cHardwareManager.h"
 #include "cOrganism.h"
 #include "cPhenotype.h"
+#include "cRandom.h"
 #include "cStats.h"
 #include "cTestCPU.h"
 #include "cWorld.h"
@@ -37,9 +41,46 @@
 using namespace std;
 
 
-cMutationalNeighborhood::cMutationalNeighborhood(cWorld* world, const Genome& genome, int target)
+// cExecutedSiteTracer - collects the sites of the first organism's genome that were executed during a test run
+//
+// Executed flags are cleared when the hardware resets on divide, so they are gathered step by step, along with the
+// instruction about to be executed (which is only flagged after the step's trace).
+class cExecutedSiteTracer : public cHardwareTracer
+{
+private:
+  tArray<bool>& m_executed;
+  const cHardwareBase* m_hardware;
+  bool m_supported;
+
+public:
+  cExecutedSiteTracer(tArray<bool>& executed) : m_executed(executed), m_hardware(NULL), m_supported(true) { ; }
+
+  bool IsSupported() const { return m_supported && m_hardware; }
+
+  void TraceHardware(cAvidaContext&, cHardwareBase& hw, bool, bool, int)
+  {
+    if (!m_hardware) m_hardware = &hw;
+    if (&hw != m_hardware) return;
+
+    // Only hardware that executes straight out of its genome's memory space can be followed
+    const cCPUMemory& memory = hw.GetMemory();
+    if (&hw.IP().GetMemory() != &memory) {
+      m_supported = false;
+      return;
+    }
+
+    const int size = AvidaTools::Min(m_executed.GetSize(), memory.GetSize());
+    for (int i = 0; i < size; i++) if (memory.FlagExecuted(i)) m_executed[i] = true;
+    const int ip = hw.IP().GetPosition();
+    if (ip >= 0 && ip < m_executed.GetSize()) m_executed[ip] = true;
+  }
+  void TraceTestCPU(int, int, const cOrganism&) { ; }
+};
+
+
+cMutationalNeighborhood::cMutationalNeighborhood(cWorld* world, const Genome& genome, int target, bool prune_unexecuted)
   : m_world(world), m_initialized(false), m_inst_set(m_world->GetHardwareManager().GetInstSet(genome.GetInstSet()))
-  , m_target(target), m_base_genome(genome)
+  , m_target(target), m_prune_unexecuted(prune_unexecuted), m_base_genome(genome)
 {
   // Acquire write lock, to prevent any cMutationalNeighborhoodResults instances before computing
   m_rwlock.WriteLock();
@@ -173,6 +214,8 @@ void cMutationalNeighborhood::ProcessInitialize(cAvidaContext& ctx)
   // If invalid target supplied, set to the last task
   if (m_target >= m_base_tasks.GetSize() || m_target < 0) m_target = m_base_tasks.GetSize() - 1;
   
+  if (m_prune_unexecuted) FindExecutedSites(ctx, testcpu, test_info);
+  
   delete testcpu;
 
   // Setup state to begin processing
@@ -209,6 +252,45 @@ void cMutationalNeighborhood::ProcessInitialize(cAvidaContext& ctx)
 }
 
 
+// Point mutations are only pruned where the base genome is known to behave identically with any non-nop instruction at
+// the site: it must breed true on its first gestation, with a fitness and tasks that do not depend on random numbers
+// (checked by re-running it from a different random state), and its merit must not count instructions in the genome.
+// Sites it never executed are then neutral for any swap between non-nop instructions, since label reads, template
+// searches, and copy label matching only ever look at nops.  Instruction sets with instructions that load the identity
+// of other instructions into registers defeat this reasoning, and should not be analyzed with pruning.
+void cMutationalNeighborhood::FindExecutedSites(cAvidaContext& ctx, cTestCPU* testcpu, const cCPUTestInfo& base_info)
+{
+  if (!base_info.IsViable() || base_info.GetDepthFound() != 0 || m_world->GetConfig().BASE_MERIT_METHOD.Get() == 6) return;
+  
+  tArray<bool> executed(m_base_genome.GetSize(), false);
+  cExecutedSiteTracer tracer(executed);
+  cCPUTestInfo test_info;
+  test_info.SetTraceExecution(&tracer);
+  
+  // Run from a random state of its own, leaving the caller's generator untouched
+  cRandom seed_rng(ctx.GetRandom());
+  cRandom alt_rng(seed_rng.GetUInt(1 << 30) + 1);
+  cRandom& rng = ctx.GetRandom();
+  ctx.SetRandom(alt_rng);
+  testcpu->TestGenome(ctx, test_info, m_base_genome);
+  ctx.SetRandom(rng);
+  
+  if (!tracer.IsSupported() || !test_info.IsViable() || test_info.GetDepthFound() != 0) return;
+  if (test_info.GetColonyFitness() != m_base_fitness) return;
+  const tArray<int>& tasks = test_info.GetColonyOrganism()->GetPhenotype().GetLastTaskCount();
+  for (int i = 0; i < m_base_tasks.GetSize(); i++) if (tasks[i] != m_base_tasks[i]) return;
+  
+  m_executed = executed;
+}
+
+
+bool cMutationalNeighborhood::IsNeutralPoint(int site, int inst) const
+{
+  if (!m_executed.GetSize() || m_executed[site]) return false;
+  return !m_inst_set.IsNop(m_base_genome.GetSequence()[site]) && !m_inst_set.IsNop(cInstruction(inst));
+}
+
+
 void cMutationalNeighborhood::ProcessOneStepPoint(cAvidaContext& ctx, cTestCPU* testcpu, cCPUTestInfo& test_info, int cur_site)
 {
   const int inst_size = m_inst_set.GetSize();
@@ -228,7 +310,11 @@ void cMutationalNeighborhood::ProcessOneStepPoint(cAvidaContext& ctx, cTestCPU*
     if (cur_inst == inst_num) continue;
     
     seq[cur_site].SetOp(inst_num);
-    m_fitness_point[cur_site][inst_num] = ProcessOneStepGenome(ctx, testcpu, test_info, mod_genome, odata, cur_site);
+    if (IsNeutralPoint(cur_site, inst_num)) {
+      m_fitness_point[cur_site][inst_num] = ProcessOneStepNeutral(mod_genome, odata, cur_site);
+    } else {
+      m_fitness_point[cur_site][inst_num] = ProcessOneStepGenome(ctx, testcpu, test_info, mod_genome, odata, cur_site);
+    }
 
     ProcessTwoStepPoint(ctx, testcpu, test_info, cur_site, mod_genome);
   }
@@ -278,51 +364,66 @@ double cMutationalNeighborhood::ProcessOneStepGenome(cAvidaContext& ctx, cTestCP
   // Collect the calculated fitness
   double test_fitness = test_info.GetColonyFitness();
   
+  TallyStep(odata, mod_genome, cur_site, test_fitness, test_info.GetColonyOrganism()->GetPhenotype().GetLastTaskCount());
   
-  odata.total_fitness += test_fitness;
-  odata.total_sqr_fitness += test_fitness * test_fitness;
-  odata.total++;
-  if (test_fitness == 0.0) {
-    odata.dead++;
-  } else if (test_fitness < m_neut_min) {
-    odata.neg++;
-    odata.size_neg += test_fitness;
-  } else if (test_fitness <= m_neut_max) {
-    odata.neut++;
+  return test_fitness;
+}
+
+
+double cMutationalNeighborhood::ProcessOneStepNeutral(const Genome& mod_genome, sStep& odata, int cur_site)
+{
+  TallyStep(odata, mod_genome, cur_site, m_base_fitness, m_base_tasks);
+  return m_base_fitness;
+}
+
+
+bool cMutationalNeighborhood::TallyStep(sStep& data, const Genome& mod_genome, int site, double fitness,
+                                        const tArray<int>& tasks)
+{
+  data.total_fitness += fitness;
+  data.total_sqr_fitness += fitness * fitness;
+  data.total++;
+  if (fitness == 0.0) {
+    data.dead++;
+  } else if (fitness < m_neut_min) {
+    data.neg++;
+    data.size_neg += fitness;
+  } else if (fitness <= m_neut_max) {
+    data.neut++;
   } else {
-    odata.pos++;
-    odata.size_pos += test_fitness;
-    if (test_fitness > odata.peak_fitness) {
-      odata.peak_fitness = test_fitness;
-      odata.peak_genome = mod_genome;
+    data.pos++;
+    data.size_pos += fitness;
+    if (fitness > data.peak_fitness) {
+      data.peak_fitness = fitness;
+      data.peak_genome = mod_genome;
     }
   }
   
-  if (test_fitness >= m_neut_min) odata.site_count[cur_site]++;
+  if (fitness >= m_neut_min) data.site_count[site]++;
   
-  if (test_fitness != 0.0) { // Only count tasks if the organism is alive
-    const tArray<int>& cur_tasks = test_info.GetColonyOrganism()->GetPhenotype().GetLastTaskCount();    
-    bool knockout = false;
-    bool anytask = false;
-    for (int i = 0; i < m_base_tasks.GetSize(); i++) {
-      if (m_base_tasks[i] && !cur_tasks[i]) knockout = true;
-      else if (!m_base_tasks[i] && cur_tasks[i]) anytask = true;
-    }
-    if (knockout) {
-      odata.task_knockout++;
-      odata.task_size_knockout += test_fitness;
-    }
-    if (anytask) {
-      odata.task_total++;
-      odata.task_size_total += test_fitness;
-    }
-    if (m_base_tasks.GetSize() && !m_base_tasks[m_target] && cur_tasks[m_target]) {
-      odata.task_target++;
-      odata.task_size_target += test_fitness;
-    }
+  if (fitness == 0.0) return false; // Only count tasks if the organism is alive
+  
+  bool knockout = false;
+  bool anytask = false;
+  for (int i = 0; i < m_base_tasks.GetSize(); i++) {
+    if (m_base_tasks[i] && !tasks[i]) knockout = true;
+    else if (!m_base_tasks[i] && tasks[i]) anytask = true;
+  }
+  if (knockout) {
+    data.task_knockout++;
+    data.task_size_knockout += fitness;
+  }
+  if (anytask) {
+    data.task_total++;
+    data.task_size_total += fitness;
+  }
+  if (m_base_tasks.GetSize() && !m_base_tasks[m_target] && tasks[m_target]) {
+    data.task_target++;
+    data.task_size_target += fitness;
+    return true;
   }
   
-  return test_fitness;
+  return false;
 }
 
 
@@ -344,7 +445,11 @@ void cMutationalNeighborhood::ProcessTwoStepPoint(cAvidaContext& ctx, cTestCPU*
       if (cur_inst == inst_num) continue;
       
       seq[line_num].SetOp(inst_num);
-      ProcessTwoStepGenome(ctx, testcpu, test_info, mod_genome, tdata, sPendFit(m_fitness_point, line_num, inst_num), cur);
+      if (IsNeutralPoint(cur_site, cur.inst) && IsNeutralPoint(line_num, inst_num)) {
+        ProcessTwoStepNeutral(mod_genome, tdata, cur);
+      } else {
+        ProcessTwoStepGenome(ctx, testcpu, test_info, mod_genome, tdata, sPendFit(m_fitness_point, line_num, inst_num), cur);
+      }
     }
     
     seq[line_num].SetOp(cur_inst);
@@ -476,56 +581,23 @@ double cMutationalNeighborhood::ProcessTwoStepGenome(cAvidaContext& ctx, cTestCP
   // Collect the calculated fitness
   double test_fitness = test_info.GetColonyFitness();
   
-  tdata.total_fitness += test_fitness;
-  tdata.total_sqr_fitness += test_fitness * test_fitness;
-  tdata.total++;
-  if (test_fitness == 0.0) {
-    tdata.dead++;
-  } else if (test_fitness < m_neut_min) {
-    tdata.neg++;
-    tdata.size_neg += test_fitness;
-  } else if (test_fitness <= m_neut_max) {
-    tdata.neut++;
-  } else {
-    tdata.pos++;
-    tdata.size_pos += test_fitness;
-    if (test_fitness > tdata.peak_fitness) {
-      tdata.peak_fitness = test_fitness;
-      tdata.peak_genome = mod_genome;
-    }
-  }
-  
-  if (test_fitness >= m_neut_min) tdata.site_count[cur.site]++;
-  
-  if (test_fitness != 0.0) { // Only count tasks if the organism is alive
-    const tArray<int>& cur_tasks = test_info.GetColonyOrganism()->GetPhenotype().GetLastTaskCount();    
-    bool knockout = false;
-    bool anytask = false;
-    for (int i = 0; i < m_base_tasks.GetSize(); i++) {
-      if (m_base_tasks[i] && !cur_tasks[i]) knockout = true;
-      else if (!m_base_tasks[i] && cur_tasks[i]) anytask = true;
-    }
-    if (knockout) {
-      tdata.task_knockout++;
-      tdata.task_size_knockout += test_fitness;
-    }
-    if (anytask) {
-      tdata.task_total++;
-      tdata.task_size_total += test_fitness;
-    }
-    if (m_base_tasks.GetSize() && !m_base_tasks[m_target] && cur_tasks[m_target]) {
-      tdata.task_target++;
-      tdata.task_size_target += test_fitness;
-      
-      // Push both instructions as possible first mutations, for post determination of first step fitness effect
-      tdata.pending.Push(new sPendFit(oth));
-      tdata.pending.Push(new sPendFit(cur));
-    }
+  const tArray<int>& cur_tasks = test_info.GetColonyOrganism()->GetPhenotype().GetLastTaskCount();
+  if (TallyStep(tdata, mod_genome, cur.site, test_fitness, cur_tasks)) {
+    // Push both instructions as possible first mutations, for post determination of first step fitness effect
+    tdata.pending.Push(new sPendFit(oth));
+    tdata.pending.Push(new sPendFit(cur));
   }
   
   return test_fitness;
 }
 
+
+void cMutationalNeighborhood::ProcessTwoStepNeutral(const Genome& mod_genome, sTwoStep& tdata, const sPendFit& cur)
+{
+  // The base tasks never include a newly gained target, so nothing is left pending
+  TallyStep(tdata, mod_genome, cur.site, m_base_fitness, m_base_tasks);
+}
+
 void cMutationalNeighborhood::ProcessComplete(cAvidaContext& ctx)
 {
   m_op.peak_fitness = m_base_fitness;
@@ -68,6 +68,7 @@ private:
   
   const cInstSet& m_inst_set;  
   int m_target;
+  bool m_prune_unexecuted;  // Count point mutations that provably cannot change execution as neutral, without testing
   
   
   
@@ -80,6 +81,7 @@ private:
   tArray<int> m_base_tasks;
   double m_neut_min;  // These two variables are a range around the base
   double m_neut_max;  //   fitness to be counted as neutral mutations.
+  tArray<bool> m_executed;  // Sites the base genome executed (or read as labels); empty unless pruning is in effect
   
   
 
@@ -241,7 +243,7 @@ private:
 public:
   // Public Methods - Instantiate and Process Only.   All results must be read with a cMutationalNeighborhood object.
   // -----------------------------------------------------------------------------------------------------------------------
-  cMutationalNeighborhood(cWorld* world, const Genome& genome, int target);
+  cMutationalNeighborhood(cWorld* world, const Genome& genome, int target, bool prune_unexecuted = false);
   ~cMutationalNeighborhood() { ; }
   
   void Process(cAvidaContext& ctx);
@@ -251,12 +253,16 @@ private:
   // Internal Calculation Methods
   // -----------------------------------------------------------------------------------------------------------------------
   void ProcessInitialize(cAvidaContext& ctx);
+  void FindExecutedSites(cAvidaContext& ctx, cTestCPU* testcpu, const cCPUTestInfo& base_info);
+  bool IsNeutralPoint(int site, int inst) const;
   
   void ProcessOneStepPoint(cAvidaContext& ctx, cTestCPU* testcpu, cCPUTestInfo& test_info, int cur_site);
   void ProcessOneStepInsert(cAvidaContext& ctx, cTestCPU* testcpu, cCPUTestInfo& test_info, int cur_site);
   void ProcessOneStepDelete(cAvidaContext& ctx, cTestCPU* testcpu, cCPUTestInfo& test_info, int cur_site);
   double ProcessOneStepGenome(cAvidaContext& ctx, cTestCPU* testcpu, cCPUTestInfo& test_info, const Genome& mod_genome,
                               sStep& odata, int cur_site);
+  double ProcessOneStepNeutral(const Genome& mod_genome, sStep& odata, int cur_site);
+  bool TallyStep(sStep& data, const Genome& mod_genome, int site, double fitness, const tArray<int>& tasks);
   void AggregateOneStep(tArray<sStep>& steps, sOneStepAggregate& osa);
 
   void ProcessTwoStepPoint(cAvidaContext& ctx, cTestCPU* testcpu, cCPUTestInfo& test_info, int cur_site, Genome& mod_genome);
@@ -267,6 +273,7 @@ private:
   void ProcessDeletePointCombo(cAvidaContext& ctx, cTestCPU* testcpu, cCPUTestInfo& test_info, int cur_site, Genome& mod_genome);
   double ProcessTwoStepGenome(cAvidaContext& ctx, cTestCPU* testcpu, cCPUTestInfo& test_info, const Genome& mod_genome,
                               sTwoStep& tdata, const sPendFit& cur, const sPendFit& oth);
+  void ProcessTwoStepNeutral(const Genome& mod_genome, sTwoStep& tdata, const sPendFit& cur);
   void AggregateTwoStep(tArray<sTwoStep>& steps, sTwoStepAggregate& osa);
   
   void ProcessComplete(cAvidaContext& ctx);
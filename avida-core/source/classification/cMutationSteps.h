@@ -63,6 +63,13 @@ public:
   void operator=(const cMutationSteps& in_ms) { m_steps = in_ms.m_steps; }
   ~cMutationSteps() { ; }
   void Clear() { m_steps.Resize(0); }  
+  void Swap(cMutationSteps& other)
+  {
+    m_steps.Swap(other.m_steps);
+    cString loaded(m_loaded_string);
+    m_loaded_string = other.m_loaded_string;
+    other.m_loaded_string = loaded;
+  }
 
   void AddSubstitutionMutation(int _pos, char _from, char _to);
   void AddDeletionMutation(int _pos, char _from);
@@ -140,6 +140,33 @@ void Avida::Sequence::Insert(int pos, const Sequence& seq)
   for (int i = 0; i < seq.GetSize(); i++) m_seq[i + pos] = seq[i];
 }
 
+void Avida::Sequence::Assign(const Sequence& seq, int start, int end)
+{
+  assert(&seq != this);
+  assert(start >= 0 && start <= end && end <= seq.GetSize());
+  
+  const int new_size = end - start;
+  const int array_size = m_seq.GetSize();
+  if (new_size > array_size || new_size * MEMORY_SHRINK_TEST_FACTOR < array_size) m_seq.ResizeClear(new_size);
+  m_active_size = new_size;
+  
+  for (int i = 0; i < new_size; i++) m_seq[i] = seq.m_seq[i + start];
+  
+  // As with assigning a Crop() of seq, none of its mutation steps carry over
+  m_mutation_steps.Clear();
+}
+
+void Avida::Sequence::Swap(Sequence& other)
+{
+  m_seq.Swap(other.m_seq);
+  
+  const int active_size = m_active_size;
+  m_active_size = other.m_active_size;
+  other.m_active_size = active_size;
+  
+  m_mutation_steps.Swap(other.m_mutation_steps);
+}
+
 void Avida::Sequence::Remove(int pos, int num_sites)
 {
   assert(num_sites > 0);                    // Must remove something...
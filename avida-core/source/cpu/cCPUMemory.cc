@@ -25,7 +25,8 @@
 using namespace std;
 
 
-cCPUMemory::cCPUMemory(const cCPUMemory& in_memory) : Sequence(in_memory), m_flag_array(in_memory.GetSize())
+cCPUMemory::cCPUMemory(const cCPUMemory& in_memory)
+  : Sequence(in_memory), m_flag_array(in_memory.GetSize()), m_revision(in_memory.m_revision)
 {
   for (int i = 0; i < m_flag_array.GetSize(); i++) m_flag_array[i] = in_memory.m_flag_array[i];
 }
@@ -65,6 +66,7 @@ void cCPUMemory::Reset(int new_size)
 
 void cCPUMemory::Resize(int new_size)
 {
+  m_revision++;
   assert(new_size >= 0);
 
   const int old_size = m_active_size;
@@ -79,6 +81,7 @@ void cCPUMemory::Resize(int new_size)
 
 void cCPUMemory::ResizeOld(int new_size)
 {
+  m_revision++;
   assert(new_size >= 0);
 
   const int old_size = m_active_size;
@@ -90,6 +93,7 @@ void cCPUMemory::ResizeOld(int new_size)
 
 void cCPUMemory::Copy(int to, int from)
 {
+  m_revision++;
   assert(to >= 0);
   assert(to < m_seq.GetSize());
   assert(from >= 0);
@@ -102,6 +106,7 @@ void cCPUMemory::Copy(int to, int from)
 
 void cCPUMemory::Insert(int pos, const cInstruction& inst)
 {
+  m_revision++;
   assert(pos >= 0);
   assert(pos <= m_seq.GetSize());
 
@@ -112,6 +117,7 @@ void cCPUMemory::Insert(int pos, const cInstruction& inst)
 
 void cCPUMemory::Insert(int pos, const Sequence& genome)
 {
+  m_revision++;
   assert(pos >= 0);
   assert(pos <= m_seq.GetSize());
 
@@ -124,6 +130,7 @@ void cCPUMemory::Insert(int pos, const Sequence& genome)
 
 void cCPUMemory::Remove(int pos, int num_sites)
 {
+  m_revision++;
   assert(num_sites > 0);                    // Must remove something...
   assert(pos >= 0);                         // Removal must be in genome.
   assert(pos + num_sites <= m_active_size); // Cannot extend past end of genome.
@@ -138,6 +145,7 @@ void cCPUMemory::Remove(int pos, int num_sites)
 
 void cCPUMemory::Replace(int pos, int num_sites, const Sequence& genome)
 {
+  m_revision++;
   assert(pos >= 0);                         // Replace must be in genome
   assert(num_sites >= 0);                   // Cannot replace negative
   assert(pos + num_sites <= m_active_size); // Cannot extend past end!
@@ -156,8 +164,16 @@ void cCPUMemory::Replace(int pos, int num_sites, const Sequence& genome)
 }
 
 
+void cCPUMemory::Rotate(int n)
+{
+  m_revision++;
+  Sequence::Rotate(n);
+}
+
+
 void cCPUMemory::operator=(const cCPUMemory& other_memory)
 {
+  m_revision++;
   adjustCapacity(other_memory.m_active_size);
   
   // Fill in the new information...
@@ -170,6 +186,7 @@ void cCPUMemory::operator=(const cCPUMemory& other_memory)
 
 void cCPUMemory::operator=(const Sequence& other_genome)
 {
+  m_revision++;
   adjustCapacity(other_genome.GetSize());
   
   // Fill in the new information...
@@ -45,17 +45,26 @@ private:
 	static const unsigned char MASK_UNUSED   = 0x80; // unused bit
   
   tArray<unsigned char> m_flag_array;
+  unsigned int m_revision;  // Bumped on every change that may alter the instructions held
 
   void adjustCapacity(int new_size);
   void prepareInsert(int pos, int num_sites);
 
 public:
   cCPUMemory(const cCPUMemory& in_memory);
-  cCPUMemory(const Sequence& in_genome) : Sequence(in_genome), m_flag_array(in_genome.GetSize()) { ; }
-  explicit cCPUMemory(int size = 1)  : Sequence(size), m_flag_array(size) { ClearFlags(); }
-  cCPUMemory(const cString& in_string) : Sequence(in_string), m_flag_array(in_string.GetSize()) { ; }
+  cCPUMemory(const Sequence& in_genome) : Sequence(in_genome), m_flag_array(in_genome.GetSize()), m_revision(0) { ; }
+  explicit cCPUMemory(int size = 1)  : Sequence(size), m_flag_array(size), m_revision(0) { ClearFlags(); }
+  cCPUMemory(const cString& in_string) : Sequence(in_string), m_flag_array(in_string.GetSize()), m_revision(0) { ; }
   ~cCPUMemory() { ; }
 
+  // Any non-const access to a site may write through it, so it counts as a change
+  inline cInstruction& operator[](int idx) { m_revision++; return Sequence::operator[](idx); }
+  inline const cInstruction& operator[](int idx) const { return Sequence::operator[](idx); }
+  
+  //! Changes whenever the instructions may have been changed through this class (including through its virtual
+  //! Sequence methods); anything derived from them can be kept while it stays the same
+  inline unsigned int GetRevision() const { return m_revision; }
+
   inline bool FlagCopied(int pos) const     { return MASK_COPIED   & m_flag_array[pos]; }
   inline bool FlagMutated(int pos) const    { return MASK_MUTATED  & m_flag_array[pos]; }
   inline bool FlagExecuted(int pos) const   { return MASK_EXECUTED & m_flag_array[pos]; }
@@ -83,6 +92,7 @@ public:
   
   void Clear()
 	{
+    m_revision++;
 		for (int i = 0; i < m_active_size; i++) {
 			m_seq[i].SetOp(0);
 			m_flag_array[i] = 0;
@@ -100,6 +110,7 @@ public:
   void Insert(int pos, const Sequence& genome);
   void Remove(int pos, int num_sites = 1);
   void Replace(int pos, int num_sites, const Sequence& genome);
+  void Rotate(int n);
 
   void operator=(const cCPUMemory& other_memory);
   void operator=(const Sequence& other_genome);
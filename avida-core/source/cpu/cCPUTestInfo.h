@@ -91,6 +91,10 @@ public:
   ~cCPUTestInfo();
 
   void Clear();
+
+  // Take on the input, resource and mutation settings of test_info, sharing its resource history but not its tracer
+  // or results.  Unlike the copy constructor, this leaves each test info owning only its own test organisms.
+  void CopySettings(const cCPUTestInfo& test_info);
  
   // Input Setup
   void TraceTaskOrder(bool _trace=true) { trace_task_order = _trace; }
@@ -110,8 +114,11 @@ public:
   bool GetUseRandomInputs() const { return use_random_inputs; }
   bool GetTraceExecution() const { return (m_tracer); }
 	bool GetUseManualInputs() const { return use_manual_inputs; }
+  const tArray<int>& GetManualInputs() const { return manual_inputs; }
+  eTestCPUResourceMethod GetResourceMethod() const { return m_res_method; }
 	tArray<int> GetTestCPUInputs() const { return used_inputs; }
   cHardwareTracer *GetTracer() { return m_tracer; }
+  cHardwareTracer *GetTracer() const { return m_tracer; }
 
 
   // Output Accessors
@@ -595,7 +595,7 @@ void cHardwareBase::doUniformCopyMutation(cAvidaContext& ctx, cHeadCPU& head)
   //Anya added code for Head to Head kazi experiment
   bool in_List = false;
   char test_inst = head.GetInst().GetSymbol();
-  cString no_mut_list = m_world->GetConfig().NO_MUT_INSTS.Get();
+  const cString& no_mut_list = m_world->GetConfig().NO_MUT_INSTS.Get();
   for(int i=0; i<(int)strlen(no_mut_list); i++) {
     if ((char) no_mut_list[i] == test_inst) in_List = true;
   }
@@ -98,6 +98,16 @@ protected:
   tSmartArray<int> m_ext_mem;
   bool m_implicit_repro_active;
   
+  // --------  Execution Variants  ---------
+  // Features that stay fixed for the life of a hardware object.  Each hardware type instantiates SingleProcess once
+  // for every combination of the features it tests and selects the matching variant when it is constructed.
+  enum {
+    EXEC_COSTS = 0x1,        // Instruction costs must be paid (m_has_any_costs)
+    EXEC_CYCLE_TIME = 0x2,   // CPU cycles count toward time used (NO_CPU_CYCLE_TIME off)
+    EXEC_PROMOTERS = 0x4,    // Promoters and/or constitutive regulation enabled
+    EXEC_TASK_SWITCH = 0x8   // TASK_SWITCH_PENALTY_TYPE set
+  };
+  
 	// --------  Bit masks  ---------
 	static const unsigned int MASK_SIGNBIT = 0x7FFFFFFF;	
 	static const unsigned int MASK24       = 0xFFFFFF;
@@ -773,9 +773,18 @@ cHardwareCPU::cHardwareCPU(cAvidaContext& ctx, cWorld* world, cOrganism* in_orga
   
   m_promoters_enabled = m_world->GetConfig().PROMOTERS_ENABLED.Get();
   m_constitutive_regulation = m_world->GetConfig().CONSTITUTIVE_REGULATION.Get();
+  m_task_switch_penalty = m_world->GetConfig().TASK_SWITCH_PENALTY_TYPE.Get();
   
   m_slip_read_head = !m_world->GetConfig().SLIP_COPY_MODE.Get();
   
+  // Select the SingleProcess variant built for the features in use
+  int features = 0;
+  if (m_has_any_costs) features |= EXEC_COSTS;
+  if (!m_no_cpu_cycle_time) features |= EXEC_CYCLE_TIME;
+  if (m_promoters_enabled || m_constitutive_regulation) features |= EXEC_PROMOTERS;
+  if (m_task_switch_penalty) features |= EXEC_TASK_SWITCH;
+  m_single_process = s_single_process[features];
+  
   m_memory = in_organism->GetGenome().GetSequence();  // Initialize memory...
   Reset(ctx);                            // Setup the rest of the hardware...
   internalReset();
@@ -787,7 +796,7 @@ bool cHardwareCPU::checkNoMutList(cHeadCPU to)
     //Tests to see if the given cHeadCPU has an instruction that is on the no mutation list, returns false if it is not and true if it is
     bool in_list = false;
     char test_inst = to.GetInst().GetSymbol();
-    cString no_mut_list = m_world->GetConfig().NO_MUT_INSTS.Get();
+    const cString& no_mut_list = m_world->GetConfig().NO_MUT_INSTS.Get();
     for (int i=0; i<(int)strlen(no_mut_list); i++) {
         if ((char) no_mut_list[i] == test_inst) {
             in_list = true;
@@ -888,8 +897,11 @@ void cHardwareCPU::cLocalThread::Reset(cHardwareBase* in_hardware, int in_id)
 
 // This function processes the very next command in the genome, and is made
 // to be as optimized as possible.  This is the heart of avida.
+//
+// It is instantiated once for each combination of the EXEC_* features, so that the
+// tests for features that are off in this run compile away.
 
-bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
+template <int FEATURES> bool cHardwareCPU::singleProcess(cAvidaContext& ctx, bool speculative)
 {
   assert(!speculative || (speculative && !m_thread_slicing_parallel));
   
@@ -907,11 +919,11 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
   cPhenotype& phenotype = m_organism->GetPhenotype();
   
   // First instruction - check whether we should be starting at a promoter, when enabled.
-  if (phenotype.GetCPUCyclesUsed() == 0 && m_promoters_enabled) Inst_Terminate(ctx);
+  if ((FEATURES & EXEC_PROMOTERS) && phenotype.GetCPUCyclesUsed() == 0 && m_promoters_enabled) Inst_Terminate(ctx);
   
   // Count the cpu cycles used
   phenotype.IncCPUCyclesUsed();
-  if (!m_world->GetConfig().NO_CPU_CYCLE_TIME.Get()) phenotype.IncTimeUsed();
+  if (FEATURES & EXEC_CYCLE_TIME) phenotype.IncTimeUsed();
   
   int num_threads = m_threads.GetSize();
   
@@ -952,20 +964,22 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
       // Speculative instruction reject, flush and return
       m_cur_thread = last_thread;
       phenotype.DecCPUCyclesUsed();
-      if (!m_no_cpu_cycle_time) phenotype.IncTimeUsed(-1);
+      if (FEATURES & EXEC_CYCLE_TIME) phenotype.IncTimeUsed(-1);
       m_organism->SetRunning(false);
       return false;
     }
     
     // Test if costs have been paid and it is okay to execute this now...
     bool exec = true;
-    if (m_has_any_costs) exec = SingleProcess_PayPreCosts(ctx, cur_inst, m_cur_thread);
-    
-    // Constitutive regulation applied here
-    if (m_constitutive_regulation) Inst_SenseRegulate(ctx); 
+    if (FEATURES & EXEC_COSTS) exec = SingleProcess_PayPreCosts(ctx, cur_inst, m_cur_thread);
     
-    // If there are no active promoters and a certain mode is set, then don't execute any further instructions
-    if (m_promoters_enabled && m_world->GetConfig().NO_ACTIVE_PROMOTER_EFFECT.Get() == 2 && m_promoter_index == -1) exec = false;
+    if (FEATURES & EXEC_PROMOTERS) {
+      // Constitutive regulation applied here
+      if (m_constitutive_regulation) Inst_SenseRegulate(ctx); 
+      
+      // If there are no active promoters and a certain mode is set, then don't execute any further instructions
+      if (m_promoters_enabled && m_world->GetConfig().NO_ACTIVE_PROMOTER_EFFECT.Get() == 2 && m_promoter_index == -1) exec = false;
+    }
     
     // Now execute the instruction...
     if (exec == true) {
@@ -986,10 +1000,10 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
       getIP().SetFlagExecuted();
       
       // Add to the promoter inst executed count before executing the inst (in case it is a terminator)
-      if (m_promoters_enabled) m_threads[m_cur_thread].IncPromoterInstExecuted();
+      if ((FEATURES & EXEC_PROMOTERS) && m_promoters_enabled) m_threads[m_cur_thread].IncPromoterInstExecuted();
       
       if (exec == true) {
-        if (SingleProcess_ExecuteInst(ctx, cur_inst)) { 
+        if (singleProcess_ExecuteInst<FEATURES & EXEC_TASK_SWITCH>(ctx, cur_inst) && (FEATURES & EXEC_COSTS)) { 
           SingleProcess_PayPostResCosts(ctx, cur_inst); 
           SingleProcess_SetPostCPUCosts(ctx, cur_inst, m_cur_thread); 
         }
@@ -1006,7 +1020,7 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
       phenotype.IncTimeUsed(time_cost);
       
       // In the promoter model, we may force termination after a certain number of inst have been executed
-      if (m_promoters_enabled) {
+      if ((FEATURES & EXEC_PROMOTERS) && m_promoters_enabled) {
         const double processivity = m_world->GetConfig().PROMOTER_PROCESSIVITY.Get();
         if (ctx.GetRandom().P(1 - processivity)) Inst_Terminate(ctx);
         if (m_world->GetConfig().PROMOTER_INST_MAX.Get() && (m_threads[m_cur_thread].GetPromoterInstExecuted() >= m_world->GetConfig().PROMOTER_INST_MAX.Get())) 
@@ -1049,7 +1063,7 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
 
 // This method will handle the actual execution of an instruction
 // within a single process, once that function has been finalized.
-bool cHardwareCPU::SingleProcess_ExecuteInst(cAvidaContext& ctx, const cInstruction& cur_inst) 
+template <int FEATURES> bool cHardwareCPU::singleProcess_ExecuteInst(cAvidaContext& ctx, const cInstruction& cur_inst) 
 {
   // Copy Instruction locally to handle stochastic effects
   cInstruction actual_inst = cur_inst;
@@ -1071,7 +1085,7 @@ bool cHardwareCPU::SingleProcess_ExecuteInst(cAvidaContext& ctx, const cInstruct
   // NOTE: Organism may be dead now if instruction executed killed it (such as some divides, "die", or "kazi")
   
   // Add in a cycle cost for switching which task is performed
-  if (m_world->GetConfig().TASK_SWITCH_PENALTY_TYPE.Get()) {
+  if (FEATURES & EXEC_TASK_SWITCH) {
     if (m_organism->GetPhenotype().GetNumNewUniqueReactions()) {
       int cost = m_organism->GetPhenotype().GetNumNewUniqueReactions() * m_world->GetConfig().TASK_SWITCH_PENALTY.Get();
       IncrementTaskSwitchingCost(cost);
@@ -1089,6 +1103,24 @@ bool cHardwareCPU::SingleProcess_ExecuteInst(cAvidaContext& ctx, const cInstruct
 }
 
 
+const cHardwareCPU::tSingleProcessMethod cHardwareCPU::s_single_process[] = {
+  &cHardwareCPU::singleProcess<0x0>, &cHardwareCPU::singleProcess<0x1>, &cHardwareCPU::singleProcess<0x2>,
+  &cHardwareCPU::singleProcess<0x3>, &cHardwareCPU::singleProcess<0x4>, &cHardwareCPU::singleProcess<0x5>,
+  &cHardwareCPU::singleProcess<0x6>, &cHardwareCPU::singleProcess<0x7>, &cHardwareCPU::singleProcess<0x8>,
+  &cHardwareCPU::singleProcess<0x9>, &cHardwareCPU::singleProcess<0xA>, &cHardwareCPU::singleProcess<0xB>,
+  &cHardwareCPU::singleProcess<0xC>, &cHardwareCPU::singleProcess<0xD>, &cHardwareCPU::singleProcess<0xE>,
+  &cHardwareCPU::singleProcess<0xF>
+};
+
+
+// Bonus instructions run outside of SingleProcess, so they pick the variant themselves
+bool cHardwareCPU::SingleProcess_ExecuteInst(cAvidaContext& ctx, const cInstruction& cur_inst)
+{
+  if (m_task_switch_penalty) return singleProcess_ExecuteInst<EXEC_TASK_SWITCH>(ctx, cur_inst);
+  return singleProcess_ExecuteInst<0>(ctx, cur_inst);
+}
+
+
 void cHardwareCPU::ProcessBonusInst(cAvidaContext& ctx, const cInstruction& inst)
 {
   // Mark this organism as running...
@@ -1734,7 +1766,7 @@ bool cHardwareCPU::Divide_Main(cAvidaContext& ctx, const int div_point,
   // Since the divide will now succeed, set up the information to be sent
   // to the new organism
   Sequence& child_genome = m_organism->OffspringGenome().GetSequence();
-  child_genome = m_memory.Crop(div_point, div_point + child_size);
+  child_genome.Assign(m_memory, div_point, div_point + child_size);
   m_organism->OffspringGenome().SetHardwareType(GetType());
   m_organism->OffspringGenome().SetInstSet(m_inst_set->GetInstSetName());
   
@@ -1804,7 +1836,7 @@ bool cHardwareCPU::Divide_MainRS(cAvidaContext& ctx, const int div_point,
   // Since the divide will now succeed, set up the information to be sent
   // to the new organism
   Sequence& child_genome = m_organism->OffspringGenome().GetSequence();
-  child_genome = m_memory.Crop(div_point, div_point + child_size);
+  child_genome.Assign(m_memory, div_point, div_point + child_size);
   m_organism->OffspringGenome().SetHardwareType(GetType());
   m_organism->OffspringGenome().SetInstSet(m_inst_set->GetInstSetName());
   
@@ -1898,7 +1930,7 @@ bool cHardwareCPU::Divide_Main1RS(cAvidaContext& ctx, const int div_point,
   // Since the divide will now succeed, set up the information to be sent
   // to the new organism
   Sequence& child_genome = m_organism->OffspringGenome().GetSequence();
-  child_genome = m_memory.Crop(div_point, div_point + child_size);
+  child_genome.Assign(m_memory, div_point, div_point + child_size);
   m_organism->OffspringGenome().SetHardwareType(GetType());
   m_organism->OffspringGenome().SetInstSet(m_inst_set->GetInstSetName());
   
@@ -1987,7 +2019,7 @@ bool cHardwareCPU::Divide_Main2RS(cAvidaContext& ctx, const int div_point,
   // Since the divide will now succeed, set up the information to be sent
   // to the new organism
   Sequence& child_genome = m_organism->OffspringGenome().GetSequence();
-  child_genome = m_memory.Crop(div_point, div_point + child_size);
+  child_genome.Assign(m_memory, div_point, div_point + child_size);
   m_organism->OffspringGenome().SetHardwareType(GetType());
   m_organism->OffspringGenome().SetInstSet(m_inst_set->GetInstSetName());
   
@@ -3307,7 +3339,7 @@ bool cHardwareCPU::Inst_Repro(cAvidaContext& ctx)
       //Need to check no_mut_insts for head to head kaboom experiments
       bool in_list = false;
       char test_inst = child_genome[i].GetSymbol();
-      cString no_mut_list = m_world->GetConfig().NO_MUT_INSTS.Get();
+      const cString& no_mut_list = m_world->GetConfig().NO_MUT_INSTS.Get();
       for (int j = 0; j < (int)strlen(no_mut_list); j++) {
         if ((char) no_mut_list[j] == test_inst) in_list = true;
       }
@@ -125,6 +125,7 @@ protected:
 
     bool m_promoters_enabled:1;
     bool m_constitutive_regulation:1;
+    bool m_task_switch_penalty:1;
 
     bool m_slip_read_head:1;
   };
@@ -154,6 +155,13 @@ protected:
   // Epigenetic State -->
 
 
+  // --------  Execution Variants  --------
+  typedef bool (cHardwareCPU::*tSingleProcessMethod)(cAvidaContext& ctx, bool speculative);
+  static const tSingleProcessMethod s_single_process[];
+  tSingleProcessMethod m_single_process;
+
+  template <int FEATURES> bool singleProcess(cAvidaContext& ctx, bool speculative);
+  template <int FEATURES> bool singleProcess_ExecuteInst(cAvidaContext& ctx, const cInstruction& cur_inst);
   bool SingleProcess_ExecuteInst(cAvidaContext& ctx, const cInstruction& cur_inst);
 
   // --------  Stack Manipulation...  --------
@@ -240,7 +248,7 @@ public:
   static tInstLib<tMethod>* GetInstLib() { return s_inst_slib; }
   static cString GetDefaultInstFilename() { return "instset-heads.cfg"; }
 
-  bool SingleProcess(cAvidaContext& ctx, bool speculative = false);
+  bool SingleProcess(cAvidaContext& ctx, bool speculative = false) { return (this->*m_single_process)(ctx, speculative); }
   void ProcessBonusInst(cAvidaContext& ctx, const cInstruction& inst);
 
 
@@ -445,6 +445,13 @@ cHardwareExperimental::cHardwareExperimental(cAvidaContext& ctx, cWorld* world,
   
   m_slip_read_head = !m_world->GetConfig().SLIP_COPY_MODE.Get();
   
+  // Select the SingleProcess variant built for the features in use
+  int features = 0;
+  if (m_has_any_costs) features |= EXEC_COSTS;
+  if (!m_no_cpu_cycle_time) features |= EXEC_CYCLE_TIME;
+  if (m_promoters_enabled) features |= EXEC_PROMOTERS;
+  m_single_process = s_single_process[features];
+  
   m_memory = in_organism->GetGenome().GetSequence();  // Initialize memory...
   m_use_avatar = m_world->GetConfig().USE_AVATARS.Get();
   Reset(ctx);                                         // Setup the rest of the hardware...
@@ -551,7 +558,8 @@ void cHardwareExperimental::cLocalThread::Reset(cHardwareExperimental* in_hardwa
 // This function processes the very next command in the genome, and is made
 // to be as optimized as possible.  This is the heart of avida.
 
-bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
+// Instantiated once for each combination of EXEC_COSTS, EXEC_CYCLE_TIME and EXEC_PROMOTERS
+template <int FEATURES> bool cHardwareExperimental::singleProcess(cAvidaContext& ctx, bool speculative)
 {
   assert(!speculative || (speculative && !m_thread_slicing_parallel));
   
@@ -567,16 +575,16 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
   cPhenotype& phenotype = m_organism->GetPhenotype();
   
   // First instruction - check whether we should be starting at a promoter, when enabled.
-  if (phenotype.GetCPUCyclesUsed() == 0 && m_promoters_enabled) PromoterTerminate(ctx);
+  if ((FEATURES & EXEC_PROMOTERS) && phenotype.GetCPUCyclesUsed() == 0) PromoterTerminate(ctx);
   
   m_cycle_count++;
 //  assert(m_cycle_count < 0x8000);
   phenotype.IncCPUCyclesUsed();
-  if (!m_no_cpu_cycle_time) phenotype.IncTimeUsed();
+  if (FEATURES & EXEC_CYCLE_TIME) phenotype.IncTimeUsed();
   
   // If we have threads turned on and we executed each thread in a single
   // timestep, adjust the number of instructions executed accordingly.
-  const int num_inst_exec = (m_world->GetConfig().THREAD_SLICING_METHOD.Get() == 1) ? m_threads.GetSize() : 1;
+  const int num_inst_exec = m_thread_slicing_parallel ? m_threads.GetSize() : 1;
   
   int num_active = 0;
   for (int i = 0; i < m_threads.GetSize(); i++) {
@@ -616,7 +624,7 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
       // Speculative instruction reject, flush and return
       m_cur_thread = last_thread;
       phenotype.DecCPUCyclesUsed();
-      if (!m_no_cpu_cycle_time) phenotype.IncTimeUsed(-1);
+      if (FEATURES & EXEC_CYCLE_TIME) phenotype.IncTimeUsed(-1);
       m_organism->SetRunning(false);
       return false;
     }
@@ -630,11 +638,11 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
     
     // record any failure due to costs being paid
     // before we try to execute the instruction, is this org currently paying precosts for it
-    bool on_pause = IsPayingActiveCost(ctx, m_cur_thread);
-    if (m_has_any_costs) exec = SingleProcess_PayPreCosts(ctx, cur_inst, m_cur_thread);    
+    bool on_pause = (FEATURES & EXEC_COSTS) && IsPayingActiveCost(ctx, m_cur_thread);
+    if (FEATURES & EXEC_COSTS) exec = SingleProcess_PayPreCosts(ctx, cur_inst, m_cur_thread);    
     if (!exec) exec_success = -1;
 
-    if (m_promoters_enabled) {
+    if (FEATURES & EXEC_PROMOTERS) {
       // Constitutive regulation applied here
       if (m_constitutive_regulation) Inst_SenseRegulate(ctx); 
       
@@ -657,12 +665,14 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
       }
       
       //Add to the promoter inst executed count before executing the inst (in case it is a terminator)
-      if (m_promoters_enabled) m_threads[m_cur_thread].IncPromoterInstExecuted();
+      if (FEATURES & EXEC_PROMOTERS) m_threads[m_cur_thread].IncPromoterInstExecuted();
       
       if (exec == true) {
         if (SingleProcess_ExecuteInst(ctx, cur_inst)) {
-          SingleProcess_PayPostResCosts(ctx, cur_inst); 
-          SingleProcess_SetPostCPUCosts(ctx, cur_inst, m_cur_thread); 
+          if (FEATURES & EXEC_COSTS) {
+            SingleProcess_PayPostResCosts(ctx, cur_inst); 
+            SingleProcess_SetPostCPUCosts(ctx, cur_inst, m_cur_thread); 
+          }
           // record execution success
           exec_success = 1;
         }
@@ -681,7 +691,7 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
       phenotype.IncTimeUsed(addl_time_cost);
       
       // In the promoter model, we may force termination after a certain number of inst have been executed
-      if (m_promoters_enabled) {
+      if (FEATURES & EXEC_PROMOTERS) {
         const double processivity = m_world->GetConfig().PROMOTER_PROCESSIVITY.Get();
         if (ctx.GetRandom().P(1 - processivity)) PromoterTerminate(ctx);
         if (m_world->GetConfig().PROMOTER_INST_MAX.Get() &&
@@ -727,6 +737,14 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
   return !m_spec_die;
 }
 
+const cHardwareExperimental::tSingleProcessMethod cHardwareExperimental::s_single_process[] = {
+  &cHardwareExperimental::singleProcess<0x0>, &cHardwareExperimental::singleProcess<0x1>,
+  &cHardwareExperimental::singleProcess<0x2>, &cHardwareExperimental::singleProcess<0x3>,
+  &cHardwareExperimental::singleProcess<0x4>, &cHardwareExperimental::singleProcess<0x5>,
+  &cHardwareExperimental::singleProcess<0x6>, &cHardwareExperimental::singleProcess<0x7>
+};
+
+
 // This method will handle the actuall execution of an instruction
 // within single process, once that function has been finalized.
 bool cHardwareExperimental::SingleProcess_ExecuteInst(cAvidaContext& ctx, const cInstruction& cur_inst) 
@@ -1521,7 +1539,7 @@ bool cHardwareExperimental::Divide_Main(cAvidaContext& ctx, const int div_point,
   
   // Since the divide will now succeed, set up the information to be sent
   // to the new organism
-  m_organism->OffspringGenome().SetSequence(m_memory.Crop(div_point, div_point+child_size));
+  m_organism->OffspringGenome().GetSequence().Assign(m_memory, div_point, div_point + child_size);
   m_organism->OffspringGenome().SetHardwareType(GetType());
   m_organism->OffspringGenome().SetInstSet(m_inst_set->GetInstSetName());
   
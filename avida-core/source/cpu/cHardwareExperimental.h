@@ -240,7 +240,7 @@ public:
   
   
   // --------  Core Execution Methods  --------
-  bool SingleProcess(cAvidaContext& ctx, bool speculative = false);
+  bool SingleProcess(cAvidaContext& ctx, bool speculative = false) { return (this->*m_single_process)(ctx, speculative); }
   void ProcessBonusInst(cAvidaContext& ctx, const cInstruction& inst);
   
   
@@ -312,6 +312,11 @@ public:
 private:
   
   // --------  Core Execution Methods  --------
+  typedef bool (cHardwareExperimental::*tSingleProcessMethod)(cAvidaContext& ctx, bool speculative);
+  static const tSingleProcessMethod s_single_process[];
+  tSingleProcessMethod m_single_process;
+  
+  template <int FEATURES> bool singleProcess(cAvidaContext& ctx, bool speculative);
   bool SingleProcess_ExecuteInst(cAvidaContext& ctx, const cInstruction& cur_inst);
   void internalReset();
   void internalResetOnFailedDivide();
@@ -309,6 +309,7 @@ cHardwareGX::cHardwareGX(cAvidaContext& ctx, cWorld* world, cOrganism* in_organi
 {
   m_last_unique_id_assigned = 0;
   m_functions = s_inst_slib->GetFunctions();
+  m_single_process = s_single_process[m_world->GetConfig().IMPLICIT_GENE_EXPRESSION.Get() ? EXEC_IMPLICIT_EXPRESSION : 0];
   Reset(ctx);   // Setup the rest of the hardware...also creates initial programid(s) from genome
 }
 
@@ -409,16 +410,17 @@ void cHardwareGX::internalResetOnFailedDivide()
 }
 
 /*! In cHardwareGX, SingleProcess is something of a misnomer.  Each time this method
-  is called, each cProgramid executes a single instruction.
+  is called, each cProgramid executes a single instruction.  It is instantiated with and
+  without EXEC_IMPLICIT_EXPRESSION.
   */
-bool cHardwareGX::SingleProcess(cAvidaContext& ctx, bool speculative)
+template <int FEATURES> bool cHardwareGX::singleProcess(cAvidaContext& ctx, bool speculative)
 {
   if (speculative) return false;
 
   cPhenotype& phenotype = m_organism->GetPhenotype();
 
   // Turn over programids if using the implicit model
-  if ( m_world->GetConfig().IMPLICIT_GENE_EXPRESSION.Get() )
+  if (FEATURES & EXEC_IMPLICIT_EXPRESSION)
   {
     m_recycle_state += (double)m_world->GetConfig().IMPLICIT_TURNOVER_RATE.Get();
     int num_programids = m_programids.size();
@@ -482,9 +484,10 @@ bool cHardwareGX::SingleProcess(cAvidaContext& ctx, bool speculative)
   m_current = 0;
   
   // Now kill old programids.
+  const int max_programid_age = m_world->GetConfig().MAX_PROGRAMID_AGE.Get();
   unsigned int on_p = 0;
   while(on_p < m_programids.size()) {
-    if(  ((m_world->GetConfig().MAX_PROGRAMID_AGE.Get() > 0) && (m_programids[on_p]->GetCPUCyclesUsed() > m_world->GetConfig().MAX_PROGRAMID_AGE.Get()) )
+    if(  ((max_programid_age > 0) && (m_programids[on_p]->GetCPUCyclesUsed() > max_programid_age) )
       || m_programids[on_p]->m_marked_for_death) {
       RemoveProgramid(on_p);
     } else {
@@ -515,6 +518,10 @@ bool cHardwareGX::SingleProcess(cAvidaContext& ctx, bool speculative)
   return true;
 }
 
+const cHardwareGX::tSingleProcessMethod cHardwareGX::s_single_process[] = {
+  &cHardwareGX::singleProcess<0x0>, &cHardwareGX::singleProcess<EXEC_IMPLICIT_EXPRESSION>
+};
+
 /*! This method executes one instruction for one programid. */
 bool cHardwareGX::SingleProcess_ExecuteInst(cAvidaContext& ctx, const cInstruction& cur_inst) 
 {
@@ -3130,12 +3137,12 @@ bool cHardwareGX::Inst_Bind(cAvidaContext& ctx)
 
   // Now, select another programid to match against.
   // Go through all *other* programids looking for matches 
-  std::vector<cMatchSite> all_matches;
+  std::vector<cMatchSite>& all_matches = m_bind_matches;
+  all_matches.clear();
   for(programid_list::iterator i=m_programids.begin(); i!=m_programids.end(); ++i) {
     // Don't bind to ourself, or to whatever programid our write head is attached to.
     if((*i != m_current) && ((*i)->GetID() != write.GetMemSpace())) {
-      std::vector<cMatchSite> matches = (*i)->Sites(GetLabel());
-      all_matches.insert(all_matches.end(), matches.begin(), matches.end());
+      (*i)->AppendSites(GetLabel(), all_matches);
     }
   }  
   
@@ -3174,9 +3181,11 @@ bool cHardwareGX::Inst_Bind2(cAvidaContext& ctx)
   
   // Search for matches to this label.
   std::vector<cMatchSite> bindable;
+  std::vector<cMatchSite>& matches = m_bind_matches;
   for(programid_list::iterator i=m_programids.begin(); i!=m_programids.end(); ++i) {
     if(*i != m_current) {
-      std::vector<cMatchSite> matches = (*i)->Sites(GetLabel());
+      matches.clear();
+      (*i)->AppendSites(GetLabel(), matches);
       // Now, we only want one match from each programid; we'll take a random one.
       if(matches.size()>0) {
         bindable.push_back(matches[ctx.GetRandom().GetInt(matches.size())]);
@@ -3249,7 +3258,7 @@ bool cHardwareGX::Inst_NumSites(cAvidaContext& ctx)
   int num_sites = 0;
   for(programid_list::iterator i=m_programids.begin(); i!=m_programids.end(); ++i) {
     if (*i != m_current) {
-      num_sites += (*i)->Sites(GetLabel()).size();
+      num_sites += (*i)->CountSites(GetLabel());
     }
   }  
   
@@ -3614,8 +3623,7 @@ bool cHardwareGX::Inst_ProgramidImplicitDivide(cAvidaContext& ctx)
   // Since the divide will now succeed, set up the information to be sent
   // to the new organism
   Sequence& child_genome = m_organism->OffspringGenome().GetSequence();
-  child_genome = m_programids[write_head.GetMemSpace()]->GetMemory();
-  child_genome = child_genome.Crop(0, child_end);
+  child_genome.Assign(m_programids[write_head.GetMemSpace()]->GetMemory(), 0, child_end);
   m_organism->OffspringGenome().SetHardwareType(GetType());
   m_organism->OffspringGenome().SetInstSet(m_inst_set->GetInstSetName());
 
@@ -3767,10 +3775,10 @@ bool cHardwareGX::Inst_HeadRepress(cAvidaContext& ctx)
 void cHardwareGX::AddProgramid(programid_ptr programid) 
 { 
   programid->m_id = m_programids.size();
+  m_programids.push_back(programid);   
   programid->ResetHeads();
 //  programid->ResetCPUCyclesUsed();
   programid->m_contacting_heads = 0;
-  m_programids.push_back(programid);   
 }
 
 
@@ -3998,6 +4006,7 @@ int cHardwareGX::FindRegulatoryMatch(const cCodeLabel& label)
 */
 cHardwareGX::cProgramid::cProgramid(const Sequence& genome, cHardwareGX* hardware)
 : m_gx_hardware(hardware)
+, m_id(-1)
 , m_unique_id(hardware->m_last_unique_id_assigned++)
 , m_executable(false)
 , m_bindable(false)
@@ -4008,11 +4017,10 @@ cHardwareGX::cProgramid::cProgramid(const Sequence& genome, cHardwareGX* hardwar
 , m_memory(genome)
 , m_input_buf(m_gx_hardware->m_world->GetEnvironment().GetInputSize())
 , m_output_buf(m_gx_hardware->m_world->GetEnvironment().GetOutputSize())
+, m_site_index_revision(0)
+, m_site_index_built(false)
 {
   assert(m_gx_hardware!=0);
-  for(int i=0; i<NUM_HEADS; ++i) {
-    m_heads[i].Reset(hardware);
-  }
 
   if (!m_gx_hardware->m_world->GetConfig().IMPLICIT_GENE_EXPRESSION.Get())
   {
@@ -4046,6 +4054,9 @@ cHardwareGX::cProgramid::cProgramid(const Sequence& genome, cHardwareGX* hardwar
 
 void cHardwareGX::cProgramid::ResetHeads() 
 {
+  // Heads can't be placed until AddProgramid gives this programid a memory space.
+  if(m_id < 0) return;
+  
   for(int i=0; i<NUM_HEADS; ++i) {
     m_heads[i].SetProgramid(this);
     m_heads[i].Reset(m_gx_hardware, m_id);
@@ -4097,77 +4108,114 @@ control how precisely the NOPs must be related (e.g., exact, all-but-one, etc.).
 std::vector<cHardwareGX::cMatchSite> cHardwareGX::cProgramid::Sites(const cCodeLabel& label) 
 {
   std::vector<cHardwareGX::cMatchSite> matches;
-  if(!m_bindable) return matches;
+  AppendSites(label, matches);
+  return matches;
+}
+
+
+/*! Appends this cProgramid's matches for the passed-in label to matches, without
+rescanning the genome unless it has changed since the last lookup.
+*/
+void cHardwareGX::cProgramid::AppendSites(const cCodeLabel& label, std::vector<cHardwareGX::cMatchSite>& matches)
+{
+  if(!m_bindable) return;
+  
+  const std::vector<cSiteEntry>& index = GetSiteIndex();
+  for(std::vector<cSiteEntry>::const_iterator i=index.begin(); i!=index.end(); ++i) {
+    if(i->m_label == label) {
+      cMatchSite match;
+      match.m_programid = this;
+      match.m_site = i->m_site; // We return is exactly on the site
+      match.m_label = i->m_label;
+      matches.push_back(match);
+    }
+  }
+}
+
+
+int cHardwareGX::cProgramid::CountSites(const cCodeLabel& label)
+{
+  if(!m_bindable) return 0;
   
-  cInstruction site_inst = m_gx_hardware->GetInstSet().GetInst("site");
+  int count = 0;
+  const std::vector<cSiteEntry>& index = GetSiteIndex();
+  for(std::vector<cSiteEntry>::const_iterator i=index.begin(); i!=index.end(); ++i) {
+    if(i->m_label == label) ++count;
+  }
+  return count;
+}
+
+
+/*! Returns every site in this cProgramid, rebuilding the index if the genome has been
+written since it was last built.
+
+A site is a "site" instruction followed by a run of NOPs; its label is that run of NOPs.
+The scan starts at the first non-NOP so that labels wrapping around the end of memory
+are read whole.
+*/
+const std::vector<cHardwareGX::cProgramid::cSiteEntry>& cHardwareGX::cProgramid::GetSiteIndex()
+{
+  if(m_site_index_built && m_site_index_revision == m_memory.GetRevision()) return m_site_index;
   
-  // Create a new search head at the beginning of our memory space
-  // \to do doesn't properly find wrap-around matches overlapping the origin of the memory
+  m_site_index.clear();
+  m_site_index_revision = m_memory.GetRevision();
+  m_site_index_built = true;
+  
+  // Scan through a const reference, since non-const access to the memory counts as a write
+  const cCPUMemory& memory = m_memory;
+  const cInstSet& inst_set = m_gx_hardware->GetInstSet();
+  const cInstruction site_inst = inst_set.GetInst("site");
+  const int size = memory.GetSize();
   
   //Find the first non-NOP and start there (this allows ups to wrap around correctly)
-  cHeadCPU search_head(m_gx_hardware, 0, m_id);
   int first_non_nop = -1;
-  do {
-    if ( !m_gx_hardware->m_inst_set->IsNop(search_head.GetInst()) )
-    {
-      first_non_nop = search_head.GetPosition();
+  for(int i=0; i<size; ++i) {
+    if(!inst_set.IsNop(memory[i])) {
+      first_non_nop = i;
       break;
     }
-    search_head++;
-  } while (search_head.GetPosition() != 0);
+  }
   
   // This genome is all NOPs...
-  if (first_non_nop == -1) return matches;
+  if (first_non_nop == -1) return m_site_index;
   
   //keep track of the first time we find a non-NOP instruction (finish when we reach it a second time)
   int site_pos = -1;
   cCodeLabel site_label;
   
   // Start at this instruction
-  search_head.Set(first_non_nop, m_id);
+  int pos = first_non_nop;
   do {
-  
-    if (search_head.GetInst() == site_inst)
+    const cInstruction& inst = memory[pos];
+    if (inst == site_inst)
     {
-      site_pos = search_head.GetPosition();
+      site_pos = pos;
       site_label.Clear();
     }
-    else if ( m_gx_hardware->m_inst_set->IsNop(search_head.GetInst()) && (site_pos != -1) )
+    else if ( inst_set.IsNop(inst) && (site_pos != -1) )
     {
       // Add NOPs to the current label
-      site_label.AddNop( m_gx_hardware->m_inst_set->GetNopMod( search_head.GetInst() ) );
+      site_label.AddNop( inst_set.GetNopMod(inst) );
     }
     else // Any other non-NOP instruction means to stop looking for terminator matches
     {
       site_pos = -1;
     }
-     
+    
+    pos = (pos + 1) % size;
+    
     // Is the next inst a NOP?
-    // If not, then check our current label for termination
-    if (site_pos != -1)
+    // If not, then the current label is complete
+    if (site_pos != -1 && !inst_set.IsNop(memory[pos]))
     {
-      int old_pos = search_head.GetPosition();
-      search_head++;
-      if ( !m_gx_hardware->m_inst_set->IsNop( search_head.GetInst()) )
-      {
-        if ( site_label == label )
-        {
-          cMatchSite match;
-          match.m_programid = this;
-          match.m_site = site_pos; // We return is exactly on the site
-          match.m_label = site_label;
-          matches.push_back(match);
-        }
-      }
-      
-      // Grrr. Heads don't wrap backwards properly!~! Can't just search_head--; No idea why.
-      search_head.Set(old_pos, m_id);
+      cSiteEntry entry;
+      entry.m_site = site_pos;
+      entry.m_label = site_label;
+      m_site_index.push_back(entry);
     }
-    
-    search_head++;
-  } while ( search_head.GetPosition() != first_non_nop ); // back at the beginning 
-
-  return matches;
+  } while ( pos != first_non_nop ); // back at the beginning 
+  
+  return m_site_index;
 }
 
 
@@ -143,6 +143,10 @@ public:
     
     //! Returns whether and where this cProgramid matches the passed-in label.
     std::vector<cHardwareGX::cMatchSite> Sites(const cCodeLabel& label);
+    //! Appends the sites matching the passed-in label to matches, in the order Sites() returns them.
+    void AppendSites(const cCodeLabel& label, std::vector<cHardwareGX::cMatchSite>& matches);
+    //! Counts the sites matching the passed-in label.
+    int CountSites(const cCodeLabel& label);
     //! Binds one of this cProgramid's heads to the passed-in match site.
     void Bind(nHardware::tHeads head, cMatchSite& site);
     //! Detaches this cProgramid's heads from bound cProgramids.
@@ -227,6 +231,22 @@ public:
     tBuffer<int> m_input_buf; //!< This programid's input buffer.
     tBuffer<int> m_output_buf; //!< This programid's output buffer.
 
+  private:
+    //! A site in this cProgramid's genome, with the label of NOPs that follows it.
+    struct cSiteEntry {
+      int m_site;
+      cCodeLabel m_label;
+    };
+    
+    /*! Every site in m_memory, as of revision m_site_index_revision of it.  Other programids
+    write into this genome through their heads; every such write moves the memory's revision,
+    so the index is rebuilt on use only when the revision has moved since it was built. */
+    std::vector<cSiteEntry> m_site_index;
+    unsigned int m_site_index_revision;
+    bool m_site_index_built;
+    
+    //! Returns the site index, rescanning m_memory first if it has changed.
+    const std::vector<cSiteEntry>& GetSiteIndex();
   };
   
 protected:
@@ -235,6 +255,7 @@ protected:
 
   programid_list m_programids; //!< The list of cProgramids.
   programid_ptr m_current; //!< The currently-executing cProgramid.
+  std::vector<cMatchSite> m_bind_matches; //!< Scratch list of candidate sites for the bind instructions.
   
   // Implicit RNAP Model only
   cHeadProgramid m_promoter_update_head; //Promoter position that last executable programid was created from.
@@ -256,6 +277,14 @@ protected:
   bool m_reset_inputs; // Flag to make it easy for instructions to reset all inputs (force task modularity).
   bool m_reset_heads;  // Flas to make it easy for instructions to reset heads back (force task modularity).
 
+  // --------  Execution Variants  --------
+  // Costs, promoters and cycle time don't apply here; the one run-constant branch is the implicit expression model.
+  enum { EXEC_IMPLICIT_EXPRESSION = 0x1 };
+  typedef bool (cHardwareGX::*tSingleProcessMethod)(cAvidaContext& ctx, bool speculative);
+  static const tSingleProcessMethod s_single_process[];
+  tSingleProcessMethod m_single_process;
+
+  template <int FEATURES> bool singleProcess(cAvidaContext& ctx, bool speculative);
   bool SingleProcess_ExecuteInst(cAvidaContext& ctx, const cInstruction& cur_inst);
   
   // --------  Stack Manipulation...  --------
@@ -310,7 +339,7 @@ public:
   static tInstLib<tMethod>* GetInstLib() { return s_inst_slib; }
   static cString GetDefaultInstFilename() { return "instset-gx.cfg"; }
 
-  bool SingleProcess(cAvidaContext& ctx, bool speculative = false);
+  bool SingleProcess(cAvidaContext& ctx, bool speculative = false) { return (this->*m_single_process)(ctx, speculative); }
   void ProcessBonusInst(cAvidaContext& ctx, const cInstruction& inst);
 
   
@@ -135,6 +135,9 @@ cHardwareSMT::cHardwareSMT(cAvidaContext& ctx, cWorld* world, cOrganism* in_orga
 , m_thread_lbls(Pow(NUM_NOPS, MAX_THREAD_LABEL) / THREAD_LBLS_HASH_FACTOR)
 {
   m_functions = s_inst_slib->GetFunctions();
+  
+  // Select the SingleProcess variant built for the features in use
+  m_single_process = s_single_process[m_has_any_costs ? EXEC_COSTS : 0];
 	
   m_mem_array[0] = in_organism->GetGenome().GetSequence();  // Initialize memory...
   m_mem_array[0].Resize(m_mem_array[0].GetSize() + 1);
@@ -192,7 +195,8 @@ cBioUnit* cHardwareSMT::ThreadGetOwner()
 
 // This function processes the very next command in the genome, and is made
 // to be as optimized as possible.  This is the heart of avida.
-bool cHardwareSMT::SingleProcess(cAvidaContext& ctx, bool speculative)
+// Instantiated with and without EXEC_COSTS
+template <int FEATURES> bool cHardwareSMT::singleProcess(cAvidaContext& ctx, bool speculative)
 {
   if (speculative) return false;
 
@@ -230,7 +234,8 @@ bool cHardwareSMT::SingleProcess(cAvidaContext& ctx, bool speculative)
 
     // Test if costs have been paid and it is okay to execute this now...
     int exec_success = 0;
-    bool exec = SingleProcess_PayPreCosts(ctx, cur_inst, m_cur_thread);
+    bool exec = true;
+    if (FEATURES & EXEC_COSTS) exec = SingleProcess_PayPreCosts(ctx, cur_inst, m_cur_thread);
     // record any failure due to costs being paid
     if (!exec) exec_success = -1;
 		
@@ -244,8 +249,10 @@ bool cHardwareSMT::SingleProcess(cAvidaContext& ctx, bool speculative)
       
       if (exec == true) {
         if (SingleProcess_ExecuteInst(ctx, cur_inst)) {
-          SingleProcess_PayPostResCosts(ctx, cur_inst); 
-          SingleProcess_SetPostCPUCosts(ctx, cur_inst, m_cur_thread); 
+          if (FEATURES & EXEC_COSTS) {
+            SingleProcess_PayPostResCosts(ctx, cur_inst); 
+            SingleProcess_SetPostCPUCosts(ctx, cur_inst, m_cur_thread); 
+          }
           // record execution success
           exec_success = 1;
         }
@@ -272,6 +279,11 @@ bool cHardwareSMT::SingleProcess(cAvidaContext& ctx, bool speculative)
   return true;
 }
 
+const cHardwareSMT::tSingleProcessMethod cHardwareSMT::s_single_process[] = {
+  &cHardwareSMT::singleProcess<0x0>, &cHardwareSMT::singleProcess<0x1>
+};
+
+
 // This method will handle the actual execution of an instruction
 // within single process, once that function has been finalized.
 bool cHardwareSMT::SingleProcess_ExecuteInst(cAvidaContext& ctx, const cInstruction& cur_inst) 
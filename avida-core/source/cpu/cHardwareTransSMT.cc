@@ -142,6 +142,9 @@ cHardwareTransSMT::cHardwareTransSMT(cAvidaContext& ctx, cWorld* world, cOrganis
 , m_thread_lbls(Pow(NUM_NOPS, MAX_THREAD_LABEL) / THREAD_LBLS_HASH_FACTOR)
 {
   m_functions = s_inst_slib->GetFunctions();
+  
+  // Select the SingleProcess variant built for the features in use
+  m_single_process = s_single_process[m_has_any_costs ? EXEC_COSTS : 0];
 	
   m_mem_array[0] = in_organism->GetGenome().GetSequence();  // Initialize memory...
   m_mem_array[0].Resize(m_mem_array[0].GetSize() + 1);
@@ -201,7 +204,8 @@ cBioUnit* cHardwareTransSMT::ThreadGetOwner()
 
 // This function processes the very next command in the genome, and is made
 // to be as optimized as possible.  This is the heart of avida.
-bool cHardwareTransSMT::SingleProcess(cAvidaContext& ctx, bool speculative)
+// Instantiated with and without EXEC_COSTS
+template <int FEATURES> bool cHardwareTransSMT::singleProcess(cAvidaContext& ctx, bool speculative)
 {
   if (speculative) return false;
   
@@ -267,7 +271,8 @@ bool cHardwareTransSMT::SingleProcess(cAvidaContext& ctx, bool speculative)
     const cInstruction& cur_inst = IP().GetInst();
 		
     // Test if costs have been paid and it is okay to execute this now...
-    bool exec = SingleProcess_PayPreCosts(ctx, cur_inst, m_cur_thread);
+    bool exec = true;
+    if (FEATURES & EXEC_COSTS) exec = SingleProcess_PayPreCosts(ctx, cur_inst, m_cur_thread);
 		
     // Now execute the instruction...
     if (exec == true) {
@@ -276,7 +281,7 @@ bool cHardwareTransSMT::SingleProcess(cAvidaContext& ctx, bool speculative)
         exec = !( ctx.GetRandom().P(m_inst_set->GetProbFail(cur_inst)) );
       }
       
-      if (exec == true) if (SingleProcess_ExecuteInst(ctx, cur_inst)) { 
+      if (exec == true) if (SingleProcess_ExecuteInst(ctx, cur_inst) && (FEATURES & EXEC_COSTS)) { 
         SingleProcess_PayPostResCosts(ctx, cur_inst); 
         SingleProcess_SetPostCPUCosts(ctx, cur_inst, m_cur_thread); 
       }
@@ -300,6 +305,11 @@ bool cHardwareTransSMT::SingleProcess(cAvidaContext& ctx, bool speculative)
   return true;
 }
 
+const cHardwareTransSMT::tSingleProcessMethod cHardwareTransSMT::s_single_process[] = {
+  &cHardwareTransSMT::singleProcess<0x0>, &cHardwareTransSMT::singleProcess<0x1>
+};
+
+
 // This method will handle the actual execution of an instruction
 // within single process, once that function has been finalized.
 bool cHardwareTransSMT::SingleProcess_ExecuteInst(cAvidaContext& ctx, const cInstruction& cur_inst) 
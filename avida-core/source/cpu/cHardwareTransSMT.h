@@ -102,6 +102,11 @@ protected:
   int m_cur_thread;
   int m_cur_child;
 
+  typedef bool (cHardwareTransSMT::*tSingleProcessMethod)(cAvidaContext& ctx, bool speculative);
+  static const tSingleProcessMethod s_single_process[];
+  tSingleProcessMethod m_single_process;
+  
+  template <int FEATURES> bool singleProcess(cAvidaContext& ctx, bool speculative);
   bool SingleProcess_ExecuteInst(cAvidaContext& ctx, const cInstruction& cur_inst);
   	
 
@@ -185,7 +190,7 @@ public:
   static cInstLib* GetInstLib() { return s_inst_slib; }
   static cString GetDefaultInstFilename() { return "instset-transsmt.cfg"; }
 	
-  bool SingleProcess(cAvidaContext& ctx, bool speculative = false);
+  bool SingleProcess(cAvidaContext& ctx, bool speculative = false) { return (this->*m_single_process)(ctx, speculative); }
   void ProcessBonusInst(cAvidaContext& ctx, const cInstruction& inst);
 	
   // --------  Helper methods  --------
@@ -51,6 +51,8 @@ cTestCPU::cTestCPU(cAvidaContext& ctx, cWorld* world)
 {
   m_world = world;
 	m_use_manual_inputs = false;
+  m_inputs_read = 0;
+  m_receives_read = 0;
   InitResources(ctx);
 }  
 
@@ -253,29 +255,38 @@ bool cTestCPU::TestGenome(cAvidaContext& ctx, cCPUTestInfo& test_info, const Gen
   return test_info.is_viable;
 }
 
-bool cTestCPU::TestGenome_Body(cAvidaContext& ctx, cCPUTestInfo& test_info, const Genome& genome, int cur_depth)
+void cTestCPU::DrawInputs(cAvidaContext& ctx, const cCPUTestInfo& test_info, tArray<int>& inputs, tArray<int>& receive) const
 {
-  assert(cur_depth < test_info.generation_tests);
-
-  // Input sizes can vary based on environment settings, must at least initialize
-  m_use_random_inputs = test_info.GetUseRandomInputs(); // save this value in case ResetInputs is used.
   if (!test_info.GetUseManualInputs())
-		m_world->GetEnvironment().SetupInputs(ctx, input_array, m_use_random_inputs);
+		m_world->GetEnvironment().SetupInputs(ctx, inputs, test_info.GetUseRandomInputs());
   else
-		input_array = test_info.manual_inputs;
+		inputs = test_info.manual_inputs;
 	
-  receive_array.Resize(3);
+  receive.Resize(3);
   if (test_info.GetUseRandomInputs()) {
-    receive_array[0] = (15 << 24) + ctx.GetRandom().GetUInt(1 << 24);  // 00001111
-    receive_array[1] = (51 << 24) + ctx.GetRandom().GetUInt(1 << 24);  // 00110011
-    receive_array[2] = (85 << 24) + ctx.GetRandom().GetUInt(1 << 24);  // 01010101
+    receive[0] = (15 << 24) + ctx.GetRandom().GetUInt(1 << 24);  // 00001111
+    receive[1] = (51 << 24) + ctx.GetRandom().GetUInt(1 << 24);  // 00110011
+    receive[2] = (85 << 24) + ctx.GetRandom().GetUInt(1 << 24);  // 01010101
   } else {
-    receive_array[0] = 0x0f139f14;  // 00001111 00010011 10011111 00010100
-    receive_array[1] = 0x33083ee5;  // 00110011 00001000 00111110 11100101
-    receive_array[2] = 0x5562eb41;  // 01010101 01100010 11101011 01000001
+    receive[0] = 0x0f139f14;  // 00001111 00010011 10011111 00010100
+    receive[1] = 0x33083ee5;  // 00110011 00001000 00111110 11100101
+    receive[2] = 0x5562eb41;  // 01010101 01100010 11101011 01000001
   }
+}
+
+bool cTestCPU::TestGenome_Body(cAvidaContext& ctx, cCPUTestInfo& test_info, const Genome& genome, int cur_depth)
+{
+  assert(cur_depth < test_info.generation_tests);
+
+  // Input sizes can vary based on environment settings, must at least initialize
+  m_use_random_inputs = test_info.GetUseRandomInputs(); // save this value in case ResetInputs is used.
+  DrawInputs(ctx, test_info, input_array, receive_array);
   
-	if (cur_depth == 0) test_info.used_inputs = input_array;
+	if (cur_depth == 0) {
+    test_info.used_inputs = input_array;
+    m_inputs_read = 0;
+    m_receives_read = 0;
+  }
 	
   if (cur_depth > test_info.max_depth) test_info.max_depth = cur_depth;
 
@@ -65,6 +65,8 @@ private:
   tArray<int> receive_array;
   int cur_input;
   int cur_receive;  
+  int m_inputs_read;    // Length of the prefix of input_array the organism has seen in this test
+  int m_receives_read;  // ...and likewise of receive_array
   bool m_use_random_inputs;
   bool m_use_manual_inputs;
   
@@ -107,10 +109,17 @@ public:
 
   inline int GetInput();
   inline int GetInputAt(int & input_pointer);
-  inline const tArray<int>& GetInputs() const { return input_array; }
+  inline const tArray<int>& GetInputs() { m_inputs_read = input_array.GetSize(); return input_array; }
   void ResetInputs(cAvidaContext& ctx);
 
   inline int GetReceiveValue();
+
+  // Draw the inputs and receive values a test with test_info would start from, just as TestGenome does
+  void DrawInputs(cAvidaContext& ctx, const cCPUTestInfo& test_info, tArray<int>& inputs, tArray<int>& receive) const;
+
+  // How many of the inputs and receive values (from the start of each) the last test's organisms could have seen
+  int GetNumInputsRead() const { return m_inputs_read; }
+  int GetNumReceivesRead() const { return m_receives_read; }
   inline const tArray<double>& GetResources(cAvidaContext& ctx); 
   inline const tArray<double>& GetAvatarResources(cAvidaContext& ctx); 
   inline const tArray<double>& GetFacedCellResources(cAvidaContext& ctx); 
@@ -131,18 +140,21 @@ public:
 inline int cTestCPU::GetInput()
 {
   if (cur_input >= input_array.GetSize()) cur_input = 0;
+  if (cur_input >= m_inputs_read) m_inputs_read = cur_input + 1;
   return input_array[cur_input++];
 }
 
 inline int cTestCPU::GetInputAt(int & input_pointer)
 {
   if (input_pointer >= input_array.GetSize()) input_pointer = 0;
+  if (input_pointer >= m_inputs_read) m_inputs_read = input_pointer + 1;
   return input_array[input_pointer++];
 }
 
 inline int cTestCPU::GetReceiveValue()
 {
   if (cur_receive >= receive_array.GetSize()) cur_receive = 0;
+  if (cur_receive >= m_receives_read) m_receives_read = cur_receive + 1;
   return receive_array[cur_receive++];
 }
 
@@ -77,7 +77,7 @@ public:
 
   bool GetLGTFragment(cAvidaContext& ctx, int region, const Genome& dest_genome, Sequence& seq) { return false; }
 
-  bool Divide(cAvidaContext& ctx, cOrganism* parent, const Genome& offspring_genome);
+  bool Divide(cAvidaContext& ctx, cOrganism* parent, Genome& offspring_genome);
   cOrganism* GetNeighbor() { return NULL; }
   bool IsNeighborCellOccupied() { return false; }
   int GetNumNeighbors() { return 0; }
@@ -0,0 +1,336 @@
+/*
+ *  cTestResultCache.cc
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cTestResultCache.h"
+
+#include "apto/core/FileSystem.h"
+
+#include "avida/core/Genome.h"
+
+#include "cAvidaConfig.h"
+#include "cCPUTestInfo.h"
+#include "cEnvironment.h"
+#include "cFileImage.h"
+#include "cHardwareManager.h"
+#include "cInstSet.h"
+#include "cStringUtil.h"
+#include "cWorld.h"
+
+#include <cstring>
+
+
+namespace {
+  // Bump the version whenever the layout of the file or of any record written into it changes
+  const char CACHE_MAGIC[4] = { 'A', 'T', 'R', 'C' };
+  const int CACHE_VERSION = 1;
+  const size_t HEADER_SIZE = sizeof(CACHE_MAGIC) + 2 * sizeof(int);
+  const size_t RECORD_HEADER_SIZE = 2 * sizeof(int);  // Key size, value size
+
+  // 32-bit FNV-1a
+  class cFNVHash
+  {
+  private:
+    unsigned int m_hash;
+
+  public:
+    cFNVHash() : m_hash(2166136261u) { ; }
+
+    void Add(const void* data, size_t size)
+    {
+      const unsigned char* bytes = static_cast<const unsigned char*>(data);
+      for (size_t i = 0; i < size; i++) m_hash = (m_hash ^ bytes[i]) * 16777619u;
+    }
+    void Add(int value) { Add(&value, sizeof(int)); }
+    void Add(double value) { Add(&value, sizeof(double)); }
+    void Add(const cString& str) { Add(str.GetSize()); Add((const char*)str, str.GetSize()); }
+
+    unsigned int Get() const { return m_hash; }
+  };
+
+  unsigned int hashKey(const char* key, int size)
+  {
+    cFNVHash hash;
+    hash.Add(key, size);
+    return hash.Get();
+  }
+}
+
+
+void cTestResultCache::cRecord::writeBytes(const void* src, int size)
+{
+  const int pos = m_data.GetSize();
+  m_data.Resize(pos + size);
+  memcpy(&m_data[pos], src, size);
+}
+
+bool cTestResultCache::cRecord::readBytes(void* dest, int size)
+{
+  if (m_pos + size > m_data.GetSize()) return false;
+  memcpy(dest, &m_data[m_pos], size);
+  m_pos += size;
+  return true;
+}
+
+void cTestResultCache::cRecord::Set(const char* data, int size)
+{
+  m_data.Resize(size);
+  if (size) memcpy(&m_data[0], data, size);
+  m_pos = 0;
+}
+
+void cTestResultCache::cRecord::Write(const tArray<int>& values)
+{
+  Write(values.GetSize());
+  if (values.GetSize()) writeBytes(&values[0], values.GetSize() * sizeof(int));
+}
+
+void cTestResultCache::cRecord::Write(const tArray<double>& values)
+{
+  Write(values.GetSize());
+  if (values.GetSize()) writeBytes(&values[0], values.GetSize() * sizeof(double));
+}
+
+void cTestResultCache::cRecord::Write(const cString& str)
+{
+  Write(str.GetSize());
+  if (str.GetSize()) writeBytes((const char*)str, str.GetSize());
+}
+
+bool cTestResultCache::cRecord::Read(tArray<int>& values)
+{
+  int size;
+  if (!Read(size) || size < 0 || m_pos + size * (int)sizeof(int) > m_data.GetSize()) return false;
+  values.Resize(size);
+  return (size == 0 || readBytes(&values[0], size * sizeof(int)));
+}
+
+bool cTestResultCache::cRecord::Read(tArray<double>& values)
+{
+  int size;
+  if (!Read(size) || size < 0 || m_pos + size * (int)sizeof(double) > m_data.GetSize()) return false;
+  values.Resize(size);
+  return (size == 0 || readBytes(&values[0], size * sizeof(double)));
+}
+
+bool cTestResultCache::cRecord::Read(cString& str)
+{
+  int size;
+  if (!Read(size) || size < 0 || m_pos + size > m_data.GetSize()) return false;
+  str = (size) ? cString(&m_data[m_pos], size) : cString();
+  m_pos += size;
+  return true;
+}
+
+
+
+cTestResultCache::cTestResultCache(cWorld* world, const cString& filename)
+  : m_filename(filename), m_image(NULL), m_image_size(0)
+{
+  openFile(filename, ConfigFingerprint(world));
+}
+
+cTestResultCache::cTestResultCache(const cString& filename, unsigned int fingerprint)
+  : m_filename(filename), m_image(NULL), m_image_size(0)
+{
+  openFile(filename, fingerprint);
+}
+
+cTestResultCache::~cTestResultCache()
+{
+  m_out.close();
+  delete m_image;
+}
+
+
+void cTestResultCache::openFile(const cString& filename, unsigned int fingerprint)
+{
+  char header[HEADER_SIZE];
+  memcpy(header, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+  memcpy(header + sizeof(CACHE_MAGIC), &CACHE_VERSION, sizeof(int));
+  memcpy(header + sizeof(CACHE_MAGIC) + sizeof(int), &fingerprint, sizeof(int));
+
+  m_image = new cFileImage(filename, false);
+  const char* data = m_image->GetData();
+  size_t valid = 0;
+  if (m_image->GetSize() >= HEADER_SIZE && memcmp(data, header, HEADER_SIZE) == 0) {
+    valid = HEADER_SIZE + indexRecords(data + HEADER_SIZE, m_image->GetSize() - HEADER_SIZE, HEADER_SIZE);
+  }
+
+  if (valid && valid == m_image->GetSize()) {
+    // Intact and current, new records simply go on the end
+    m_image_size = valid;
+    m_out.open(filename, std::ios::out | std::ios::binary | std::ios::app);
+    return;
+  }
+
+  // The file is missing, stale, or its last record was cut short.  Hold on to whatever records are usable (leaving the
+  // index offsets as they are) and write the file afresh.
+  if (valid > HEADER_SIZE) {
+    m_added.Resize(valid - HEADER_SIZE);
+    memcpy(&m_added[0], data + HEADER_SIZE, valid - HEADER_SIZE);
+  }
+  delete m_image;
+  m_image = NULL;
+  m_image_size = HEADER_SIZE;
+
+  m_out.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+  m_out.write(header, HEADER_SIZE);
+  if (m_added.GetSize()) m_out.write(&m_added[0], m_added.GetSize());
+}
+
+
+// Everything a test result depends upon besides the genome and the test settings named in its key
+unsigned int cTestResultCache::ConfigFingerprint(cWorld* world)
+{
+  cFNVHash hash;
+
+  // The files named in the settings are hashed by content as well, since they can change while their names do not
+  hash.Add((int)SettingsFingerprint(world->GetConfig()));
+
+  cString env_path(Apto::FileSystem::GetAbsolutePath(Apto::String(world->GetConfig().ENVIRONMENT_FILE.Get()),
+                                                     Apto::String(world->GetWorkingDir())));
+  cFileImage env_file(env_path);
+  hash.Add(env_file.GetData(), env_file.GetSize());
+
+  const cHardwareManager& hw_mgr = world->GetHardwareManager();
+  for (int i = 0; i < hw_mgr.GetNumInstSets(); i++) {
+    const cInstSet& inst_set = hw_mgr.GetInstSet(i);
+    hash.Add(inst_set.GetInstSetName());
+    hash.Add(inst_set.GetHardwareType());
+    for (int id = 0; id < inst_set.GetSize(); id++) {
+      const cInstruction inst(id);
+      hash.Add(inst_set.GetName(inst));
+      hash.Add(inst_set.GetRedundancy(inst));
+      hash.Add(inst_set.GetCost(inst));
+      hash.Add(inst_set.GetFTCost(inst));
+      hash.Add(inst_set.GetEnergyCost(inst));
+      hash.Add(inst_set.GetAddlTimeCost(inst));
+      hash.Add(inst_set.GetPostCost(inst));
+      hash.Add(inst_set.GetProbFail(inst));
+    }
+  }
+
+  return hash.Get();
+}
+
+unsigned int cTestResultCache::SettingsFingerprint(const cAvidaConfig& config)
+{
+  // Settings that only steer where output goes, plus the seed so that results carry over between replicate runs (tests
+  // that draw random inputs are never cached, see BuildKey)
+  static const char* const ignored[] = { "VERBOSITY", "DATA_DIR", "TEST_RESULT_CACHE", "RANDOM_SEED", NULL };
+
+  tArray<cString> names;
+  tArray<cString> values;
+  config.GetSettings(names, values);
+
+  cFNVHash hash;
+  for (int i = 0; i < names.GetSize(); i++) {
+    bool skip = false;
+    for (int j = 0; ignored[j] != NULL; j++) if (names[i] == ignored[j]) skip = true;
+    if (skip) continue;
+    hash.Add(names[i]);
+    hash.Add(values[i]);
+  }
+  return hash.Get();
+}
+
+
+// Index the complete records at the front of data, returning the number of bytes they occupy
+size_t cTestResultCache::indexRecords(const char* data, size_t size, size_t offset)
+{
+  size_t pos = 0;
+  while (pos + RECORD_HEADER_SIZE <= size) {
+    int key_size, value_size;
+    memcpy(&key_size, data + pos, sizeof(int));
+    memcpy(&value_size, data + pos + sizeof(int), sizeof(int));
+    if (key_size < 0 || value_size < 0) break;
+
+    const size_t end = pos + RECORD_HEADER_SIZE + key_size + value_size;
+    if (end > size) break;
+
+    m_index.insert(std::make_pair(hashKey(data + pos + RECORD_HEADER_SIZE, key_size), offset + pos));
+    pos = end;
+  }
+  return pos;
+}
+
+const char* cTestResultCache::recordAt(size_t offset) const
+{
+  return (offset < m_image_size) ? m_image->GetData() + offset : &m_added[offset - m_image_size];
+}
+
+
+bool cTestResultCache::BuildKey(const cString& kind, const Genome& genome, const cCPUTestInfo& test_info, cString& key)
+{
+  // Only tests that would turn out the same every time are worth keeping
+  if (test_info.GetTraceExecution() || test_info.GetUseRandomInputs() || test_info.GetResourceMethod() != RES_INITIAL) {
+    return false;
+  }
+
+  key = cStringUtil::Stringf("%s:%d:%d:", (const char*)kind, test_info.GetGenerationTests(), test_info.GetTraceTaskOrder());
+  if (test_info.GetUseManualInputs()) {
+    const tArray<int>& inputs = test_info.GetManualInputs();
+    for (int i = 0; i < inputs.GetSize(); i++) key += cStringUtil::Stringf("%d,", inputs[i]);
+  }
+  key += ":";
+  key += genome.AsString();
+  return true;
+}
+
+
+bool cTestResultCache::Find(const cString& key, cRecord& record)
+{
+  typedef std::multimap<unsigned int, size_t>::const_iterator tIndexIterator;
+
+  const unsigned int hash = hashKey(key, key.GetSize());
+  Apto::MutexAutoLock lock(m_mutex);
+  std::pair<tIndexIterator, tIndexIterator> range = m_index.equal_range(hash);
+  for (tIndexIterator it = range.first; it != range.second; ++it) {
+    const char* rec = recordAt(it->second);
+    int key_size, value_size;
+    memcpy(&key_size, rec, sizeof(int));
+    memcpy(&value_size, rec + sizeof(int), sizeof(int));
+    if (key_size != key.GetSize() || memcmp(rec + RECORD_HEADER_SIZE, (const char*)key, key_size) != 0) continue;
+
+    record.Set(rec + RECORD_HEADER_SIZE + key_size, value_size);
+    return true;
+  }
+  return false;
+}
+
+void cTestResultCache::Add(const cString& key, const cRecord& record)
+{
+  const int key_size = key.GetSize();
+  const int value_size = record.GetSize();
+  const int total = RECORD_HEADER_SIZE + key_size + value_size;
+
+  Apto::MutexAutoLock lock(m_mutex);
+  const int start = m_added.GetSize();
+  const size_t offset = m_image_size + start;
+  m_added.Resize(start + total);
+  char* rec = &m_added[start];
+  memcpy(rec, &key_size, sizeof(int));
+  memcpy(rec + sizeof(int), &value_size, sizeof(int));
+  memcpy(rec + RECORD_HEADER_SIZE, (const char*)key, key_size);
+  if (value_size) memcpy(rec + RECORD_HEADER_SIZE + key_size, record.GetData(), value_size);
+
+  m_index.insert(std::make_pair(hashKey(key, key_size), offset));
+  m_out.write(rec, total);
+}
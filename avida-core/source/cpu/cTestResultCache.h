@@ -0,0 +1,133 @@
+/*
+ *  cTestResultCache.h
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cTestResultCache_h
+#define cTestResultCache_h
+
+#include "apto/core/Mutex.h"
+
+#ifndef cString_h
+#include "cString.h"
+#endif
+#ifndef tArray_h
+#include "tArray.h"
+#endif
+#ifndef tSmartArray_h
+#include "tSmartArray.h"
+#endif
+
+#include <fstream>
+#include <map>
+
+
+namespace Avida {
+  class Genome;
+};
+
+class cAvidaConfig;
+class cCPUTestInfo;
+class cFileImage;
+class cWorld;
+
+using namespace Avida;
+
+
+/**
+ * Results of test CPU runs, kept on disk so that they can be reused by later runs and analyze sessions.
+ *
+ * The file holds a header and a log of key/value records.  On opening, the file is memory mapped and scanned to index
+ * the records it holds; records added afterwards are appended to it.  The header carries a fingerprint of everything
+ * outside the key that a test result depends upon -- every configuration setting that can affect a test, along with the
+ * contents of the environment file and the instruction sets.  Should any of these change, the old records are
+ * discarded.
+ **/
+class cTestResultCache
+{
+public:
+  // A flat buffer of values, read back in the order they were written
+  class cRecord
+  {
+  private:
+    tSmartArray<char> m_data;
+    int m_pos;
+
+    void writeBytes(const void* src, int size);
+    bool readBytes(void* dest, int size);
+
+  public:
+    cRecord() : m_pos(0) { ; }
+
+    void Clear() { m_data.Resize(0); m_pos = 0; }
+    void Set(const char* data, int size);
+    int GetSize() const { return m_data.GetSize(); }
+    const char* GetData() const { return (m_data.GetSize()) ? &m_data[0] : NULL; }
+
+    void Write(int value) { writeBytes(&value, sizeof(int)); }
+    void Write(double value) { writeBytes(&value, sizeof(double)); }
+    void Write(const tArray<int>& values);
+    void Write(const tArray<double>& values);
+    void Write(const cString& str);
+
+    bool Read(int& value) { return readBytes(&value, sizeof(int)); }
+    bool Read(double& value) { return readBytes(&value, sizeof(double)); }
+    bool Read(tArray<int>& values);
+    bool Read(tArray<double>& values);
+    bool Read(cString& str);
+  };
+
+private:
+  cString m_filename;
+  cFileImage* m_image;        // Records found in the file when it was opened
+  size_t m_image_size;
+  tSmartArray<char> m_added;  // Records added since, which follow the image in the file
+  std::ofstream m_out;
+  std::multimap<unsigned int, size_t> m_index;  // Key hash -> record offset within the file
+  Apto::Mutex m_mutex;
+
+
+  cTestResultCache(); // @not_implemented
+  cTestResultCache(const cTestResultCache&); // @not_implemented
+  cTestResultCache& operator=(const cTestResultCache&); // @not_implemented
+
+  void openFile(const cString& filename, unsigned int fingerprint);
+  size_t indexRecords(const char* data, size_t size, size_t offset);
+  const char* recordAt(size_t offset) const;
+
+public:
+  cTestResultCache(cWorld* world, const cString& filename);
+  cTestResultCache(const cString& filename, unsigned int fingerprint);
+  ~cTestResultCache();
+
+  //! Fingerprint of everything outside the key that the results of tests in world depend upon
+  static unsigned int ConfigFingerprint(cWorld* world);
+  //! Fingerprint of the configuration settings, leaving out those that cannot affect a test (output locations, etc.)
+  static unsigned int SettingsFingerprint(const cAvidaConfig& config);
+
+  bool IsOpen() const { return m_out.good(); }
+  int GetNumRecords() const { return (int)m_index.size(); }
+
+  //! Build the key for a test of genome, or return false if the test settings make its results unrepeatable
+  static bool BuildKey(const cString& kind, const Genome& genome, const cCPUTestInfo& test_info, cString& key);
+
+  bool Find(const cString& key, cRecord& record);
+  void Add(const cString& key, const cRecord& record);
+};
+
+#endif
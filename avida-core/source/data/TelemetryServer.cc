@@ -0,0 +1,309 @@
+/*
+ *  data/TelemetryServer.cc
+ *  avida-core
+ *
+ *  Copyright 2011 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "avida/data/TelemetryServer.h"
+
+#include "avida/data/Package.h"
+
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#if APTO_PLATFORM(UNIX) && APTO_PLATFORM(THREADS)
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+
+namespace {
+  struct TelemetryClient {
+    int fd;
+    int next_line;         // Sequence number of the next line to send
+    std::string pending;   // Line currently being sent...
+    size_t sent;           // ...and how much of it has gone out
+  };
+  
+  // Does the string follow the JSON number grammar?  (Rules out nan, inf, hex and the like)
+  bool isJSONNumber(const char* str)
+  {
+    if (*str == '-') str++;
+    if (!isdigit(*str)) return false;
+    while (isdigit(*str)) str++;
+    if (*str == '.') {
+      str++;
+      if (!isdigit(*str)) return false;
+      while (isdigit(*str)) str++;
+    }
+    if (*str == 'e' || *str == 'E') {
+      str++;
+      if (*str == '+' || *str == '-') str++;
+      if (!isdigit(*str)) return false;
+      while (isdigit(*str)) str++;
+    }
+    return *str == '\0';
+  }
+
+  void appendJSONString(std::string& line, const char* str)
+  {
+    line += '"';
+    for (; *str; str++) {
+      const unsigned char c = *str;
+      if (c == '"' || c == '\\') {
+        line += '\\';
+        line += c;
+      } else if (c < 0x20) {
+        char escape[8];
+        sprintf(escape, "\\u%04x", c);
+        line += escape;
+      } else {
+        line += c;
+      }
+    }
+    line += '"';
+  }
+
+  // Numbers are written as they are, anything else as a string, and missing values as null
+  void appendJSONValue(std::string& line, Avida::Data::PackagePtr value)
+  {
+    if (!value) {
+      line += "null";
+      return;
+    }
+    const Apto::String str = value->StringValue();
+    if (isJSONNumber(str)) line += static_cast<const char*>(str);
+    else appendJSONString(line, str);
+  }
+}
+
+
+Avida::Data::TelemetryServer::TelemetryServer(const Apto::String& path, ConstDataSetPtr requested, int buffer_lines)
+  : m_path(path), m_requested(requested), m_listen_fd(-1), m_ring((buffer_lines > 0) ? buffer_lines : 1)
+  , m_next_line(0), m_done(false)
+{
+  m_wake_fd[0] = m_wake_fd[1] = -1;
+}
+
+Avida::Data::TelemetryServer::~TelemetryServer()
+{
+#if APTO_PLATFORM(UNIX) && APTO_PLATFORM(THREADS)
+  m_mutex.Lock();
+  m_done = true;
+  m_mutex.Unlock();
+  if (m_wake_fd[1] >= 0) {
+    const char wake = 0;
+    write(m_wake_fd[1], &wake, 1);
+  }
+  Join();
+#endif
+  closeSocket();
+}
+
+
+bool Avida::Data::TelemetryServer::Open()
+{
+#if APTO_PLATFORM(UNIX) && APTO_PLATFORM(THREADS)
+  sockaddr_un addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if (m_path.GetSize() == 0 || m_path.GetSize() >= (int)sizeof(addr.sun_path)) return false;
+  strcpy(addr.sun_path, m_path);
+
+  // Clear out a socket left behind by an earlier run, but never anything else
+  struct stat st;
+  if (lstat(m_path, &st) == 0 && S_ISSOCK(st.st_mode)) unlink(m_path);
+
+  m_listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (m_listen_fd < 0) return false;
+  if (bind(m_listen_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+    ::close(m_listen_fd);
+    m_listen_fd = -1;
+    return false;
+  }
+  if (listen(m_listen_fd, 8) != 0 || pipe(m_wake_fd) != 0) {
+    closeSocket();
+    return false;
+  }
+  fcntl(m_listen_fd, F_SETFL, fcntl(m_listen_fd, F_GETFL) | O_NONBLOCK);
+  fcntl(m_wake_fd[0], F_SETFL, fcntl(m_wake_fd[0], F_GETFL) | O_NONBLOCK);
+  fcntl(m_wake_fd[1], F_SETFL, fcntl(m_wake_fd[1], F_GETFL) | O_NONBLOCK);
+
+  if (!Start()) {
+    closeSocket();
+    return false;
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+
+void Avida::Data::TelemetryServer::NotifyData(Update current_update, DataRetrievalFunctor retrieve_data)
+{
+  if (m_listen_fd < 0) return;
+
+  std::string line("{\"update\":");
+  line += static_cast<const char*>(Apto::String(Apto::AsStr(current_update)));
+  for (ConstDataSetIterator it = m_requested->Begin(); it.Next();) {
+    line += ',';
+    appendJSONString(line, *it.Get());
+    line += ':';
+    appendJSONValue(line, retrieve_data(*it.Get()));
+  }
+  line += "}\n";
+
+  m_mutex.Lock();
+  m_ring[m_next_line % m_ring.GetSize()].swap(line);
+  m_next_line++;
+  m_mutex.Unlock();
+
+#if APTO_PLATFORM(UNIX) && APTO_PLATFORM(THREADS)
+  // If the pipe is already full the server has a wakeup pending anyway
+  const char wake = 0;
+  write(m_wake_fd[1], &wake, 1);
+#endif
+}
+
+
+void Avida::Data::TelemetryServer::Run()
+{
+#if APTO_PLATFORM(UNIX) && APTO_PLATFORM(THREADS)
+  std::vector<TelemetryClient> clients;
+  std::vector<pollfd> fds;
+
+  while (true) {
+    m_mutex.Lock();
+    const bool done = m_done;
+    m_mutex.Unlock();
+    if (done) break;
+
+    // Send each client as much as it will take without blocking
+    for (size_t i = 0; i < clients.size(); i++) {
+      TelemetryClient& client = clients[i];
+      while (client.fd >= 0) {
+        if (client.sent == client.pending.size()) {
+          m_mutex.Lock();
+          const int oldest = m_next_line - m_ring.GetSize();
+          if (client.next_line < oldest) client.next_line = oldest;
+          const bool have_line = (client.next_line < m_next_line);
+          if (have_line) client.pending = m_ring[client.next_line++ % m_ring.GetSize()];
+          m_mutex.Unlock();
+          if (!have_line) break;
+          client.sent = 0;
+        }
+
+        int flags = 0;
+#ifdef MSG_NOSIGNAL
+        flags = MSG_NOSIGNAL;
+#endif
+        const ssize_t rval = send(client.fd, client.pending.data() + client.sent, client.pending.size() - client.sent, flags);
+        if (rval > 0) {
+          client.sent += rval;
+        } else if (rval < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+          break;
+        } else {
+          ::close(client.fd);
+          client.fd = -1;
+        }
+      }
+    }
+    for (size_t i = 0; i < clients.size();) {
+      if (clients[i].fd < 0) {
+        clients[i] = clients.back();
+        clients.pop_back();
+      } else {
+        i++;
+      }
+    }
+
+    // Wait for a new line, a new client, or for a client to drain or disconnect
+    fds.resize(2 + clients.size());
+    fds[0].fd = m_wake_fd[0];
+    fds[0].events = POLLIN;
+    fds[1].fd = m_listen_fd;
+    fds[1].events = POLLIN;
+    for (size_t i = 0; i < clients.size(); i++) {
+      fds[2 + i].fd = clients[i].fd;
+      fds[2 + i].events = POLLIN | ((clients[i].sent < clients[i].pending.size()) ? POLLOUT : 0);
+    }
+    for (size_t i = 0; i < fds.size(); i++) fds[i].revents = 0;
+    if (poll(&fds[0], fds.size(), -1) < 0 && errno != EINTR) break;
+
+    if (fds[0].revents) {
+      char buf[256];
+      while (read(m_wake_fd[0], buf, sizeof(buf)) > 0) ;
+    }
+
+    // Anything a client sends is ignored; a read of zero means it hung up
+    for (size_t i = 0; i < clients.size(); i++) {
+      if (!(fds[2 + i].revents & (POLLIN | POLLHUP | POLLERR))) continue;
+      char buf[256];
+      const ssize_t rval = read(clients[i].fd, buf, sizeof(buf));
+      if (rval == 0 || (rval < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+        ::close(clients[i].fd);
+        clients[i].fd = -1;
+      }
+    }
+
+    if (fds[1].revents & POLLIN) {
+      int fd;
+      while ((fd = accept(m_listen_fd, NULL, NULL)) >= 0) {
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+#ifdef SO_NOSIGPIPE
+        int on = 1;
+        setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+        TelemetryClient client;
+        client.fd = fd;
+        m_mutex.Lock();
+        client.next_line = m_next_line;
+        m_mutex.Unlock();
+        client.sent = 0;
+        clients.push_back(client);
+      }
+    }
+  }
+
+  for (size_t i = 0; i < clients.size(); i++) if (clients[i].fd >= 0) ::close(clients[i].fd);
+#endif
+}
+
+
+void Avida::Data::TelemetryServer::closeSocket()
+{
+#if APTO_PLATFORM(UNIX) && APTO_PLATFORM(THREADS)
+  if (m_listen_fd >= 0) {
+    ::close(m_listen_fd);
+    m_listen_fd = -1;
+    unlink(m_path);
+  }
+  for (int i = 0; i < 2; i++) {
+    if (m_wake_fd[i] >= 0) ::close(m_wake_fd[i]);
+    m_wake_fd[i] = -1;
+  }
+#endif
+}
@@ -21,6 +21,9 @@
 
 #include "cDefaultRunDriver.h"
 
+#include "avida/data/Manager.h"
+#include "avida/data/TelemetryServer.h"
+
 #include "cAvidaContext.h"
 #include "cBGGenotype.h"
 #include "cClassificationManager.h"
@@ -50,6 +53,8 @@ m_fastforward(false),m_last_generation(0),  m_generation_same_update_count(0)
   // Save this config variable
   m_generation_update_fastforward_threshold = m_world->GetConfig().FASTFORWARD_UPDATES.Get();
   m_population_fastforward_threshold = m_world->GetConfig().FASTFORWARD_NUM_ORGS.Get();
+  
+  if (m_world->GetConfig().TELEMETRY_SOCKET.Get().GetSize()) setupTelemetry();
 }
 
 cDefaultRunDriver::~cDefaultRunDriver()
@@ -90,6 +95,7 @@ void cDefaultRunDriver::Run()
     if (stats.GetUpdate() > 0) {
       // Tell the stats object to do update calculations and printing.
       stats.ProcessUpdate();
+      m_world->GetDataManager().UpdateState(stats.GetUpdate());
     }
     
     // don't process organisms if we are in fast-forward mode. -- @JEB
@@ -99,11 +105,15 @@ void cDefaultRunDriver::Run()
       const int UD_size = m_world->CalculateUpdateSize();
       const double step_size = 1.0 / (double) UD_size;
       
-      for (int i = 0; i < UD_size; i++) {
-        if(population.GetNumOrganisms() == 0) {
-          break;
+      if (population.UsesDemePartitions()) {
+        population.ProcessDemePartitions(ctx, UD_size);
+      } else {
+        for (int i = 0; i < UD_size; i++) {
+          if(population.GetNumOrganisms() == 0) {
+            break;
+          }
+          (population.*ActiveProcessStep)(ctx, step_size, population.ScheduleOrganism());
         }
-        (population.*ActiveProcessStep)(ctx, step_size, population.ScheduleOrganism());
       }
     }
     
@@ -157,6 +167,29 @@ void cDefaultRunDriver::Run()
   }
 }
 
+void cDefaultRunDriver::setupTelemetry()
+{
+  const cString& path = m_world->GetConfig().TELEMETRY_SOCKET.Get();
+  
+  Data::DataSetPtr requested(new Data::DataSet);
+  cString data_ids = m_world->GetConfig().TELEMETRY_DATA.Get();
+  while (data_ids.GetSize()) {
+    cString data_id = data_ids.Pop(',');
+    data_id.Trim();
+    if (data_id.GetSize()) requested->Insert((const char*)data_id);
+  }
+  
+  Data::TelemetryServer* server =
+    new Data::TelemetryServer((const char*)path, requested, m_world->GetConfig().TELEMETRY_BUFFER.Get());
+  Data::RecorderPtr recorder(server);
+  if (!m_world->GetDataManager().AttachRecorder(recorder)) {
+    NotifyWarning(cString("telemetry disabled, unknown data value in TELEMETRY_DATA '") + m_world->GetConfig().TELEMETRY_DATA.Get() + "'");
+  } else if (!server->Open()) {
+    m_world->GetDataManager().DetachRecorder(recorder);
+    NotifyWarning(cString("telemetry disabled, unable to open socket '") + path + "'");
+  }
+}
+
 void cDefaultRunDriver::RaiseException(const cString& in_string)
 {
   cerr << "Error: " << in_string << endl;
@@ -67,6 +67,9 @@ public:
   void ClearFastForward() { m_fastforward = false; m_generation_same_update_count = 0; }
   void UpdateFastForward (double inGeneration, int population);
   bool GetFastForward() { return m_fastforward; }
+  
+private:
+  void setupTelemetry();
 
 };
 
@@ -50,6 +50,7 @@ cAvidaConfig::cBaseConfigEntry::cBaseConfigEntry(const cString& _name,
 , default_value(_def)
 , description(_desc)
 , use_overide(true)
+, m_revision(NULL)
 {
   config_name[0] = _name;
   
@@ -378,6 +379,37 @@ bool cAvidaConfig::Get(const cString& entry, cString& ret) const
   return false;
 }
 
+void cAvidaConfig::setupRevisionCounter()
+{
+  // Now that the entries are ours, have each count its changes against this config
+  tListIterator<cBaseConfigGroup> group_it(m_group_list);
+  cBaseConfigGroup* cur_group;
+  while ((cur_group = group_it.Next()) != NULL) {
+    tListIterator<cBaseConfigEntry> entry_it(cur_group->GetEntryList());
+    cBaseConfigEntry* cur_entry;
+    while ((cur_entry = entry_it.Next()) != NULL) cur_entry->SetRevisionCounter(&m_revision);
+  }
+}
+
+
+void cAvidaConfig::GetSettings(tArray<cString>& names, tArray<cString>& values) const
+{
+  names.Resize(0);
+  values.Resize(0);
+  
+  // Loop through all groups, then all entries, collecting each one in the order they were declared.
+  tConstListIterator<cBaseConfigGroup> group_it(m_group_list);
+  const cBaseConfigGroup* cur_group;
+  while ((cur_group = group_it.Next()) != NULL) {
+    tConstListIterator<cBaseConfigEntry> entry_it(cur_group->GetEntryList());
+    const cBaseConfigEntry* cur_entry;
+    while ((cur_entry = entry_it.Next()) != NULL) {
+      names.Push(cur_entry->GetName());
+      values.Push(cur_entry->AsString());
+    }
+  }
+}
+
 
 bool cAvidaConfig::Set(const cString& entry, const cString& val)
 {
@@ -76,6 +76,7 @@ private:                                                                      \
 public:                                                                       \
   void LoadStr(const cString& str_value) {                         /* 4 */ \
     value = cStringUtil::Convert(str_value, value);                           \
+    Changed();                                                                \
   }                                                                           \
   bool EqualsString(const cString& str_value) const {                 /* 5 */ \
     return (value == cStringUtil::Convert(str_value, value));                 \
@@ -84,8 +85,8 @@ public:                                                                       \
     LoadStr(GetDefault());                                         /* 7 */ \
     global_group_list.GetLast()->AddEntry(this);                      /* 8 */ \
   }                                                                           \
-  TYPE Get() const { return value; }                                  /* 9 */ \
-  void Set(TYPE in_value) { value = in_value; }                               \
+  const TYPE& Get() const { return value; }                           /* 9 */ \
+  void Set(TYPE in_value) { value = in_value; Changed(); }                    \
   cString AsString() const { return cStringUtil::Convert(value); }    /* 10 */\
 } NAME                                                                /* 11 */\
 
@@ -152,6 +153,8 @@ private:
     // those classes?
     bool use_overide;
     
+    unsigned int* m_revision;     // Revision count of the config holding this entry
+    
   public:
     cBaseConfigEntry(const cString& _name, const cString& _type, const cString& _def, const cString& _desc);
     virtual ~cBaseConfigEntry() { ; }
@@ -168,6 +171,8 @@ private:
     int GetNumNames() const { return config_name.GetSize(); }
 
     void AddAlias(const cString & alias) { config_name.Push(alias); }
+    void SetRevisionCounter(unsigned int* revision) { m_revision = revision; }
+    void Changed() { if (m_revision) (*m_revision)++; }
 
     virtual cString AsString() const = 0;
   };
@@ -256,13 +261,18 @@ private:
   tList<cBaseConfigGroup> m_group_list;
   tList<cBaseConfigCustomFormat> m_format_list;
   
+  unsigned int m_revision;  // Bumped whenever one of this config's settings is changed
+  
+  void setupRevisionCounter();
+  
   
 public:
-  cAvidaConfig()
+  cAvidaConfig() : m_revision(0)
   {
     m_group_list.Transfer(global_group_list);
     m_format_list.Transfer(global_format_list);
     global_list_mutex.Unlock();
+    setupRevisionCounter();
   }
   ~cAvidaConfig() { ; }
   
@@ -285,6 +295,9 @@ public:
   CONFIG_ADD_VAR(SPECULATIVE, bool, 1, "Enable speculative execution\n(pre-execute instructions that don't affect other organisms)");
   CONFIG_ADD_VAR(POPULATION_CAP, int, 0, "Carrying capacity in number of organisms (use 0 for no cap)");
   CONFIG_ADD_VAR(POP_CAP_ELDEST, int, 0, "Carrying capacity in number of organisms (use 0 for no cap). Will kill oldest organism in population, but still use birth method to place new offspring."); 
+  CONFIG_ADD_VAR(TELEMETRY_SOCKET, cString, "", "Unix domain socket on which to stream per-update statistics\nas JSON lines (empty = disabled)");
+  CONFIG_ADD_VAR(TELEMETRY_DATA, cString, "core.world.organisms,core.world.ave_fitness,core.world.ave_generation", "Comma separated data values to stream on TELEMETRY_SOCKET");
+  CONFIG_ADD_VAR(TELEMETRY_BUFFER, int, 64, "Updates of telemetry held for slow clients; clients further behind skip ahead");
   
   
   // -------- Topology config options --------
@@ -369,6 +382,7 @@ public:
   CONFIG_ADD_VAR(BIRTH_METHOD, int, 0, "Which organism should be replaced when a birth occurs?\n0 = Random organism in neighborhood\n1 = Oldest in neighborhood\n2 = Largest Age/Merit in neighborhood\n3 = None (use only empty cells in neighborhood)\n4 = Random from population (Mass Action)\n5 = Oldest in entire population\n6 = Random within deme\n7 = Organism faced by parent\n8 = Next grid cell (id+1)\n9 = Largest energy used in entire population\n10 = Largest energy used in neighborhood\n11 = Local neighborhood dispersal\n12 = Kill offpsring after recording birth stats (for behavioral trials)\n13 = Kill parent and offpsring (for behavioral trials)");
   CONFIG_ADD_VAR(PREFER_EMPTY, int, 1, "Overide BIRTH_METHOD to preferentially choose empty cells for offsping?");
   CONFIG_ADD_VAR(ALLOW_PARENT, int, 1, "Should parents be considered when deciding where to place offspring?");
+  CONFIG_ADD_VAR(DEFERRED_BIRTHS, int, 0, "Hold offspring until the end of the update and place them together?\n0 = No, place each offspring as it is born\n1 = Yes; a cell targeted by several births goes to the first of them\n(Ignored with more than one deme, USE_AVATARS, USE_FORM_GROUPS or offspring\nEPIGENETIC_METHOD)");
   CONFIG_ADD_VAR(DISPERSAL_RATE, double, 0.0, "Rate of dispersal under birth method 11\n(poisson distributed random connection list hops)");
   CONFIG_ADD_VAR(DEATH_PROB, double, 0.0, "Probability of death when dividing.");
   CONFIG_ADD_VAR(DEATH_METHOD, int, 2, "When should death by old age occur?\n0 = Never\n1 = When executed AGE_LIMIT (+deviation) total instructions\n2 = When executed genome_length * AGE_LIMIT (+dev) instructions");
@@ -469,6 +483,7 @@ public:
   CONFIG_ADD_GROUP(MP_GROUP, "Config options for multiple, distributed populations");
   CONFIG_ADD_VAR(ENABLE_MP, int, 0, "Enable multi-process Avida; 0=disabled (default),\n1=enabled.");
   CONFIG_ADD_VAR(MP_SCHEDULING_STYLE, int, 0, "Style of scheduling:\n0=non-MP aware (default)\n1=MP aware, integrated across worlds.");
+  CONFIG_ADD_VAR(MP_LOAD_BALANCE_INTERVAL, int, 0, "Number of updates between load balancing steps, which move organisms\nfrom slower to faster worlds; 0=disabled (default).\nRequires mass action (BIRTH_METHOD 4).  Moved organisms keep only their genome,\nmerit, generation and lineage label; like injected organisms, they start over\nwith a new phenotype (task counts, age) and fresh hardware.");
 	
   
   // -------- Deme config options --------
@@ -513,6 +528,7 @@ public:
   CONFIG_ADD_VAR(DEMES_TRACK_SHANNON_INFO, int, 0, "Enable shannon mutual information tracking for demes.");
   CONFIG_ADD_VAR(DEMES_MUT_ORGS_ON_REPLICATION, int, 0, "Mutate orgs using germline mutation rates when they are copied to a new deme (using DEMES_SEED_METHOD 1): 0=OFF, 1=ON");
   CONFIG_ADD_VAR(DEMES_ORGS_START_IN_GERM, int, 0, "Are orgs considered part of the germline at start?");
+  CONFIG_ADD_VAR(DEMES_PARTITIONED_EXECUTION, int, 0, "Run each deme as an independent partition of every update?\n0 = Interleave all demes under the population-wide scheduler\n1 = Each deme runs its share of the update with its own schedule and random\n    number stream, on up to MAX_CONCURRENCY worker threads; implicit\n    replication is applied at the end of the update");
   
   
   // -------- Reversion config options --------
@@ -537,7 +553,7 @@ public:
   // -------- Time Slicing config options --------
   CONFIG_ADD_GROUP(TIME_GROUP, "Time Slicing");
   CONFIG_ADD_VAR(AVE_TIME_SLICE, int, 30, "Average number of CPU-cycles per org per update");
-  CONFIG_ADD_VAR(SLICING_METHOD, int, 1, "0 = CONSTANT: all organisms receive equal number of CPU cycles\n1 = PROBABILISTIC: CPU cycles distributed randomly, proportional to merit.\n2 = INTEGRATED: CPU cycles given out deterministicly, proportional to merit\n3 = DEME_PROBABALISTIC: Demes receive fixed number of CPU cycles, awarded probabalistically to members\n4 = CROSS_DEME_PROBABALISTIC: Demes receive CPU cycles proportional to living population size, awarded probabalistically to members\n5 = CONSTANT BURST: all organisms receive equal number of CPU cycles, in SLICING_BURST_SIZE chunks");
+  CONFIG_ADD_VAR(SLICING_METHOD, int, 1, "0 = CONSTANT: all organisms receive equal number of CPU cycles\n1 = PROBABILISTIC: CPU cycles distributed randomly, proportional to merit.\n2 = INTEGRATED: CPU cycles given out deterministicly, proportional to merit\n3 = DEME_PROBABALISTIC: Demes receive fixed number of CPU cycles, awarded probabalistically to members\n4 = CROSS_DEME_PROBABALISTIC: Demes receive CPU cycles proportional to living population size, awarded probabalistically to members\n5 = CONSTANT BURST: all organisms receive equal number of CPU cycles, in SLICING_BURST_SIZE chunks\n6 = BINNED PROBABILISTIC: as PROBABILISTIC, with each CPU cycle drawn in constant time");
   CONFIG_ADD_VAR(SLICING_BURST_SIZE, int, 1, "Sets the scheduler burst size for SLICING_METHOD 5.");
   CONFIG_ADD_VAR(BASE_MERIT_METHOD, int, 4, "How should merit be initialized?\n0 = Constant (merit independent of size)\n1 = Merit proportional to copied size\n2 = Merit prop. to executed size\n3 = Merit prop. to full size\n4 = Merit prop. to min of executed or copied size\n5 = Merit prop. to sqrt of the minimum size\n6 = Merit prop. to num times MERIT_BONUS_INST is in genome.");
   CONFIG_ADD_VAR(BASE_CONST_MERIT, int, 100, "Base merit valse for BASE_MERIT_METHOD 0");
@@ -561,6 +577,7 @@ public:
   CONFIG_ADD_VAR(FASTFORWARD_UPDATES, int, 0, "Fast-forward if the average generation has not changed in this many updates. (0 = off)");
   CONFIG_ADD_VAR(FASTFORWARD_NUM_ORGS, int, 0, "Fast-forward if population is equal to this");
   CONFIG_ADD_VAR(GENOTYPE_PHENPLAST_CALC, int, 100, "Number of times to test a genotype's\nplasticity during runtime.");
+  CONFIG_ADD_VAR(SPATIAL_RES_UPDATE_INTERVAL, int, 1, "Number of updates between diffusion and flow steps of spatial resources;\neach step covers the whole interval, with inflow, outflow, decay and flow\nrates scaled to match (flow rates are capped at 1 to stay stable).");
   
 
   // -------- Altruism config options --------
@@ -643,10 +660,11 @@ public:
   
   // -------- Analyze config options --------
   CONFIG_ADD_GROUP(ANALYZE_GROUP, "Analysis Settings");
-  CONFIG_ADD_VAR(MAX_CONCURRENCY, int, -1, "Maximum number of analyze threads, -1 == use all available.");
+  CONFIG_ADD_VAR(MAX_CONCURRENCY, int, -1, "Maximum number of analyze (and deme partition) threads, -1 == use all available.");
   CONFIG_ADD_VAR(INJECT_RESETS_TASKS, int, 0, "Executing INJECT (semi-succesfully) will trigger last_task_count to be writen from current_task_count");
   CONFIG_ADD_VAR(ANALYZE_OPTION_1, cString, "", "String variable accessible from analysis scripts");
   CONFIG_ADD_VAR(ANALYZE_OPTION_2, cString, "", "String variable accessible from analysis scripts");
+  CONFIG_ADD_VAR(TEST_RESULT_CACHE, cString, "", "File in which to keep test CPU results for reuse by later runs and analyze sessions\n(empty = no cache)");
   
 
   // -------- Energy Model config options --------
@@ -855,6 +873,7 @@ public:
   CONFIG_ADD_GROUP(ALARM_GROUP, "Alarm Settings");
   CONFIG_ADD_VAR(BCAST_HOPS, int, 1, "Number of hops to broadcast an alarm");
   CONFIG_ADD_VAR(ALARM_SELF, bool, 0, "Does sending an alarm move sender IP to alarm label?\n0=no\n1=yes");
+  CONFIG_ADD_VAR(BCAST_NEIGHBORHOOD_RINGS, bool, 0, "How multi-hop alarms and message broadcasts find their recipients.\n0 = Messages follow the recursive neighbor walk, alarms use distance\n    within the deme (no wrapping)\n1 = Every cell within the hop count over cell connections, from rings cached\n    per cell (torus demes wrap)");
 
 	
   //--------- Division of Labor --------------------
@@ -894,6 +913,8 @@ public:
   
   bool Get(const cString& entry, cString& ret) const;
   bool HasEntry(const cString& entry) const { cString rtn; return Get(entry, rtn); }
+  void GetSettings(tArray<cString>& names, tArray<cString>& values) const;
+  unsigned int GetRevision() const { return m_revision; }
   
   bool Set(const cString& entry, const cString& val);
   void Set(tDictionary<cString>& sets);
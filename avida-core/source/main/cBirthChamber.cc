@@ -38,6 +38,8 @@
 #include "tArray.h"
 #include "AvidaTools.h"
 
+#include <cstring>
+
 using namespace AvidaTools;
 
 cBirthChamber::~cBirthChamber()
@@ -138,9 +140,9 @@ bool cBirthChamber::ValidateBirthEntry(cBirthEntry& entry)
   return true;
 }
 
-void cBirthChamber::StoreAsEntry(const Genome& offspring, cOrganism* parent, cBirthEntry& entry) const
+void cBirthChamber::StoreAsEntry(Genome& offspring, cOrganism* parent, cBirthEntry& entry) const
 {
-  entry.genome = offspring;
+  entry.genome.Swap(offspring);
   if (m_world->GetConfig().ENERGY_ENABLED.Get() == 1) {
     entry.energy4Offspring = parent->GetPhenotype().ExtractParentEnergy();
     entry.merit = parent->GetPhenotype().ConvertEnergyToMerit(entry.energy4Offspring);
@@ -178,6 +180,24 @@ void cBirthChamber::ClearEntry(cBirthEntry& entry)
 }
 
 
+namespace {
+  // Replace seq[start, end) with count instructions from insts, shifting the tail of seq in a single block move.
+  // cInstruction is a lone opcode byte, so its arrays can be moved as raw memory.
+  void replaceRegion(Sequence& seq, int start, int end, const cInstruction* insts, int count)
+  {
+    const int old_size = seq.GetSize();
+    const int new_size = old_size - (end - start) + count;
+    const int tail = old_size - end;
+
+    if (new_size > old_size) seq.Resize(new_size);
+    cInstruction* data = &seq[0];
+    if (tail > 0 && count != end - start) memmove(data + start + count, data + end, tail * sizeof(cInstruction));
+    if (count > 0) memcpy(data + start, insts, count * sizeof(cInstruction));
+    if (new_size < old_size) seq.Resize(new_size);
+  }
+}
+
+
 bool cBirthChamber::RegionSwap(Sequence& genome0, Sequence& genome1, int start0, int end0, int start1, int end1)
 {
    assert( start0 >= 0  &&  start0 < genome0.GetSize() );
@@ -198,17 +218,17 @@ bool cBirthChamber::RegionSwap(Sequence& genome0, Sequence& genome1, int start0,
      return false;
    } 
 
+   // Regions are exchanged in place; only the section leaving genome0 needs holding aside, in the chamber's scratch
+   // buffer, while genome1's section is written over it.
    if (size0 > 0 && size1 > 0) {
-     Sequence cross0 = genome0.Crop(start0, end0);
-     Sequence cross1 = genome1.Crop(start1, end1);
-     genome0.Replace(start0, size0, cross1);
-     genome1.Replace(start1, size1, cross0);
+     m_region_buf.Resize(size0);
+     memcpy(&m_region_buf[0], &genome0[start0], size0 * sizeof(cInstruction));
+     replaceRegion(genome0, start0, end0, &genome1[start1], size1);
+     replaceRegion(genome1, start1, end1, &m_region_buf[0], size0);
    } else if (size0 > 0) {
-     Sequence cross0 = genome0.Crop(start0, end0);
-     genome1.Replace(start1, size1, cross0);
+     replaceRegion(genome1, start1, end1, &genome0[start0], size0);
    } else if (size1 > 0) {
-     Sequence cross1 = genome1.Crop(start1, end1);
-     genome0.Replace(start0, size0, cross1);
+     replaceRegion(genome0, start0, end0, &genome1[start1], size1);
    }
 
    return true;
@@ -216,9 +236,7 @@ bool cBirthChamber::RegionSwap(Sequence& genome0, Sequence& genome1, int start0,
 
 void cBirthChamber::GenomeSwap(Sequence& genome0, Sequence& genome1, double& merit0, double& merit1)
 {
-  Sequence genome0_tmp = genome0;
-  genome0 = genome1; 
-  genome1 = genome0_tmp; 
+  genome0.Swap(genome1);
 
   double merit0_tmp = merit0; 
   merit0 = merit1; 
@@ -226,13 +244,13 @@ void cBirthChamber::GenomeSwap(Sequence& genome0, Sequence& genome1, double& mer
 }
 
 
-bool cBirthChamber::DoAsexBirth(cAvidaContext& ctx, const Genome& offspring, cOrganism& parent,
+bool cBirthChamber::DoAsexBirth(cAvidaContext& ctx, Genome& offspring, cOrganism& parent,
                                 tArray<cOrganism*>& child_array, tArray<cMerit>& merit_array)
 {
   // This is asexual who doesn't need to wait in the birth chamber
   // just build the child and return.
   child_array.Resize(1);
-  child_array[0] = new cOrganism(m_world, ctx, offspring, parent.GetPhenotype().GetGeneration(), SRC_ORGANISM_DIVIDE);
+  child_array[0] = new cOrganism(m_world, ctx, &offspring, parent.GetPhenotype().GetGeneration(), SRC_ORGANISM_DIVIDE);
   merit_array.Resize(1);
   
   if (m_world->GetConfig().ENERGY_ENABLED.Get() == 1) {
@@ -264,13 +282,13 @@ bool cBirthChamber::DoAsexBirth(cAvidaContext& ctx, const Genome& offspring, cOr
   return true;
 }
 
-bool cBirthChamber::DoPairAsexBirth(cAvidaContext& ctx, const cBirthEntry& old_entry, const Genome& new_genome,
+bool cBirthChamber::DoPairAsexBirth(cAvidaContext& ctx, cBirthEntry& old_entry, Genome& new_genome,
                                     cOrganism& parent, tArray<cOrganism*>& child_array, tArray<cMerit>& merit_array)
 {
   // Build both child organisms...
   child_array.Resize(2);
-  child_array[0] = new cOrganism(m_world, ctx, old_entry.genome, parent.GetPhenotype().GetGeneration(), SRC_ORGANISM_DIVIDE);
-  child_array[1] = new cOrganism(m_world, ctx, new_genome, parent.GetPhenotype().GetGeneration(), SRC_ORGANISM_DIVIDE);
+  child_array[0] = new cOrganism(m_world, ctx, &old_entry.genome, parent.GetPhenotype().GetGeneration(), SRC_ORGANISM_DIVIDE);
+  child_array[1] = new cOrganism(m_world, ctx, &new_genome, parent.GetPhenotype().GetGeneration(), SRC_ORGANISM_DIVIDE);
 
   // Setup the merits for both children...
   merit_array.Resize(2);
@@ -388,7 +406,8 @@ void cBirthChamber::DoModularShuffleRecombination(cAvidaContext& ctx, Sequence&
                                                    double& merit0, double& merit1)
 {
   const int num_modules = m_world->GetConfig().MODULE_NUM.Get();
-  tArray<bool> swapped_region(num_modules);
+  tSmartArray<bool>& swapped_region = m_module_swapped;
+  swapped_region.Resize(num_modules);
   swapped_region.SetAll(false);
 
   int swap_count = 0;
@@ -443,7 +462,7 @@ void cBirthChamber::SetupGenotypeInfo(cOrganism* organism, const tArray<cBioGrou
   organism->SelfClassify(pgrps);
 }
 
-bool cBirthChamber::SubmitOffspring(cAvidaContext& ctx, const Genome& offspring, cOrganism* parent,
+bool cBirthChamber::SubmitOffspring(cAvidaContext& ctx, Genome& offspring, cOrganism* parent,
                                     tArray<cOrganism*>& child_array, tArray<cMerit>& merit_array)
 {
   cPhenotype& parent_phenotype = parent->GetPhenotype();
@@ -472,9 +491,12 @@ bool cBirthChamber::SubmitOffspring(cAvidaContext& ctx, const Genome& offspring,
     ClearEntry(*old_entry);
     return ret;
   }
-  // If we made it this far, RECOMBINATION will happen!
-  Genome genome0(old_entry->genome);
-  Genome genome1(offspring);
+  // If we made it this far, RECOMBINATION will happen!  Both genomes are exchanged into the chamber's recombination
+  // buffers rather than copied; the entry is cleared below and the offspring genome is never looked at again.
+  Genome& genome0 = m_recomb_genome0;
+  Genome& genome1 = m_recomb_genome1;
+  genome0.Swap(old_entry->genome);
+  genome1.Swap(offspring);
   double meritOrEnergy0;
   double meritOrEnergy1;
 
@@ -524,8 +546,8 @@ bool cBirthChamber::SubmitOffspring(cAvidaContext& ctx, const Genome& offspring,
   
   if (two_fold_cost == 0) {	// Build the two organisms.
     child_array.Resize(2);
-    child_array[0] = new cOrganism(m_world, ctx, genome0, parent_phenotype.GetGeneration(), SRC_ORGANISM_DIVIDE);
-    child_array[1] = new cOrganism(m_world, ctx, genome1, parent_phenotype.GetGeneration(), SRC_ORGANISM_DIVIDE);
+    child_array[0] = new cOrganism(m_world, ctx, &genome0, parent_phenotype.GetGeneration(), SRC_ORGANISM_DIVIDE);
+    child_array[1] = new cOrganism(m_world, ctx, &genome1, parent_phenotype.GetGeneration(), SRC_ORGANISM_DIVIDE);
     
     if(m_world->GetConfig().ENERGY_ENABLED.Get() == 1) {
       child_array[0]->GetPhenotype().SetEnergy(meritOrEnergy0);
@@ -548,7 +570,7 @@ bool cBirthChamber::SubmitOffspring(cAvidaContext& ctx, const Genome& offspring,
     merit_array.Resize(1);
 
     if (ctx.GetRandom().GetDouble() < 0.5) {
-      child_array[0] = new cOrganism(m_world, ctx, genome0, parent_phenotype.GetGeneration(), SRC_ORGANISM_DIVIDE);
+      child_array[0] = new cOrganism(m_world, ctx, &genome0, parent_phenotype.GetGeneration(), SRC_ORGANISM_DIVIDE);
       if(m_world->GetConfig().ENERGY_ENABLED.Get() == 1) {
         child_array[0]->GetPhenotype().SetEnergy(meritOrEnergy0);
         meritOrEnergy0 = child_array[0]->GetPhenotype().ConvertEnergyToMerit(child_array[0]->GetPhenotype().GetStoredEnergy());
@@ -559,7 +581,7 @@ bool cBirthChamber::SubmitOffspring(cAvidaContext& ctx, const Genome& offspring,
       SetupGenotypeInfo(child_array[0], parent0_groups, parent1_groups);
     } 
     else {
-      child_array[0] = new cOrganism(m_world, ctx, genome1, parent_phenotype.GetGeneration(), SRC_ORGANISM_DIVIDE);
+      child_array[0] = new cOrganism(m_world, ctx, &genome1, parent_phenotype.GetGeneration(), SRC_ORGANISM_DIVIDE);
       if(m_world->GetConfig().ENERGY_ENABLED.Get() == 1) {
         child_array[0]->GetPhenotype().SetEnergy(meritOrEnergy1);
         meritOrEnergy1 = child_array[1]->GetPhenotype().ConvertEnergyToMerit(child_array[1]->GetPhenotype().GetStoredEnergy());
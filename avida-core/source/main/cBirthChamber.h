@@ -29,6 +29,9 @@
 #ifndef tArrayMap_h
 #include "tArrayMap.h"
 #endif
+#ifndef tSmartArray_h
+#include "tSmartArray.h"
+#endif
 
 /**
  * All genome-based organisms must go through the birth chamber, which will
@@ -55,6 +58,12 @@ class cBirthChamber
 private:
   cWorld* m_world;
   tArrayMap<int, cBirthSelectionHandler*> m_handler_map;
+  
+  // Scratch space for recombination, kept between matings so that crossover does not allocate
+  Genome m_recomb_genome0;
+  Genome m_recomb_genome1;
+  tSmartArray<cInstruction> m_region_buf;
+  tSmartArray<bool> m_module_swapped;
 
 
   cBirthChamber(); // @not_implemented
@@ -67,13 +76,15 @@ public:
   ~cBirthChamber();
 
   // Handle manipulations & tests of genome.  Return false if divide process
-  // should halt.  Place offspring in child_array.
-  bool SubmitOffspring(cAvidaContext& ctx, const Genome& offspring_genome, cOrganism* parent,
+  // should halt.  Place offspring in child_array.  The contents of
+  // offspring_genome are handed on to the children (or a birth entry) rather
+  // than copied, and are not preserved.
+  bool SubmitOffspring(cAvidaContext& ctx, Genome& offspring_genome, cOrganism* parent,
                        tArray<cOrganism*>& child_array, tArray<cMerit>& merit_array);  
 
   bool ValidBirthEntry(const cBirthEntry& entry) const;
   bool ValidateBirthEntry(cBirthEntry& entry); //@CHC: Same as ValidBirthEntry() but may modify the entry if it has died due to old age
-  void StoreAsEntry(const Genome& offspring_genome, cOrganism* parent, cBirthEntry& entry) const;
+  void StoreAsEntry(Genome& offspring_genome, cOrganism* parent, cBirthEntry& entry) const;
   void ClearEntry(cBirthEntry& entry);
   
   int GetWaitingOffspringNumber(int which_mating_type, int hw_type);
@@ -85,9 +96,9 @@ private:
   bool RegionSwap(Sequence& genome0, Sequence& genome1, int start0, int end0, int start1, int end1);
   void GenomeSwap(Sequence& genome0, Sequence& genome1, double& merit0, double& merit1);
   
-  bool DoAsexBirth(cAvidaContext& ctx, const Genome& offspring_genome, cOrganism& parent,
+  bool DoAsexBirth(cAvidaContext& ctx, Genome& offspring_genome, cOrganism& parent,
                    tArray<cOrganism*>& child_array, tArray<cMerit>& merit_array);
-  bool DoPairAsexBirth(cAvidaContext& ctx, const cBirthEntry& old_entry, const Genome& new_genome, cOrganism& parent,
+  bool DoPairAsexBirth(cAvidaContext& ctx, cBirthEntry& old_entry, Genome& new_genome, cOrganism& parent,
                        tArray<cOrganism*>& child_array, tArray<cMerit>& merit_array);
   
 
@@ -36,7 +36,7 @@ cBirthGenomeSizeHandler::~cBirthGenomeSizeHandler()
 }
 
 
-cBirthEntry* cBirthGenomeSizeHandler::SelectOffspring(cAvidaContext& ctx, const Genome& offspring, cOrganism* parent)
+cBirthEntry* cBirthGenomeSizeHandler::SelectOffspring(cAvidaContext& ctx, Genome& offspring, cOrganism* parent)
 {
   int offspring_length = offspring.GetSize();
   
@@ -46,7 +46,7 @@ cBirthGridLocalHandler::~cBirthGridLocalHandler()
 }
 
 
-cBirthEntry* cBirthGridLocalHandler::SelectOffspring(cAvidaContext& ctx, const Genome& offspring, cOrganism* parent)
+cBirthEntry* cBirthGridLocalHandler::SelectOffspring(cAvidaContext& ctx, Genome& offspring, cOrganism* parent)
 {
   int parent_id = parent->GetOrgInterface().GetCellID();
   
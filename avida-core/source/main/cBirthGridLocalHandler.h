@@ -51,7 +51,7 @@ public:
   cBirthGridLocalHandler(cWorld* world, cBirthChamber* bc);
   ~cBirthGridLocalHandler();
   
-  cBirthEntry* SelectOffspring(cAvidaContext& ctx, const Genome& offspring, cOrganism* parent);
+  cBirthEntry* SelectOffspring(cAvidaContext& ctx, Genome& offspring, cOrganism* parent);
   
   
 private:
@@ -47,7 +47,7 @@ public:
   cBirthMateSelectHandler(cBirthChamber* bc) : m_bc(bc) { ; }
   ~cBirthMateSelectHandler();
   
-  cBirthEntry* SelectOffspring(cAvidaContext& ctx, const Genome& offspring, cOrganism* parent);
+  cBirthEntry* SelectOffspring(cAvidaContext& ctx, Genome& offspring, cOrganism* parent);
 };
 
 #endif
@@ -41,7 +41,7 @@ cBirthMatingTypeGlobalHandler::~cBirthMatingTypeGlobalHandler()
   }
 }
 
-cBirthEntry* cBirthMatingTypeGlobalHandler::SelectOffspring(cAvidaContext& ctx, const Genome& offspring, cOrganism* parent)
+cBirthEntry* cBirthMatingTypeGlobalHandler::SelectOffspring(cAvidaContext& ctx, Genome& offspring, cOrganism* parent)
 {
   int parent_sex = parent->GetPhenotype().GetMatingType();
   
@@ -181,7 +181,7 @@ int cBirthMatingTypeGlobalHandler::getTaskID(cString task_name, cWorld* world)
 }
 
 //Stores the specified offspring in the specified birth chamber
-void cBirthMatingTypeGlobalHandler::storeOffspring(cAvidaContext& ctx, const Genome& offspring, cOrganism* parent)
+void cBirthMatingTypeGlobalHandler::storeOffspring(cAvidaContext& ctx, Genome& offspring, cOrganism* parent)
 {
   //First, don't bother doing ANYTHING if LEKKING is turned on and the parent is a female --
   // -- in this case, there's no point in putting her offspring in the birth chamber because 
@@ -274,7 +274,7 @@ bool cBirthMatingTypeGlobalHandler::compareBirthEntries(cAvidaContext& ctx, int
 
 //Selects a mate for the current offspring/gamete
 //If none is found, it returns NULL
-cBirthEntry* cBirthMatingTypeGlobalHandler::selectMate(cAvidaContext& ctx, const Genome& offspring, cOrganism* parent, int which_mating_type, int mate_choice_method)
+cBirthEntry* cBirthMatingTypeGlobalHandler::selectMate(cAvidaContext& ctx, Genome& offspring, cOrganism* parent, int which_mating_type, int mate_choice_method)
 {
   //Loop through the entry list and find a mate
   //If none are found, store the current offspring and return NULL
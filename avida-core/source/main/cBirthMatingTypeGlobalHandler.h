@@ -42,8 +42,8 @@ private:
   tArray<cBirthEntry> m_entries;
 
   int getTaskID(cString task_name, cWorld* world);
-  void storeOffspring(cAvidaContext& ctx, const Genome& offspring, cOrganism* parent);
-  cBirthEntry* selectMate(cAvidaContext& ctx, const Genome& offspring, cOrganism* parent, int which_mating_type, int mate_choice_method);
+  void storeOffspring(cAvidaContext& ctx, Genome& offspring, cOrganism* parent);
+  cBirthEntry* selectMate(cAvidaContext& ctx, Genome& offspring, cOrganism* parent, int which_mating_type, int mate_choice_method);
   int getWaitingOffspringMostTask(int which_mating_type, int task_id);
   bool compareBirthEntries(cAvidaContext& ctx, int mate_choice_method, const cBirthEntry& entry1, const cBirthEntry& entry2);
   
@@ -51,7 +51,7 @@ public:
   cBirthMatingTypeGlobalHandler(cBirthChamber* bc) : m_bc(bc) { ; }
   ~cBirthMatingTypeGlobalHandler();
   
-  cBirthEntry* SelectOffspring(cAvidaContext& ctx, const Genome& offspring, cOrganism* parent);
+  cBirthEntry* SelectOffspring(cAvidaContext& ctx, Genome& offspring, cOrganism* parent);
   
   int GetWaitingOffspringNumber(int which_mating_type);
   void PrintBirthChamber(const cString& filename, cWorld* world);
@@ -43,7 +43,8 @@ public:
   cBirthSelectionHandler() { ; }
   virtual ~cBirthSelectionHandler() = 0;
   
-  virtual cBirthEntry* SelectOffspring(cAvidaContext& ctx, const Genome& offspring, cOrganism* parent) = 0;
+  // Return a waiting mate, or store offspring (taking over its contents) and return NULL
+  virtual cBirthEntry* SelectOffspring(cAvidaContext& ctx, Genome& offspring, cOrganism* parent) = 0;
   
   virtual int GetWaitingOffspringNumber(int which_mating_type) { return -1; } //@CHC
   virtual void GetWaitingOffspringTaskData(int task_id, float results_array[]) { results_array[0] = results_array[1] = results_array[2] = -1; } //@CHC
@@ -340,7 +340,10 @@ int cDeme::GetNumOrgsWithOpinion() const
 
 void cDeme::ProcessPreUpdate()
 {
-  deme_resource_count.SetSpatialUpdate(m_world->GetStats().GetUpdate());
+  const int update = m_world->GetStats().GetUpdate();
+  const int spatial_interval = m_world->GetConfig().SPATIAL_RES_UPDATE_INTERVAL.Get();
+  if (spatial_interval <= 1) deme_resource_count.SetSpatialUpdate(update);
+  else if (update % spatial_interval == 0) deme_resource_count.SetSpatialUpdate(update, spatial_interval);
 }
 
 void cDeme::ProcessUpdate(cAvidaContext& ctx)
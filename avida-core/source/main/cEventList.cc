@@ -24,13 +24,19 @@
 
 #include "avida/Avida.h"
 
+#include "apto/core/FileSystem.h"
+
 #include "cActionLibrary.h"
 #include "cInitFile.h"
 #include "cStats.h"
 #include "cString.h"
 #include "cWorld.h"
+#include "tArray.h"
 
+#include <algorithm>
 #include <cfloat>           // for DBL_MIN
+#include <cstring>
+#include <fstream>
 #include <iostream>
 
 using namespace std;
@@ -41,6 +47,22 @@ const double cEventList::TRIGGER_END = DBL_MAX;
 const double cEventList::TRIGGER_ALL = 0.0;
 const double cEventList::TRIGGER_ONCE = DBL_MAX;
 
+// Leading signature of preparsed binary event files.  The trailing byte is the format version.
+static const char BINARY_EVENT_SIGNATURE[8] = { 'A', 'V', 'D', 'E', 'V', 'N', 'T', 1 };
+
+
+// Heaps are max-heaps, so the entry that is due first (and was added first) must compare greatest
+bool cEventList::sQueueCompare::operator()(const cEventListEntry* lhs, const cEventListEntry* rhs) const
+{
+  if (lhs->GetQueueKey() != rhs->GetQueueKey()) return lhs->GetQueueKey() > rhs->GetQueueKey();
+  return lhs->GetID() > rhs->GetID();
+}
+
+bool cEventList::sIDCompare::operator()(const cEventListEntry* lhs, const cEventListEntry* rhs) const
+{
+  return lhs->GetID() < rhs->GetID();
+}
+
 
 cEventList::~cEventList()
 {
@@ -60,6 +82,7 @@ bool cEventList::AddEvent(eTriggerType trigger, double start, double interval,
   
   if (action != NULL) {
     cEventListEntry* entry = new cEventListEntry(action, name, trigger, start, interval, stop);
+    entry->SetID(m_next_id++);
     
     // If there are no events in the list yet.
     if (m_tail == NULL) {
@@ -73,7 +96,7 @@ bool cEventList::AddEvent(eTriggerType trigger, double start, double interval,
       m_tail = entry;
     }
     
-    SyncEvent(entry);
+    if (SyncEvent(entry)) Enqueue(entry);
 		
 		if (trigger == BIRTHS_INTERRUPT)  //Operates outside of usual event processing
 			QueueBirthInterruptEvent(start);
@@ -89,6 +112,16 @@ bool cEventList::AddEvent(eTriggerType trigger, double start, double interval,
 
 bool cEventList::LoadEventFile(const cString& filename, const cString& working_dir, Feedback& feedback)
 {
+  cString path = cString(Apto::FileSystem::GetAbsolutePath(Apto::String(filename), Apto::String(working_dir)));
+  {
+    char signature[sizeof(BINARY_EVENT_SIGNATURE)];
+    ifstream probe((const char*)path, ios::in | ios::binary);
+    if (probe.read(signature, sizeof(signature)) && memcmp(signature, BINARY_EVENT_SIGNATURE, sizeof(signature)) == 0) {
+      probe.close();
+      return LoadBinaryEventFile(path, feedback);
+    }
+  }
+  
   cInitFile event_file(filename, working_dir);
   
   if (!event_file.WasOpened()) return false;
@@ -150,53 +183,100 @@ double cEventList::GetTriggerValue(eTriggerType trigger) const
 
 void cEventList::Process(cAvidaContext& ctx)
 {
-  double t_val = 0; // trigger value
+  // Events added by the actions fired in a pass get a pass of their own, so that, as when the event list was walked in
+  // order, they can still fire within this call
+  int min_id = 0;
+  while (min_id < m_next_id) {
+    const int next_min_id = m_next_id;
+    ProcessDue(ctx, min_id);
+    min_id = next_min_id;
+  }
+}
+
+
+// Fire the due entries numbered min_id or above, in the order that they were added to the event list.  Any others that
+// are due stay queued.
+void cEventList::ProcessDue(cAvidaContext& ctx, int min_id)
+{
+  std::vector<cEventListEntry*> due;
+  std::vector<cEventListEntry*> waiting;
+  for (unsigned int i = 0; i < m_immediate.size(); i++) {
+    if (m_immediate[i]->GetID() >= min_id) due.push_back(m_immediate[i]);
+    else waiting.push_back(m_immediate[i]);
+  }
+  m_immediate.swap(waiting);
   
-  // Iterate through all entrys in event list
-  cEventListEntry* entry = m_head;
-  while (entry != NULL) {
-    cEventListEntry* next_entry = entry->GetNext();
+  const eTriggerType queue_trigger[NUM_QUEUES] = { UPDATE, GENERATION, BIRTHS };
+  for (int q = 0; q < NUM_QUEUES; q++) {
+    std::vector<cEventListEntry*>& queue = m_queue[q];
+    if (queue.empty()) continue;
+    
+    // Get the value of the appropriate trigger variable
+    const double t_val = GetTriggerValue(queue_trigger[q]);
+    if (t_val == DBL_MAX) continue;
+    
+    std::vector<cEventListEntry*> held;
+    while (!queue.empty() && queue.front()->GetQueueKey() <= t_val) {
+      std::pop_heap(queue.begin(), queue.end(), sQueueCompare());
+      cEventListEntry* entry = queue.back();
+      queue.pop_back();
+      
+      if (entry->GetID() < min_id) {
+        held.push_back(entry);
+      } else if (t_val <= entry->GetStop() || entry->GetStop() == TRIGGER_END) {
+        due.push_back(entry);
+      } else if (q == QUEUE_GENERATION) {
+        // Average generation can drop back below the stop value, so keep waiting
+        held.push_back(entry);
+      } else {
+        // Update and birth counts never decrease, this entry can not fire again
+        Delete(entry);
+      }
+    }
+    for (unsigned int i = 0; i < held.size(); i++) {
+      queue.push_back(held[i]);
+      std::push_heap(queue.begin(), queue.end(), sQueueCompare());
+    }
+  }
+  
+  if (due.empty()) return;
+  std::sort(due.begin(), due.end(), sIDCompare());
+  
+  for (unsigned int i = 0; i < due.size(); i++) {
+    cEventListEntry* entry = due[i];
     
-    // Check trigger condition
+    // Process the Action
+    m_processing = entry;
+    entry->GetAction()->Process(ctx);
+    m_processing = NULL;
     
     // IMMEDIATE Events always happen and are always deleted
     if (entry->GetTrigger() == IMMEDIATE) {
-      entry->GetAction()->Process(ctx);
       Delete(entry);
-    } else if (entry->GetTrigger() != BIRTHS_INTERRUPT) {
-      //BIRTHS_INTERRUPT occur outside of update boundaries
-	  //and should not alter the behavior of other events.
-	  
-	  // Get the value of the appropriate trigger varile
-      t_val = GetTriggerValue(entry->GetTrigger());
-      
-      if (t_val != DBL_MAX &&
-          (t_val >= entry->GetStart() || entry->GetStart() == TRIGGER_BEGIN) &&
-          (t_val <= entry->GetStop() || entry->GetStop() == TRIGGER_END)) {
-
-        // Process the Action
-        entry->GetAction()->Process(ctx);
-        
-        // Handle Interval Adjustment
-        if (entry->GetInterval() == TRIGGER_ALL) {
-          // Do Nothing
-        } else if (entry->GetInterval() == TRIGGER_ONCE) {
-          // If it is a onetime thing, remove it...
-          Delete(entry);
-          entry = NULL;
-        } else {
-          // There is an interval.. so add it
-          entry->NextInterval();
-        }
-        
-        // If the event can never happen now... excize it
-        if (entry != NULL && entry->GetStop() != TRIGGER_END &&
-            ((entry->GetStart() > entry->GetStop() && entry->GetInterval() > 0) ||
-             (entry->GetStart() < entry->GetStop() && entry->GetInterval() < 0)))
-            Delete(entry);
-      }
-    } 
-    entry = next_entry;
+      continue;
+    }
+    
+    // Handle Interval Adjustment
+    if (entry->GetInterval() == TRIGGER_ALL) {
+      // Do Nothing
+    } else if (entry->GetInterval() == TRIGGER_ONCE) {
+      // If it is a onetime thing, remove it...
+      Delete(entry);
+      continue;
+    } else {
+      // There is an interval.. so add it
+      entry->NextInterval();
+    }
+    
+    // If the event can never happen now... excize it
+    if (entry->GetStop() != TRIGGER_END &&
+        ((entry->GetStart() > entry->GetStop() && entry->GetInterval() > 0) ||
+         (entry->GetStart() < entry->GetStop() && entry->GetInterval() < 0))) {
+      Delete(entry);
+      continue;
+    }
+    
+    Enqueue(entry);
   }
 }
 
@@ -270,26 +350,30 @@ void cEventList::Sync()
     SyncEvent(entry);
     entry = next_entry;
   }
+  
+  // Start values may have moved, so the queue ordering must be reestablished
+  RebuildQueues();
 }
 
 
-void cEventList::SyncEvent(cEventListEntry* entry)
+// Returns false if the entry was removed
+bool cEventList::SyncEvent(cEventListEntry* entry)
 {
   // Ignore events that are immdeiate
-  if (entry->GetTrigger() == IMMEDIATE) return;
+  if (entry->GetTrigger() == IMMEDIATE) return true;
   
   double t_val = GetTriggerValue(entry->GetTrigger());
   
   // If t_val has past the end, remove (even if it is TRIGGER_ALL)
   if (t_val > entry->GetStop()) {
     Delete(entry);
-    return;
+    return false;
   }
   
   // If it is a trigger once and has passed, remove
   if (t_val > entry->GetStart() && entry->GetInterval() == TRIGGER_ONCE) {
     Delete(entry);
-    return;
+    return false;
   }
   
   // If for some reason t_val has been reset or soemthing, rewind
@@ -298,10 +382,48 @@ void cEventList::SyncEvent(cEventListEntry* entry)
   }
   
   // Can't fast forward events that are Triger All
-  if (entry->GetInterval() == TRIGGER_ALL) return;
+  if (entry->GetInterval() == TRIGGER_ALL) return true;
   
   // Keep adding interval to start until we are caught up
   while (t_val > entry->GetStart()) entry->NextInterval();
+  
+  return true;
+}
+
+
+int cEventList::QueueIndex(eTriggerType trigger)
+{
+  switch (trigger) {
+    case UPDATE: return QUEUE_UPDATE;
+    case GENERATION: return QUEUE_GENERATION;
+    case BIRTHS: return QUEUE_BIRTHS;
+    default: return -1;
+  }
+}
+
+
+void cEventList::Enqueue(cEventListEntry* entry)
+{
+  if (entry->GetTrigger() == IMMEDIATE) {
+    m_immediate.push_back(entry);
+    return;
+  }
+  
+  // BIRTHS_INTERRUPT entries are handled by ProcessInterrupt, outside of update boundaries
+  const int q = QueueIndex(entry->GetTrigger());
+  if (q < 0) return;
+  
+  m_queue[q].push_back(entry);
+  std::push_heap(m_queue[q].begin(), m_queue[q].end(), sQueueCompare());
+}
+
+
+void cEventList::RebuildQueues()
+{
+  for (int q = 0; q < NUM_QUEUES; q++) m_queue[q].clear();
+  m_immediate.clear();
+  
+  for (cEventListEntry* entry = m_head; entry != NULL; entry = entry->GetNext()) Enqueue(entry);
 }
 
 
@@ -382,6 +504,87 @@ bool cEventList::CheckBirthInterruptQueue(double t_val)
 }
 
 
+//// Preparsed Binary Event File Format ////
+//
+// The signature is followed by the number of events (int), then for each event its trigger (int), start, interval and
+// stop (double), and the action name and arguments (each an int length followed by the characters).  Values are
+// stored in native byte order, so files are only portable between machines of the same architecture.
+
+static void WriteBinaryString(ostream& os, const cString& str)
+{
+  int size = str.GetSize();
+  os.write(reinterpret_cast<const char*>(&size), sizeof(size));
+  os.write(str.GetData(), size);
+}
+
+static bool ReadBinaryString(istream& is, cString& str)
+{
+  int size = 0;
+  if (!is.read(reinterpret_cast<char*>(&size), sizeof(size)) || size < 0) return false;
+  tArray<char> buf(size + 1);
+  if (!is.read(&buf[0], size)) return false;
+  str = cString(&buf[0], size);
+  return true;
+}
+
+
+bool cEventList::SaveBinaryEventFile(const cString& filename)
+{
+  ofstream fp((const char*)filename, ios::out | ios::binary | ios::trunc);
+  if (!fp.good()) return false;
+  
+  // The entry that is currently being processed (i.e. the action that requested this save) is left out
+  int num_events = 0;
+  for (cEventListEntry* entry = m_head; entry != NULL; entry = entry->GetNext()) {
+    if (entry != m_processing) num_events++;
+  }
+  
+  fp.write(BINARY_EVENT_SIGNATURE, sizeof(BINARY_EVENT_SIGNATURE));
+  fp.write(reinterpret_cast<const char*>(&num_events), sizeof(num_events));
+  for (cEventListEntry* entry = m_head; entry != NULL; entry = entry->GetNext()) {
+    if (entry == m_processing) continue;
+    
+    int trigger = entry->GetTrigger();
+    double timing[3] = { entry->GetStart(), entry->GetInterval(), entry->GetStop() };
+    fp.write(reinterpret_cast<const char*>(&trigger), sizeof(trigger));
+    fp.write(reinterpret_cast<const char*>(timing), sizeof(timing));
+    WriteBinaryString(fp, entry->GetName());
+    WriteBinaryString(fp, entry->GetArgs());
+  }
+  
+  return fp.good();
+}
+
+
+bool cEventList::LoadBinaryEventFile(const cString& path, Feedback& feedback)
+{
+  ifstream fp((const char*)path, ios::in | ios::binary);
+  char signature[sizeof(BINARY_EVENT_SIGNATURE)];
+  int num_events = 0;
+  if (!fp.read(signature, sizeof(signature)) || !fp.read(reinterpret_cast<char*>(&num_events), sizeof(num_events))) {
+    feedback.Error("unable to read binary event file '%s'", (const char*)path);
+    return false;
+  }
+  
+  for (int i = 0; i < num_events; i++) {
+    int trigger = UNDEFINED;
+    double timing[3];
+    cString name;
+    cString args;
+    if (!fp.read(reinterpret_cast<char*>(&trigger), sizeof(trigger)) ||
+        !fp.read(reinterpret_cast<char*>(timing), sizeof(timing)) ||
+        !ReadBinaryString(fp, name) || !ReadBinaryString(fp, args)) {
+      feedback.Error("truncated binary event file '%s' at event %d", (const char*)path, i);
+      return false;
+    }
+    
+    if (!AddEvent(static_cast<eTriggerType>(trigger), timing[0], timing[1], timing[2], name, args, feedback)) return false;
+  }
+  
+  return true;
+}
+
+
 //// Parsing Event List File Format ////
 bool cEventList::AddEventFileFormat(const cString& in_line, Feedback& feedback)
 {
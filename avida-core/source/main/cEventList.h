@@ -29,6 +29,9 @@
 
 #include "tList.h"
 
+#include <cfloat>
+#include <vector>
+
 
 namespace Avida {
   class Feedback;
@@ -70,28 +73,46 @@ public:
 private:
   class cEventListEntry;  
   
+  // Scheduled entries are held in one binary heap per trigger type, ordered by the next trigger value (and then by
+  // insertion order), so that Process only touches the events that actually fire.
+  enum { QUEUE_UPDATE = 0, QUEUE_GENERATION, QUEUE_BIRTHS, NUM_QUEUES };
+  struct sQueueCompare { bool operator()(const cEventListEntry* lhs, const cEventListEntry* rhs) const; };
+  struct sIDCompare { bool operator()(const cEventListEntry* lhs, const cEventListEntry* rhs) const; };
+  
 private:
   cWorld* m_world;
   cEventListEntry* m_head;
   cEventListEntry* m_tail;
   int m_num_events;
+  int m_next_id;
+  
+  std::vector<cEventListEntry*> m_queue[NUM_QUEUES];
+  std::vector<cEventListEntry*> m_immediate;
+  cEventListEntry* m_processing;
   
   tList<double> m_birth_interrupt_queue;
   
   void QueueBirthInterruptEvent(double t_val);
   void DequeueBirthInterruptEvent(double t_val);
   
-  void SyncEvent(cEventListEntry* event);
+  bool SyncEvent(cEventListEntry* event);
   double GetTriggerValue(eTriggerType trigger) const;
   void Delete(cEventListEntry* entry);
   
+  static int QueueIndex(eTriggerType trigger);
+  void Enqueue(cEventListEntry* entry);
+  void ProcessDue(cAvidaContext& ctx, int min_id);
+  void RebuildQueues();
+  
+  bool LoadBinaryEventFile(const cString& path, Feedback& feedback);
+  
   cEventList(); // @not_implemented
   cEventList(const cEventList&); // @not_implemented
   cEventList& operator=(const cEventList&); // @not_implemented
   
   
 public:
-  cEventList(cWorld* world) : m_world(world), m_head(NULL), m_tail(NULL), m_num_events(0) { ; }
+  cEventList(cWorld* world) : m_world(world), m_head(NULL), m_tail(NULL), m_num_events(0), m_next_id(0), m_processing(NULL) { ; }
   ~cEventList();
   
   
@@ -106,8 +127,18 @@ public:
   bool AddEventFileFormat(const cString& line, Feedback& feedback);
   
   
+  /**
+   * Load an event file.  Both the text event list format and the preparsed binary format written by SaveBinaryEventFile
+   * are accepted; the binary format is recognized by its leading signature.
+   **/
   bool LoadEventFile(const cString& filename, const cString& working_dir, Feedback&  feedback);
   
+  /**
+   * Write all pending events in the preparsed binary format.  Loading the resulting file skips all event file parsing
+   * other than the construction of the actions themselves.
+   **/
+  bool SaveBinaryEventFile(const cString& filename);
+  
   void Process(cAvidaContext& ctx);
   void Sync(); // Get all events caught up.
   
@@ -145,6 +176,7 @@ private:
     double m_interval;
     double m_stop;
     double m_original_start;
+    int m_id;
     
     cEventListEntry* m_prev;
     cEventListEntry* m_next;
@@ -154,7 +186,7 @@ private:
                     double interval = TRIGGER_ONCE, double stop = TRIGGER_END, cEventListEntry* prev = NULL,
                     cEventListEntry* next = NULL)
     : m_action(action), m_name(name), m_trigger(trigger), m_start(start), m_interval(interval), m_stop(stop)
-    , m_original_start(start), m_prev(prev), m_next(next)
+    , m_original_start(start), m_id(0), m_prev(prev), m_next(next)
     {
     }
     
@@ -162,6 +194,7 @@ private:
     
     void SetPrev(cEventListEntry* prev) { m_prev = prev; }
     void SetNext(cEventListEntry* next) { m_next = next; }
+    void SetID(int id) { m_id = id; }
     
     void NextInterval(){ m_start += m_interval; }
     void Reset() { m_start = m_original_start; }
@@ -176,6 +209,10 @@ private:
     double GetStart() const { return m_start; }
     double GetInterval() const { return m_interval; }
     double GetStop() const { return m_stop; }
+    int GetID() const { return m_id; }
+    
+    // Value of the trigger variable at which this entry is next due (TRIGGER_BEGIN is due at any value)
+    double GetQueueKey() const { return (m_start == TRIGGER_BEGIN) ? -DBL_MAX : m_start; }
     
     cEventListEntry* GetPrev() const { return m_prev; }
     cEventListEntry* GetNext() const { return m_next; }
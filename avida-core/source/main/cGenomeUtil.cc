@@ -100,53 +100,192 @@ void cGenomeUtil::substring_match::rotate(int r, std::size_t n) {
 }
 
 
+namespace {
+	/*! Bit-parallel approximate substring matcher.
+	 
+	 Computes the same edit-distance table as the textbook substring-match dynamic program, but
+	 a whole column at a time: the vertical differences between adjacent cells of a column are kept
+	 as two bit vectors, one word per 32 rows of the substring, and each column of the base string
+	 is advanced with a handful of word operations (Myers' algorithm, in Hyyro's multi-word form).
+	 The base string is read through a rotation and may wrap around its end, so circular matches
+	 need no copy of the genome.
+	 
+	 Only costs come out of the bit vectors.  The beginning of the best match is then recovered by
+	 re-running the scalar dynamic program, with its exact tie-breaking, over the narrow band of
+	 columns that the best match can span.  Scratch space lives on the stack for substrings of up
+	 to MAX_INLINE_SIZE instructions.
+	 */
+	class cBitParallelMatcher {
+	public:
+		static const int WORD_BITS = 32;
+		static const int NUM_SYMBOLS = 256; // cInstruction opcodes are a single byte
+		static const int MAX_INLINE_SIZE = 128;
+		static const int MAX_INLINE_WORDS = MAX_INLINE_SIZE / WORD_BITS;
+		
+	private:
+		const Sequence& m_base;
+		const int m_base_size;
+		const int m_offset; //!< Text position k reads base[(k + m_offset) % m_base_size].
+		const int m_text_size;
+		const Sequence& m_substring;
+		const int m_size;
+		const int m_words;
+		const unsigned int m_last_bit; //!< Bit of the final word holding the substring's last row.
+		
+		unsigned int m_inline_peq[NUM_SYMBOLS * MAX_INLINE_WORDS];
+		unsigned int m_inline_pv[MAX_INLINE_WORDS];
+		unsigned int m_inline_mv[MAX_INLINE_WORDS];
+		int m_inline_band[4 * (MAX_INLINE_SIZE + 1)];
+		tArray<unsigned int> m_heap_words;
+		tArray<int> m_heap_band;
+		unsigned int* m_peq; //!< Rows at which each opcode appears in the substring, by word.
+		unsigned int* m_pv;  //!< Vertical +1 differences of the current column.
+		unsigned int* m_mv;  //!< Vertical -1 differences of the current column.
+		int* m_band;
+		
+		cBitParallelMatcher(); // @not_implemented
+		cBitParallelMatcher(const cBitParallelMatcher&); // @not_implemented
+		cBitParallelMatcher& operator=(const cBitParallelMatcher&); // @not_implemented
+		
+		int TextOp(int k) const { return m_base[(k + m_offset) % m_base_size].GetOp(); }
+		
+		void ResetColumn() {
+			for(int b=0; b<m_words; ++b) { m_pv[b] = ~0u; m_mv[b] = 0; }
+		}
+		
+		//! Advance the column over one base instruction, returning the change in the last row's cost.
+		int AdvanceColumn(int op) {
+			const unsigned int* eq_row = m_peq + op * m_words;
+			int hin = 0; // the top row is all zeros, so nothing enters the first word
+			for(int b=0; b<m_words; ++b) {
+				const unsigned int pv = m_pv[b];
+				const unsigned int mv = m_mv[b];
+				const unsigned int hin_neg = (hin < 0) ? 1u : 0u;
+				const unsigned int xv = eq_row[b] | mv;
+				const unsigned int eq = eq_row[b] | hin_neg;
+				const unsigned int xh = (((eq & pv) + pv) ^ pv) | eq;
+				unsigned int ph = mv | ~(xh | pv);
+				unsigned int mh = pv & xh;
+				
+				const unsigned int out_bit = (b == m_words - 1) ? m_last_bit : (1u << (WORD_BITS - 1));
+				int hout = 0;
+				if(ph & out_bit) { hout = 1; } else if(mh & out_bit) { hout = -1; }
+				
+				ph = (ph << 1) | ((hin > 0) ? 1u : 0u);
+				mh = (mh << 1) | hin_neg;
+				m_pv[b] = mh | ~(xv | ph);
+				m_mv[b] = ph & xv;
+				hin = hout;
+			}
+			return hin;
+		}
+		
+	public:
+		cBitParallelMatcher(const Sequence& base, int offset, int text_size, const Sequence& substring)
+		: m_base(base), m_base_size(base.GetSize()), m_offset(offset), m_text_size(text_size)
+		, m_substring(substring), m_size(substring.GetSize())
+		, m_words((substring.GetSize() + WORD_BITS - 1) / WORD_BITS)
+		, m_last_bit(1u << ((substring.GetSize() + WORD_BITS - 1) % WORD_BITS))
+		{
+			if(m_words <= MAX_INLINE_WORDS) {
+				m_peq = m_inline_peq;
+				m_pv = m_inline_pv;
+				m_mv = m_inline_mv;
+				m_band = m_inline_band;
+			} else {
+				m_heap_words.Resize((NUM_SYMBOLS + 2) * m_words);
+				m_heap_band.Resize(4 * (m_size + 1));
+				m_peq = &m_heap_words[0];
+				m_pv = m_peq + NUM_SYMBOLS * m_words;
+				m_mv = m_pv + m_words;
+				m_band = &m_heap_band[0];
+			}
+			
+			memset(m_peq, 0, sizeof(unsigned int) * NUM_SYMBOLS * m_words);
+			for(int i=0; i<m_size; ++i) {
+				m_peq[m_substring[i].GetOp() * m_words + i / WORD_BITS] |= 1u << (i % WORD_BITS);
+			}
+		}
+		
+		cGenomeUtil::substring_match FindBestMatch() {
+			// nothing to match; the empty match at the front costs nothing.
+			if(m_size == 0) {
+				return cGenomeUtil::substring_match(0, 0, 0, m_text_size);
+			}
+			
+			// first pass: cost of the best match ending at each position; the first minimum wins.
+			int cost = m_size;
+			int best_cost = m_size;
+			int best_end = 0;
+			ResetColumn();
+			for(int k=0; k<m_text_size && best_cost > 0; ++k) {
+				cost += AdvanceColumn(TextOp(k));
+				if(cost < best_cost) {
+					best_cost = cost;
+					best_end = k + 1;
+				}
+			}
+			
+			// a match ending at best_end covers at most size + cost instructions, so the scalar program
+			// only needs the columns after band_start, given the exact costs in column band_start.
+			const int band_start = std::max(0, best_end - m_size - best_cost - 1);
+			ResetColumn();
+			for(int k=0; k<band_start; ++k) {
+				AdvanceColumn(TextOp(k));
+			}
+			
+			int* prev_cost = m_band;
+			int* prev_begin = m_band + (m_size + 1);
+			int* cur_cost = m_band + 2 * (m_size + 1);
+			int* cur_begin = m_band + 3 * (m_size + 1);
+			prev_cost[0] = 0;
+			prev_begin[0] = band_start;
+			for(int i=1; i<=m_size; ++i) {
+				const int b = (i - 1) / WORD_BITS;
+				const unsigned int bit = 1u << ((i - 1) % WORD_BITS);
+				prev_cost[i] = prev_cost[i-1] + ((m_pv[b] & bit) ? 1 : 0) - ((m_mv[b] & bit) ? 1 : 0);
+				prev_begin[i] = (band_start == 0) ? 0 : -1; // -1: outside of the band, never reached
+			}
+			
+			for(int j=band_start+1; j<=best_end; ++j) {
+				const cInstruction& inst = m_base[(j - 1 + m_offset) % m_base_size];
+				cur_cost[0] = 0;
+				cur_begin[0] = j;
+				for(int i=1; i<=m_size; ++i) {
+					// candidates in the same order as the full program: upper left, above, left.
+					int c = prev_cost[i-1];
+					int s = prev_begin[i-1];
+					if(!(m_substring[i-1] == inst)) {
+						if(cur_cost[i-1] < c) { c = cur_cost[i-1]; s = cur_begin[i-1]; }
+						if(prev_cost[i] < c) { c = prev_cost[i]; s = prev_begin[i]; }
+						++c;
+					}
+					cur_cost[i] = c;
+					cur_begin[i] = s;
+				}
+				std::swap(prev_cost, cur_cost);
+				std::swap(prev_begin, cur_begin);
+			}
+			assert(prev_cost[m_size] == best_cost);
+			assert(prev_begin[m_size] >= 0);
+			
+			return cGenomeUtil::substring_match(prev_begin[m_size], best_end, best_cost, m_text_size);
+		}
+	};
+}
+
+
 /*! Find (one of) the best substring matches of substring in base.
  
  The algorithm here is based on the well-known dynamic programming approach to
  finding a substring match.  Here, it has been extended to track the beginning and
  ending locations of that match.  Specifically, [begin,end) of the returned substring_match
- denotes the matched region in the base string.
+ denotes the matched region in the base string.  The program is evaluated bit-parallel
+ (see cBitParallelMatcher above); results, ties included, are those of the plain program.
  */
 cGenomeUtil::substring_match cGenomeUtil::FindSubstringMatch(const Sequence& base, const Sequence& substring) {
-	const int rows=substring.GetSize()+1;
-	const int cols=base.GetSize()+1;
-	substring_match* m[2];
-	m[0] = new substring_match[cols];
-	m[1] = new substring_match[cols];
-	substring_match* c=m[0];
-	substring_match* p=m[1];
-	
-	for(int j=1; j<cols; ++j) {
-		p[j].begin = j;
-	}
-	
-	for(int i=1; i<rows; ++i) {
-		c[0].cost = i;
-		for(int j=1; j<cols; ++j) {
-			substring_match l[3] = {p[j-1], p[j], c[j-1]};
-			substring_match* s = &l[0]; // default match is to the upper left.
-			
-			if(substring[i-1] == base[j-1]) {
-				// if the characters match, take the default
-				c[j].cost = s->cost;
-			} else {
-				// otherwise, find the minimum cost, add 1.
-				s = std::min_element(l,l+3);
-				c[j].cost = s->cost + 1;				
-			}
-			
-			// update the beginning and end of the match.
-			c[j].begin = s->begin;
-			c[j].end = j;
-		}
-		std::swap(c,p);
-	}
-	
-	substring_match* min = std::min_element(p, p+cols);
-	min->size = base.GetSize();
-	delete [] m[0];
-	delete [] m[1];
-	return *min;
+	cBitParallelMatcher matcher(base, 0, base.GetSize(), substring);
+	return matcher.FindBestMatch();
 }
 
 
@@ -159,26 +298,20 @@ cGenomeUtil::substring_match cGenomeUtil::FindSubstringMatch(const Sequence& bas
  Genomes in Avida are logically (not physically) circular, but substring matches in general do not 
  respect circularity.  To respect the logical circularity of genomes in Avida, we append the base
  string with substring-size instructions from the beginning of the base string.  This guarantees 
- that circular matches are detected.
+ that circular matches are detected.  Neither the rotation nor the appended instructions are
+ materialized; the matcher reads the base genome through the offset.
  
  The return value here is de-circularfied and de-rotated such that [begin,end) are correct
  for the base string (note that, due to circularity, begin could be > end).
  */
 cGenomeUtil::substring_match cGenomeUtil::FindUnbiasedCircularMatch(cAvidaContext& ctx, const Sequence& base, const Sequence& substring) {
-	// create a copy of the genome:
-	Sequence circ(base);
-	
-	// rotate it so that we remove bias for matching at the front of the genome:
-	const int rotate = ctx.GetRandom().GetInt(circ.GetSize());
-	circ.Rotate(rotate);
-	
-	// need to take circularity of the genome into account.
-	// we can do this by appending the genome with a copy of its first substring-size instructions.
-	Sequence head = circ.Crop(0, substring.GetSize());
-	circ.Append(head);
+	// rotate so that we remove bias for matching at the front of the genome; position k of
+	// the rotated genome holds base[(k + size - rotate) % size].
+	const int rotate = ctx.GetRandom().GetInt(base.GetSize());
 	
 	// find the location within the circular genome that best matches substring:
-	cGenomeUtil::substring_match location = FindSubstringMatch(circ, substring);	
+	cBitParallelMatcher matcher(base, base.GetSize() - rotate, base.GetSize() + substring.GetSize(), substring);
+	cGenomeUtil::substring_match location = matcher.FindBestMatch();
 	
 	// unwind the resizing & rotation:
 	location.resize(base.GetSize());
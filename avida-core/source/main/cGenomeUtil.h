@@ -78,7 +78,7 @@ public:
 	static substring_match FindSubstringMatch(const Sequence& base, const Sequence& substring);	
 	//! Find (one of) the best unbiased matches of substring in base, respecting genome circularity.
 	static substring_match FindUnbiasedCircularMatch(cAvidaContext& ctx, const Sequence& base, const Sequence& substring);
-	typedef std::deque<Sequence> fragment_list_type; //!< Type for the list of genome fragments.
+	typedef std::deque<Sequence> fragment_list_type; //!< Type for the list of genome fragments (random access, so a fragment is picked in constant time).
 	//! Split a genome into a list of fragments, each with the given mean size and variance, and add them to the given fragment list.
 	static void RandomSplit(cAvidaContext& ctx, double mean, double variance, const Sequence& genome, fragment_list_type& fragments);
 	//! Randomly shuffle the instructions within genome in-place.
@@ -31,6 +31,7 @@
 #include "cPhenotype.h"
 #include "cStats.h"             // For GetUpdate in outputs...
 #include "cTestCPU.h"
+#include "cTestResultCache.h"
 #include "cWorld.h"
 
 
@@ -91,9 +92,22 @@ void cLandscape::Reset(const Genome& in_genome)
 
 double cLandscape::ProcessGenome(cAvidaContext& ctx, cTestCPU* testcpu, Genome& in_genome)
 {
-  testcpu->TestGenome(ctx, m_cpu_test_info, in_genome);
-  
-  double test_fitness = m_cpu_test_info.GetColonyFitness();
+  // Neighboring landscapes share many of their mutants, so their fitness may well have been found already
+  cTestResultCache* cache = m_world->GetTestResultCache();
+  cString cache_key;
+  cTestResultCache::cRecord record;
+  double test_fitness;
+  if (!cache || !cTestResultCache::BuildKey("colony_fitness", in_genome, m_cpu_test_info, cache_key) ||
+      !cache->Find(cache_key, record) || !record.Read(test_fitness)) {
+    testcpu->TestGenome(ctx, m_cpu_test_info, in_genome);
+    test_fitness = m_cpu_test_info.GetColonyFitness();
+    
+    if (cache_key.GetSize()) {
+      record.Clear();
+      record.Write(test_fitness);
+      cache->Add(cache_key, record);
+    }
+  }
   
   total_fitness += test_fitness;
   total_sqr_fitness += test_fitness * test_fitness;
@@ -184,8 +198,7 @@ void cLandscape::Process_Body(cAvidaContext& ctx, cTestCPU* testcpu, Genome& cur
       
       mod_genome[line_num].SetOp(inst_num);
       if (cur_distance <= 1) {
-        ProcessGenome(ctx, testcpu, mg);
-        if (m_cpu_test_info.GetColonyFitness() >= neut_min) site_count[line_num]++;
+        if (ProcessGenome(ctx, testcpu, mg) >= neut_min) site_count[line_num]++;
       } else {
         Process_Body(ctx, testcpu, mg, cur_distance - 1, line_num + 1);
       }
@@ -255,8 +268,7 @@ void cLandscape::ProcessDelete(cAvidaContext& ctx)
     int cur_inst = base_genome.GetSequence()[line_num].GetOp();
     mod_genome.Remove(line_num);
     mg.SetSequence(mod_genome);
-    ProcessGenome(ctx, testcpu, mg);
-    if (m_cpu_test_info.GetColonyFitness() >= neut_min) site_count[line_num]++;
+    if (ProcessGenome(ctx, testcpu, mg) >= neut_min) site_count[line_num]++;
     mod_genome.Insert(line_num, cInstruction(cur_inst));
   }
   
@@ -282,8 +294,7 @@ void cLandscape::ProcessInsert(cAvidaContext& ctx)
     for (int inst_num = 0; inst_num < inst_size; inst_num++) {
       mod_genome.Insert(line_num, cInstruction(inst_num));
       mg.SetSequence(mod_genome);
-      ProcessGenome(ctx, testcpu, mg);
-      if (m_cpu_test_info.GetColonyFitness() >= neut_min) site_count[line_num]++;
+      if (ProcessGenome(ctx, testcpu, mg) >= neut_min) site_count[line_num]++;
       mod_genome.Remove(line_num);
     }
   }
@@ -655,8 +666,7 @@ void cLandscape::BuildFitnessChart(cAvidaContext& ctx, cTestCPU* testcpu)
       }
       
       mod_genome.GetSequence()[line_num].SetOp(inst_num);
-      ProcessGenome(ctx, testcpu, mod_genome);
-      fitness_chart(line_num, inst_num) = m_cpu_test_info.GetColonyFitness();
+      fitness_chart(line_num, inst_num) = ProcessGenome(ctx, testcpu, mod_genome);
     }
     
     mod_genome.GetSequence()[line_num].SetOp(cur_inst);
@@ -38,12 +38,11 @@
 #include "cPopulationCell.h"
 #include "cMultiProcessWorld.h"
 #include "nGeometry.h"
-#include <map>
+#include <algorithm>
 #include <functional>
 #include <iostream>
 #include <sstream>
 #include <cmath>
-#include <boost/optional.hpp>
 
 using namespace Avida;
 
@@ -52,41 +51,32 @@ using namespace Avida;
 static const char* UPDATE="mean update time [ut]";
 static const char* POSTUPDATE="mean post-update time [post]";
 static const char* CALCUPDATE="mean calc-update time [calc]";
+static const char* TRANSFERS="mean organisms sent for load balancing [xfer]";
 
-/*! Message that is sent from one cMultiProcessWorld to another during organism
- migration.
+// worlds whose population is within this fraction of their balanced population are left alone.
+static const double BALANCE_TOLERANCE=0.05;
+
+// tag used for all migrant batches; messages between a pair of worlds are non-overtaking,
+// and each update's exchange completes before the next one is started.
+static const int MIGRATION_TAG=0;
+
+
+/*! Initializing constructor.
  */
-struct migration_message {
-	//! Default constructor.
-	migration_message() { }
-	
-	//! Initializing constructor.
-	migration_message(cOrganism* org, const cPopulationCell& cell, double merit, int lineage)
-	: _merit(merit), _lineage(lineage) {
-		_genome = org->GetGenome().AsString();
-		cell.GetPosition(_x, _y);
-		_generation = org->GetPhenotype().GetGeneration();
-	}
+migration_message::migration_message(cOrganism* org, const cPopulationCell& cell, double merit, int lineage, bool transfer)
+: _merit(merit), _lineage(lineage), _transfer(transfer) {
+	_genome = org->GetGenome().AsString();
+	cell.GetPosition(_x, _y);
+	_generation = org->GetPhenotype().GetGeneration();
+}
 
-	//! Finish unpacking an organism from this message.
-	void unpack(cOrganism* org) {
-		org->UpdateMerit(_merit);
-		org->GetPhenotype().SetGeneration(_generation);
-	}	
-	
-	//! Serializer, used to (de)marshal organisms for migration.
-	template<class Archive>
-	void serialize(Archive & ar, const unsigned int version) {
-		ar & _genome & _merit & _lineage & _x & _y & _generation;
-	}
-	
-	std::string _genome; //!< Genome of the migrating organism.
-	double _merit; //!< Merit of this organism in its originating population.
-	int _lineage; //!< Lineage label of this organism in its orginating population.
-	int _x; //!< X-coordinate of the cell from which this migrant originated.
-	int _y; //!< Y-coordinate of the cell from which this migrant originated.
-	int _generation; //!< Generation of this organism.
-};
+
+/*! Finish unpacking an organism from this message.
+ */
+void migration_message::unpack(cOrganism* org) {
+	org->UpdateMerit(_merit);
+	org->GetPhenotype().SetGeneration(_generation);
+}
 
 
 /*! Create and initialize a cMultiProcessWorld.
@@ -114,7 +104,9 @@ cMultiProcessWorld::cMultiProcessWorld(cAvidaConfig* cfg, const cString& cwd, bo
 , m_universe_dim(0)
 , m_universe_x(0)
 , m_universe_y(0)
-, m_universe_popsize(-1) {
+, m_universe_popsize(-1)
+, m_balance_time(0.0)
+, m_balance_updates(0) {
 	if(GetConfig().BIRTH_METHOD.Get() == POSITION_OFFSPRING_RANDOM) {
 		// there are a couple bugs in spatial that still need to be worked out:
 		// specifically, what to do about size(1) universes?
@@ -128,6 +120,41 @@ cMultiProcessWorld::cMultiProcessWorld(cAvidaConfig* cfg, const cString& cwd, bo
 		// where is *this* world in the universe?
 		m_universe_x = m_mpi_world.rank() % m_universe_dim;
 		m_universe_y = m_mpi_world.rank() / m_universe_dim;
+		
+		// spatial worlds only exchange migrants with their neighbors (the halo):
+		if(m_universe_x > 0) m_peers.push_back(m_mpi_world.rank() - 1);
+		if(m_universe_x < (m_universe_dim-1)) m_peers.push_back(m_mpi_world.rank() + 1);
+		if(m_universe_y > 0) m_peers.push_back(m_mpi_world.rank() - m_universe_dim);
+		if(m_universe_y < (m_universe_dim-1)) m_peers.push_back(m_mpi_world.rank() + m_universe_dim);
+	} else {
+		// mass action worlds exchange migrants with every other world:
+		for(int i=0; i<m_mpi_world.size(); ++i) {
+			if(i != m_mpi_world.rank()) {
+				m_peers.push_back(i);
+			}
+		}
+	}
+	
+	m_outbox.resize(m_mpi_world.size());
+	m_sending.resize(m_mpi_world.size());
+	m_inbox.resize(m_mpi_world.size());
+	
+	// organisms are moved without regard to where they live, which is only sound under mass action:
+	if((GetConfig().MP_LOAD_BALANCE_INTERVAL.Get() > 0)
+		 && (GetConfig().BIRTH_METHOD.Get() != POSITION_OFFSPRING_FULL_SOUP_RANDOM)) {
+		GetDriver().RaiseFatalException(-1, "MP_LOAD_BALANCE_INTERVAL requires mass action (BIRTH_METHOD 4).");
+	}
+}
+
+
+/*! Destructor.
+ 
+ Every world posts the same exchanges each update, so the final update's exchange
+ is matched and can be completed here (provided MPI is still running).
+ */
+cMultiProcessWorld::~cMultiProcessWorld() {
+	if(!boost::mpi::environment::finalized()) {
+		boost::mpi::wait_all(m_reqs.begin(), m_reqs.end());
 	}
 }
 
@@ -184,9 +211,8 @@ void cMultiProcessWorld::MigrateOrganism(cOrganism* org, const cPopulationCell&
 	assert(dst_world < m_mpi_world.size());
 	assert(dst_world >= 0);
 
-	// the tag is set to the number of messages previously sent; this is to allow
-	// the receiver to sort messages for consistency.
-	m_reqs.push_back(m_mpi_world.isend(dst_world, m_reqs.size(), migration_message(org, cell, merit.GetDouble(), lineage)));
+	// migrants are batched per destination, and sent all at once in ProcessPostUpdate:
+	m_outbox[dst_world].push_back(migration_message(org, cell, merit.GetDouble(), lineage));
 	
 	// stats tracking:
 	GetStats().OutgoingMigrant(org);
@@ -213,7 +239,7 @@ bool cMultiProcessWorld::TestForMigration() {
 			if(m_mpi_world.size() == 1) {
 				return true; // 1 world == always migrate
 			}
-			return GetRandom().P((m_mpi_world.size() - 1) / m_mpi_world.size());
+			return GetRandom().P(static_cast<double>(m_mpi_world.size() - 1) / m_mpi_world.size());
 		}
 		default: {
 			// default is to not migrate!
@@ -259,93 +285,69 @@ bool cMultiProcessWorld::IsWorldBoundary(const cPopulationCell& cell) {
 /*! Process post-update events.
  
  This method is called after each update of the local population completes.  Here
- we check to see if this world has received any migrants from other worlds, and if
- so, we inject them into the local population.  Note that this is an unconditional
+ we inject the migrants that other worlds sent during the *previous* update, and then
+ start the exchange of this update's migrants.  Note that this is an unconditional
  injection -- that is, migrants are "pushed" to this world.
  
- Migrants are injected according to BIRTH_METHOD.
+ Each world sends exactly one (possibly empty) batch to, and receives exactly one batch
+ from, each of its peers per update.  These transfers are non-blocking and overlap with
+ the execution of the next update, so there are no global barriers here; the only wait
+ is for the previous update's exchange, which has had a full update to complete.
  
- \todo What to do about cross-world lineage labels?
+ Migrants are injected according to BIRTH_METHOD, in order of source rank.
  
- \todo At the moment, this method forces synchronization on update boundaries across
- *all* worlds.  This could slow things down quite a bit, so we may need to consider a
- second mode that relaxes consistency in favor of speed.
+ \todo What to do about cross-world lineage labels?
  */
 void cMultiProcessWorld::ProcessPostUpdate(cAvidaContext& ctx) {
 	namespace mpi = boost::mpi;
-	using namespace boost;
 	
 	// restart the timer for this method, and get the elapsed time for the past update:
 	m_pf[UPDATE] = m_update_timer.elapsed();
 	m_post_update_timer.restart();
 	
-	// wait until we're sure that this process has sent all its messages:
+	// complete the exchange that was started at the end of the previous update:
 	mpi::wait_all(m_reqs.begin(), m_reqs.end());
 	m_reqs.clear();
 	
-	// at this point, we know that *this* process has sent everything.  but, we don't
-	// know if it's *received* everything.  so, we're going to put in a synchronization
-	// barrier, which means that every process must reach the barrier before any are allowed
-	// to proceed.  since we just finished waiting for all communication to complete,
-	// this means that all messages must have been received, too.
-	m_mpi_world.barrier();	
-	
-	// now, receive all the messages, but store them in order by source and tag:
-	typedef std::map<int,migration_message> rx_tag_t;
-	typedef std::map<int,rx_tag_t> rx_src_t;
-	rx_src_t recvd;
-	optional<mpi::status> s = m_mpi_world.iprobe(mpi::any_source,mpi::any_tag);
-	while(s.is_initialized()) {
-		migration_message msg;
-		m_mpi_world.recv(s->source(), s->tag(), msg);
-		recvd[s->source()][s->tag()] = msg;		
-		// any others?
-		s = m_mpi_world.iprobe(mpi::any_source,mpi::any_tag);		
+	// iterate over received batches in-order, injecting genomes into our population:
+	for(std::size_t src=0; src<m_inbox.size(); ++src) {
+		for(std::size_t i=0; i<m_inbox[src].size(); ++i) {
+			InjectMigrant(m_inbox[src][i], ctx);
+		}
+		m_inbox[src].clear();
 	}
 	
-	// iterate over received messages in-order, injecting genomes into our population:
-	for(rx_src_t::iterator i=recvd.begin(); i!=recvd.end(); ++i) {
-		for(rx_tag_t::iterator j=i->second.begin(); j!=i->second.end(); ++j) {
-			//std::cerr << "**********  INJECTING *********** " << i->first << " " << j->first << std::endl;
-			// ok, add this migrant to the current population
-			migration_message& migrant = j->second;
-			int target_cell=-1;
-			
-			switch(GetConfig().BIRTH_METHOD.Get()) {
-				case POSITION_OFFSPRING_RANDOM: { // spatial
-					// invert the orginating cell
-					migrant._x = GetConfig().WORLD_X.Get() - migrant._x - 1;
-					migrant._y = GetConfig().WORLD_Y.Get() - migrant._y - 1;
-					target_cell = GetConfig().WORLD_Y.Get() * migrant._y + migrant._x;
-					break;
-				}
-				case POSITION_OFFSPRING_FULL_SOUP_RANDOM: { // mass action
-					target_cell = GetRandom().GetInt(GetPopulation().GetSize());
-					break;
-				}
-				default: {
-					GetDriver().RaiseFatalException(-1, "Avida-MP only supports BIRTH_METHODS 0 (POSITION_OFFSPRING_RANDOM) and 4 (POSITION_OFFSPRING_FULL_SOUP_RANDOM).");
-				}
-			}
-			
-			GetPopulation().InjectGenome(target_cell,
-																	 SRC_ORGANISM_RANDOM, // for right now, we'll treat this as a random organism injection
-																	 Genome(cString(migrant._genome.c_str())), // genome unpacked from message
-																	 ctx, migrant._lineage); // lineage label
-			// unpack the rest from the message:
-			migrant.unpack(GetPopulation().GetCell(target_cell).GetOrganism());
-			GetStats().IncomingMigrant(GetPopulation().GetCell(target_cell).GetOrganism());
+	// periodically even out the load across worlds.  transfers are placed in the outbox,
+	// and so go out with this update's exchange:
+	if(GetConfig().MP_LOAD_BALANCE_INTERVAL.Get() > 0) {
+		m_balance_time += m_pf[UPDATE];
+		int transfers = 0;
+		if(++m_balance_updates >= GetConfig().MP_LOAD_BALANCE_INTERVAL.Get()) {
+			transfers = BalanceLoad(ctx);
+			m_balance_time = 0.0;
+			m_balance_updates = 0;
 		}
+		m_pf[TRANSFERS] = transfers;
 	}
 	
-	// oh, sweet sanity; make sure that we actually processed all messages.
-	assert(!m_mpi_world.iprobe(mpi::any_source,mpi::any_tag).is_initialized());
+	// the previous update's batches have been delivered; this update's migrants are now
+	// in flight (m_sending), and the outbox is free to be refilled:
+	m_sending.swap(m_outbox);
+	for(std::size_t i=0; i<m_outbox.size(); ++i) {
+		m_outbox[i].clear();
+	}
+	
+	// start this update's exchange:
+	for(std::size_t i=0; i<m_peers.size(); ++i) {
+		int peer = m_peers[i];
+		m_reqs.push_back(m_mpi_world.isend(peer, MIGRATION_TAG, m_sending[peer]));
+		m_reqs.push_back(m_mpi_world.irecv(peer, MIGRATION_TAG, m_inbox[peer]));
+	}
+	
+	// migrants that stay in this world (only possible in a single-world universe) are
+	// delivered locally, on the same schedule as the rest:
+	m_inbox[m_mpi_world.rank()].swap(m_sending[m_mpi_world.rank()]);
 	
-	// finally, we need another barrier down here, in the off chance that one of the
-	// processes is really speedy and manages to migrate another org to this world
-	// before we finished the probe-loop.
-	m_mpi_world.barrier();
-
 	// record profiling stats:
 	m_pf[POSTUPDATE] = m_post_update_timer.elapsed();
 	GetStats().ProfilingData(m_pf);
@@ -356,6 +358,159 @@ void cMultiProcessWorld::ProcessPostUpdate(cAvidaContext& ctx) {
 }
 
 
+/*! Inject a migrant that was received from another world into the local population.
+ */
+void cMultiProcessWorld::InjectMigrant(migration_message& migrant, cAvidaContext& ctx) {
+	int target_cell=-1;
+	
+	switch(GetConfig().BIRTH_METHOD.Get()) {
+		case POSITION_OFFSPRING_RANDOM: { // spatial
+			// invert the orginating cell
+			migrant._x = GetConfig().WORLD_X.Get() - migrant._x - 1;
+			migrant._y = GetConfig().WORLD_Y.Get() - migrant._y - 1;
+			target_cell = GetConfig().WORLD_Y.Get() * migrant._y + migrant._x;
+			break;
+		}
+		case POSITION_OFFSPRING_FULL_SOUP_RANDOM: { // mass action
+			target_cell = migrant._transfer ? FindTransferCell() : GetRandom().GetInt(GetPopulation().GetSize());
+			break;
+		}
+		default: {
+			GetDriver().RaiseFatalException(-1, "Avida-MP only supports BIRTH_METHODS 0 (POSITION_OFFSPRING_RANDOM) and 4 (POSITION_OFFSPRING_FULL_SOUP_RANDOM).");
+		}
+	}
+	
+	GetPopulation().InjectGenome(target_cell,
+															 SRC_ORGANISM_RANDOM, // for right now, we'll treat this as a random organism injection
+															 Genome(cString(migrant._genome.c_str())), // genome unpacked from message
+															 ctx, migrant._lineage); // lineage label
+	// unpack the rest from the message:
+	migrant.unpack(GetPopulation().GetCell(target_cell).GetOrganism());
+	if(!migrant._transfer) {
+		GetStats().IncomingMigrant(GetPopulation().GetCell(target_cell).GetOrganism());
+	}
+}
+
+
+/*! Move organisms from slower to faster worlds.
+ 
+ Every world shares the clock-time of its updates since the last balancing step, along
+ with its population size.  A world's throughput is the number of organisms it runs per
+ unit time, and the total population is divided among worlds in proportion to throughput,
+ which evens out update times.  Each world over its share sends half of the difference
+ (to damp oscillation) to worlds under their share.  All worlds compute the same plan
+ from the gathered values, pairing donors with receivers in rank order.
+ 
+ Organisms are moved with the state carried by migration_message (genome, merit,
+ generation, and lineage label); they are placed into empty cells of the receiving world
+ when possible, and are not counted as migrants.  Everything else is lost in the move:
+ a moved organism is re-injected, so it starts over with a new phenotype (task counts,
+ age, gestation state) and fresh hardware, mid-gestation progress included.  Balancing
+ therefore perturbs the organisms it moves, and should be run only as often as needed.
+ */
+int cMultiProcessWorld::BalanceLoad(cAvidaContext& ctx) {
+	const int size = m_mpi_world.size();
+	const int rank = m_mpi_world.rank();
+	
+	double local[2] = { m_balance_time, static_cast<double>(GetPopulation().GetNumOrganisms()) };
+	std::vector<double> load;
+	all_gather(m_mpi_world, local, 2, load);
+	
+	// throughput of each world; worlds with nothing measured are assumed to be average:
+	std::vector<double> throughput(size, 0.0);
+	double measured_throughput = 0.0;
+	int measured = 0;
+	double total_orgs = 0.0;
+	for(int i=0; i<size; ++i) {
+		total_orgs += load[2*i+1];
+		if((load[2*i] > 0.0) && (load[2*i+1] > 0.0)) {
+			throughput[i] = load[2*i+1] / load[2*i];
+			measured_throughput += throughput[i];
+			++measured;
+		}
+	}
+	if(measured == 0) {
+		return 0;
+	}
+	double total_throughput = 0.0;
+	for(int i=0; i<size; ++i) {
+		if(throughput[i] == 0.0) {
+			throughput[i] = measured_throughput / measured;
+		}
+		total_throughput += throughput[i];
+	}
+	
+	// how many organisms each world should give up (positive) or take on (negative):
+	std::vector<int> surplus(size, 0);
+	for(int i=0; i<size; ++i) {
+		double target = std::min(total_orgs * throughput[i] / total_throughput, static_cast<double>(GetPopulation().GetSize()));
+		double excess = load[2*i+1] - target;
+		if(std::fabs(excess) > (BALANCE_TOLERANCE * target)) {
+			surplus[i] = static_cast<int>(excess / 2.0);
+		}
+	}
+	
+	// pair donors with receivers:
+	std::vector<int> send(size, 0);
+	int to_send = 0;
+	int d=0, r=0;
+	while(true) {
+		while((d < size) && (surplus[d] <= 0)) ++d;
+		while((r < size) && (surplus[r] >= 0)) ++r;
+		if((d == size) || (r == size)) break;
+		int count = std::min(surplus[d], -surplus[r]);
+		surplus[d] -= count;
+		surplus[r] += count;
+		if(d == rank) {
+			send[r] += count;
+			to_send += count;
+		}
+	}
+	if(to_send == 0) {
+		return 0;
+	}
+	
+	// this world is a donor; pick the organisms to send at random (without replacement):
+	std::vector<int> occupied;
+	for(int i=0; i<GetPopulation().GetSize(); ++i) {
+		if(GetPopulation().GetCell(i).IsOccupied()) {
+			occupied.push_back(i);
+		}
+	}
+	
+	int sent = 0;
+	for(int dst=0; dst<size; ++dst) {
+		for(int i=0; (i<send[dst]) && !occupied.empty(); ++i) {
+			int pick = GetRandom().GetInt(occupied.size());
+			cPopulationCell& cell = GetPopulation().GetCell(occupied[pick]);
+			occupied[pick] = occupied.back();
+			occupied.pop_back();
+			
+			cOrganism* org = cell.GetOrganism();
+			m_outbox[dst].push_back(migration_message(org, cell, org->GetPhenotype().GetMerit().GetDouble(), org->GetLineageLabel(), true));
+			GetPopulation().KillOrganism(cell, ctx);
+			++sent;
+		}
+	}
+	return sent;
+}
+
+
+/*! Returns a cell for an organism moved here for load balancing, preferring empty cells.
+ */
+int cMultiProcessWorld::FindTransferCell() {
+	const int size = GetPopulation().GetSize();
+	int start = GetRandom().GetInt(size);
+	for(int i=0; i<size; ++i) {
+		int cell_id = (start + i) % size;
+		if(!GetPopulation().GetCell(cell_id).IsOccupied()) {
+			return cell_id;
+		}
+	}
+	return start;
+}
+
+
 /*! Returns true if this world allows early exits, e.g., when the population reaches 0.
  */
 bool cMultiProcessWorld::AllowsEarlyExit() const
@@ -386,25 +541,18 @@ int cMultiProcessWorld::CalculateUpdateSize()
 			break;
 		}
 		case MP_SCHEDULING_INTEGRATED: { // MP aware
-			// sum the total number of organisms in all populations, storing that value
-			// so that we know if we have to exit early:
-			all_reduce(m_mpi_world, GetPopulation().GetNumOrganisms(), m_universe_popsize, std::plus<int>());
+			// sum the total number of organisms and the total merit of all populations in a
+			// single reduction.  the local merit total is maintained incrementally by the
+			// scheduler, so there's no need to scan the population:
+			double local[2] = { static_cast<double>(GetPopulation().GetNumOrganisms()), GetPopulation().GetTotalScheduledMerit() };
+			double total[2] = { 0.0, 0.0 };
+			all_reduce(m_mpi_world, local, 2, total, std::plus<double>());
 			
-			// sum the merits of organisms in all populations.
-			// there's no clean way to do this across the different schedulers in avida,
-			// so we'll take the O(n) hit and sum them (for now):
-			double local_merit=0.0;
-			for(int i=0; i<GetPopulation().GetSize(); ++i) {
-				cPopulationCell& cell=GetPopulation().GetCell(i);
-				if(cell.IsOccupied()) {
-					local_merit += cell.GetOrganism()->GetPhenotype().GetMerit().GetDouble();
-				}
-			}
-			double total_merit;
-			all_reduce(m_mpi_world, local_merit, total_merit, std::plus<double>());
+			// store the universe size so that we know if we have to exit early:
+			m_universe_popsize = static_cast<int>(total[0] + 0.5);
 			
 			// ok, calculate the total CPU cycles allotted to this population:
-			update_size = (local_merit/total_merit) * GetConfig().AVE_TIME_SLICE.Get() * m_universe_popsize;
+			update_size = (local[1]/total[1]) * GetConfig().AVE_TIME_SLICE.Get() * m_universe_popsize;
 			break;
 		}
 		default: {
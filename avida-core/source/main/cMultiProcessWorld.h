@@ -25,13 +25,47 @@
 #include <boost/mpi.hpp>
 #include <boost/mpi/environment.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
 #include <boost/timer.hpp>
+#include <string>
 #include <vector>
 
 #include "cWorld.h"
 #include "cAvidaConfig.h"
 #include "cStats.h"
 
+class cOrganism;
+class cPopulationCell;
+
+/*! Message that is sent from one cMultiProcessWorld to another during organism
+ migration.
+ */
+struct migration_message {
+	//! Default constructor.
+	migration_message() { }
+	
+	//! Initializing constructor.
+	migration_message(cOrganism* org, const cPopulationCell& cell, double merit, int lineage, bool transfer=false);
+	
+	//! Finish unpacking an organism from this message.
+	void unpack(cOrganism* org);
+	
+	//! Serializer, used to (de)marshal organisms for migration.
+	template<class Archive>
+	void serialize(Archive & ar, const unsigned int version) {
+		ar & _genome & _merit & _lineage & _x & _y & _generation & _transfer;
+	}
+	
+	std::string _genome; //!< Genome of the migrating organism.
+	double _merit; //!< Merit of this organism in its originating population.
+	int _lineage; //!< Lineage label of this organism in its orginating population.
+	int _x; //!< X-coordinate of the cell from which this migrant originated.
+	int _y; //!< Y-coordinate of the cell from which this migrant originated.
+	int _generation; //!< Generation of this organism.
+	bool _transfer; //!< True if this organism was moved for load balancing, rather than migrating at birth.
+};
+
 /*! Multi-process Avida world.
  
  This class enables multi-process Avida, which provides a mechanism for much larger
@@ -39,6 +73,15 @@
  a single new technique, that of "cross-world migration," where an individual organism
  is transferred to a different Avida world and injected into a random location in that
  world's population.
+ 
+ Migrants are batched per destination world, and each update's batches are exchanged
+ with non-blocking sends and receives that complete during the following update.  As a
+ result, a migrant arrives in its destination world one update after it left.
+ 
+ Under mass action, worlds can also be load balanced (MP_LOAD_BALANCE_INTERVAL): the
+ measured update times are periodically shared, and organisms are moved from worlds
+ that are slower than average to those that are faster, so that update times even out.
+ Moved organisms are re-injected with only their migration_message state.
  */
 class cMultiProcessWorld : public cWorld
 	{
@@ -50,6 +93,12 @@ class cMultiProcessWorld : public cWorld
 	protected:
 		boost::mpi::environment& m_mpi_env; //!< MPI environment.
 		boost::mpi::communicator& m_mpi_world; //!< World-wide MPI communicator.
+		
+		typedef std::vector<migration_message> migrant_batch_t; //!< Migrants sent from one world to another in a single update.
+		std::vector<int> m_peers; //!< Ranks of the worlds that exchange migrants with this one.
+		std::vector<migrant_batch_t> m_outbox; //!< Migrants leaving during the current update, indexed by destination rank.
+		std::vector<migrant_batch_t> m_sending; //!< Batches in flight, indexed by destination rank.
+		std::vector<migrant_batch_t> m_inbox; //!< Batches being received, indexed by source rank.
 		std::vector<boost::mpi::request> m_reqs; //!< Requests outstanding since the last ProcessPostUpdate.
 		int m_universe_dim; //!< Dimension (x & y) of the universe (number of worlds along the side of a grid of worlds).
 		int m_universe_x; //!< X coordinate of this world.
@@ -61,15 +110,27 @@ class cMultiProcessWorld : public cWorld
 		boost::timer m_calc_update_timer; //!< Tracks the clock-time of calculating the update size.
 		cStats::profiling_stats_t m_pf; //!< Buffers profiling stats until the post-update step.
 		
+		double m_balance_time; //!< Clock-time of updates since the last load balancing step.
+		int m_balance_updates; //!< Number of updates since the last load balancing step.
+		
 		//! Constructor (prefer Initialize).
 		cMultiProcessWorld(cAvidaConfig* cfg, const cString& cwd, boost::mpi::environment& env, boost::mpi::communicator& worldcomm);
+		
+		//! Inject a migrant that was received from another world into the local population.
+		void InjectMigrant(migration_message& migrant, cAvidaContext& ctx);
+		
+		//! Move organisms from slower to faster worlds; returns the number of organisms sent.
+		int BalanceLoad(cAvidaContext& ctx);
+		
+		//! Returns a cell for an organism moved here for load balancing, preferring empty cells.
+		int FindTransferCell();
 
 	public:
 		//! Create and initialize a cMultiProcessWorld.
 		static cMultiProcessWorld* Initialize(cAvidaConfig* cfg, const cString& cwd, boost::mpi::environment& env, boost::mpi::communicator& worldcomm);
 		
 		//! Destructor.
-		virtual ~cMultiProcessWorld() { }
+		virtual ~cMultiProcessWorld();
 		
 		//! Migrate this organism to a different world.
 		virtual void MigrateOrganism(cOrganism* org, const cPopulationCell& cell,
@@ -91,7 +91,8 @@ public:
   virtual void SetPrevSeenCellID(int in_id) = 0;
   virtual void SetPrevTaskCellID(int in_id) = 0;
 
-  virtual bool Divide(cAvidaContext& ctx, cOrganism* parent, const Genome& offspring_genome) = 0;
+  // The offspring genome is handed on to the new organism(s) rather than copied; its contents are not preserved
+  virtual bool Divide(cAvidaContext& ctx, cOrganism* parent, Genome& offspring_genome) = 0;
   
   virtual cOrganism* GetNeighbor() = 0;
   virtual bool IsNeighborCellOccupied() = 0;
@@ -57,57 +57,12 @@ cOrganism::cOrganism(cWorld* world, cAvidaContext& ctx, const Genome& genome, in
 , m_src(src)
 , m_src_args(src_args)
 , m_initial_genome(genome)
-, m_interface(NULL)
-, m_lineage_label(-1)
-, m_lineage(NULL)
-, m_org_list_index(-1)
-, m_org_display(NULL)
-, m_queued_display_data(NULL)
-, m_display(false)
-, m_input_pointer(0)
 , m_input_buf(world->GetEnvironment().GetInputSize())
 , m_output_buf(world->GetEnvironment().GetOutputSize())
 , m_received_messages(RECEIVED_MESSAGES_SIZE)
-, m_cur_sg(0)
-, m_sent_value(0)
-, m_sent_active(false)
-, m_test_receive_pos(0)
-, m_pher_drop(false)
-, frac_energy_donating(m_world->GetConfig().ENERGY_SHARING_PCT.Get())
-, m_max_executed(-1)
-, m_is_running(false)
-, m_is_sleeping(false)
-, m_is_dead(false)
-, killed_event(false)
-, m_net(NULL)
-, m_msg(0)
-, m_opinion(0)
-, m_neighborhood(0)
-, m_self_raw_materials(world->GetConfig().RAW_MATERIAL_AMOUNT.Get())
-, m_other_raw_materials(0)
-, m_num_donate(0)
-, m_num_donate_received(0)
-, m_amount_donate_received(0)
-, m_num_reciprocate(0)
-, m_failed_reputation_increases(0)
-, m_tag(make_pair(-1, 0))
-, m_northerly(0)
-, m_easterly(0)
-, m_forage_target(-1)
-, m_has_set_ft(false)
-, m_teach(false)
-, m_parent_teacher(false)
-, m_parent_ft(-1)
-, m_parent_group(world->GetConfig().DEFAULT_GROUP.Get())
-, m_beggar(false)
-, m_guard(false)
-, m_num_guard(0)
-, m_num_deposits(0)
-, m_amount_deposited(0)
-, m_num_point_mut(0)
-, m_av_in_index(-1)
-, m_av_out_index(-1)
 {
+  setDefaults();
+  
 	// initializing this here because it may be needed during hardware creation:
 	m_id = m_world->GetStats().GetTotCreatures();
   
@@ -116,6 +71,79 @@ cOrganism::cOrganism(cWorld* world, cAvidaContext& ctx, const Genome& genome, in
   initialize(ctx);
 }
 
+cOrganism::cOrganism(cWorld* world, cAvidaContext& ctx, Genome* genome, int parent_generation, eBioUnitSource src)
+: m_world(world)
+, m_phenotype(world, parent_generation, world->GetHardwareManager().GetInstSet(genome->GetInstSet()).GetNumNops())
+, m_src(src)
+, m_input_buf(world->GetEnvironment().GetInputSize())
+, m_output_buf(world->GetEnvironment().GetOutputSize())
+, m_received_messages(RECEIVED_MESSAGES_SIZE)
+{
+  setDefaults();
+  
+  // Take the genome over rather than copying it; the hardware's memory is then the only copy made of the sequence
+  m_initial_genome.Swap(*genome);
+  
+	// initializing this here because it may be needed during hardware creation:
+	m_id = m_world->GetStats().GetTotCreatures();
+  
+  m_hardware = m_world->GetHardwareManager().Create(ctx, this, m_initial_genome);
+  
+  initialize(ctx);
+}
+
+
+void cOrganism::setDefaults()
+{
+  m_interface = NULL;
+  m_lineage_label = -1;
+  m_lineage = NULL;
+  m_org_list_index = -1;
+  m_org_display = NULL;
+  m_queued_display_data = NULL;
+  m_display = false;
+  m_input_pointer = 0;
+  m_cur_sg = 0;
+  m_sent_value = 0;
+  m_sent_active = false;
+  m_test_receive_pos = 0;
+  m_pher_drop = false;
+  frac_energy_donating = m_world->GetConfig().ENERGY_SHARING_PCT.Get();
+  m_max_executed = -1;
+  m_is_running = false;
+  m_is_sleeping = false;
+  m_is_dead = false;
+  killed_event = false;
+  m_net = NULL;
+  m_msg = 0;
+  m_opinion = 0;
+  m_neighborhood = 0;
+  m_self_raw_materials = m_world->GetConfig().RAW_MATERIAL_AMOUNT.Get();
+  m_other_raw_materials = 0;
+  m_num_donate = 0;
+  m_num_donate_received = 0;
+  m_amount_donate_received = 0;
+  m_num_reciprocate = 0;
+  m_failed_reputation_increases = 0;
+  m_tag = make_pair(-1, 0);
+  m_northerly = 0;
+  m_easterly = 0;
+  m_forage_target = -1;
+  m_has_set_ft = false;
+  m_teach = false;
+  m_parent_teacher = false;
+  m_parent_ft = -1;
+  m_parent_group = m_world->GetConfig().DEFAULT_GROUP.Get();
+  m_beggar = false;
+  m_guard = false;
+  m_num_guard = 0;
+  m_num_deposits = 0;
+  m_amount_deposited = 0;
+  m_num_point_mut = 0;
+  m_av_in_index = -1;
+  m_av_out_index = -1;
+}
+
 
 
 void cOrganism::initialize(cAvidaContext& ctx)
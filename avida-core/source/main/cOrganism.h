@@ -71,7 +71,7 @@ private:
   cPhenotype m_phenotype;                 // Descriptive attributes of organism.
   eBioUnitSource m_src;
   cString m_src_args;
-  const Genome m_initial_genome;         // Initial genome; can never be changed!
+  Genome m_initial_genome;               // Initial genome; never changed after construction!
   tArray<cBioUnit*> m_parasites;   // List of all parasites associated with this organism.
   cMutationRates m_mut_rates;             // Rate of all possible mutations.
   cOrgInterface* m_interface;             // Interface back to the population.
@@ -137,6 +137,8 @@ private:
 public:
   cOrganism(cWorld* world, cAvidaContext& ctx, const Genome& genome, int parent_generation,
     eBioUnitSource src, const cString& src_args = "");
+  // Build an organism that takes over the contents of *genome (leaving it empty) rather than copying them
+  cOrganism(cWorld* world, cAvidaContext& ctx, Genome* genome, int parent_generation, eBioUnitSource src);
   ~cOrganism();
 
   // --------  cBioUnit Methods  --------
@@ -753,6 +755,7 @@ private:
   int m_av_in_index;
   int m_av_out_index;
   
+  void setDefaults();
   void initialize(cAvidaContext& ctx);
 
   /*! The main DoOutput function.  The DoOutputs above all forward to this function. */
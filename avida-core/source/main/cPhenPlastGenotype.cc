@@ -20,9 +20,193 @@
  */
 
 #include "cPhenPlastGenotype.h"
+
+#include "apto/platform.h"
+
+#include "cAvidaContext.h"
+#include "cCPUTestInfo.h"
+#include "cRandom.h"
+#include "cTestCPU.h"
+#include "tParallelRange.h"
+
 #include <iostream>
 #include <cmath>
 #include <cfloat>
+#include <map>
+
+
+// What a replayable trial depended on: the leading inputs and receive values its organisms read.  Any other trial
+// that starts with the same values would run identically, so it need not be run at all.
+struct cPhenPlastGenotype::sTrialTrace
+{
+  cPlasticPhenotype* phenotype;  // Where the trial was tallied
+  bool replayable;    // Execution drew on nothing but the inputs (no random numbers)
+  tArray<int> inputs;
+  tArray<int> receive;
+  
+  bool Matches(const tArray<int>& trial_inputs, const tArray<int>& trial_receive) const
+  {
+    for (int i = 0; i < inputs.GetSize(); i++) if (inputs[i] != trial_inputs[i]) return false;
+    for (int i = 0; i < receive.GetSize(); i++) if (receive[i] != trial_receive[i]) return false;
+    return true;
+  }
+};
+
+
+// cTraceIndex - the replayable traces seen so far, grouped by how many inputs and receive values their trials read
+class cTraceIndex
+{
+private:
+  typedef std::map<std::vector<int>, cPlasticPhenotype*> PrefixMap;
+  struct sGroup
+  {
+    int num_inputs;
+    int num_receive;
+    PrefixMap prefixes;
+  };
+  std::vector<sGroup> m_groups;
+  
+  static void makeKey(const tArray<int>& inputs, const tArray<int>& receive, int num_inputs, int num_receive,
+                      std::vector<int>& key)
+  {
+    key.resize(num_inputs + num_receive);
+    for (int i = 0; i < num_inputs; i++) key[i] = inputs[i];
+    for (int i = 0; i < num_receive; i++) key[num_inputs + i] = receive[i];
+  }
+  
+public:
+  bool IsEmpty() const { return m_groups.size() == 0; }
+  
+  void Add(const tArray<int>& inputs, const tArray<int>& receive, cPlasticPhenotype* phenotype)
+  {
+    size_t g = 0;
+    while (g < m_groups.size() &&
+           (m_groups[g].num_inputs != inputs.GetSize() || m_groups[g].num_receive != receive.GetSize())) g++;
+    if (g == m_groups.size()) {
+      m_groups.push_back(sGroup());
+      m_groups[g].num_inputs = inputs.GetSize();
+      m_groups[g].num_receive = receive.GetSize();
+    }
+    std::vector<int> key;
+    makeKey(inputs, receive, inputs.GetSize(), receive.GetSize(), key);
+    m_groups[g].prefixes.insert(std::make_pair(key, phenotype));
+  }
+  
+  // The phenotype of a replayable trial whose leading inputs these are, or NULL if there is none
+  cPlasticPhenotype* Find(const tArray<int>& inputs, const tArray<int>& receive) const
+  {
+    std::vector<int> key;
+    for (size_t g = 0; g < m_groups.size(); g++) {
+      makeKey(inputs, receive, m_groups[g].num_inputs, m_groups[g].num_receive, key);
+      PrefixMap::const_iterator it = m_groups[g].prefixes.find(key);
+      if (it != m_groups[g].prefixes.end()) return it->second;
+    }
+    return NULL;
+  }
+};
+
+
+// cTrialRunner - runs trials of one genome on a test CPU of its own
+//
+// Every trial draws its inputs, and any randomness during execution, from a generator seeded for that trial alone, so
+// its result is the same whichever runner (or thread) evaluates it.  That includes code that draws from the world's
+// generator directly, which is pointed at the trial's generator for as long as the trial runs.  Runners share nothing
+// but the world, and take a private copy of the genome so that its strings are not reference counted across threads.
+class cPhenPlastGenotype::cTrialRunner
+{
+private:
+  cWorld* m_world;
+  cAvidaContext& m_parent_ctx;
+  Genome m_genome;
+  cCPUTestInfo m_test_info;
+  cTestCPU* m_test_cpu;
+  
+  cTrialRunner(); // @not_implemented
+  cTrialRunner(const cTrialRunner&); // @not_implemented
+  cTrialRunner& operator=(const cTrialRunner&); // @not_implemented
+  
+  void setupContext(cAvidaContext& ctx)
+  {
+    if (m_parent_ctx.GetAnalyzeMode()) ctx.SetAnalyzeMode();
+    if (m_parent_ctx.OrgFaultReporting()) ctx.EnableOrgFaultReporting();
+  }
+  
+public:
+  cTrialRunner(cWorld* world, cAvidaContext& ctx, const cCPUTestInfo& test_info, const Genome& genome, int seed)
+    : m_world(world), m_parent_ctx(ctx)
+    , m_genome(genome.GetHardwareType(), cString(static_cast<const char*>(genome.GetInstSet())), genome.GetSequence())
+    , m_test_info(test_info.GetGenerationTests())
+  {
+    m_test_info.CopySettings(test_info);
+    m_test_info.SetTraceExecution(test_info.GetTracer());
+    cRandom rng(seed);
+    cAvidaContext setup_ctx(m_world, rng);
+    setupContext(setup_ctx);
+    cRandom* prev_rng = m_world->SetThreadRandom(&rng);
+    m_test_cpu = m_world->GetHardwareManager().CreateTestCPU(setup_ctx);
+    m_world->SetThreadRandom(prev_rng);
+  }
+  ~cTrialRunner() { delete m_test_cpu; }
+  
+  void DrawInputs(int seed, tArray<int>& inputs, tArray<int>& receive)
+  {
+    cRandom rng(seed);
+    cAvidaContext ctx(m_world, rng);
+    m_test_cpu->DrawInputs(ctx, m_test_info, inputs, receive);
+  }
+  
+  // Run a trial, leaving its results in the runner's test info; with a trace, also work out whether the run can stand
+  // in for other trials
+  cCPUTestInfo& Run(int seed, sTrialTrace* trace = NULL)
+  {
+    cRandom rng(seed);
+    cAvidaContext ctx(m_world, rng);
+    setupContext(ctx);
+    
+    cRandom* prev_rng = m_world->SetThreadRandom(&rng);
+    m_test_cpu->TestGenome(ctx, m_test_info, m_genome);
+    m_world->SetThreadRandom(prev_rng);
+    if (!trace) return m_test_info;
+    
+    // Replay only the input draws; if execution took no random numbers of its own, both generators now agree
+    cRandom replay(seed);
+    cAvidaContext replay_ctx(m_world, replay);
+    m_test_cpu->DrawInputs(replay_ctx, m_test_info, trace->inputs, trace->receive);
+    trace->replayable = (rng.GetDouble() == replay.GetDouble() && rng.GetDouble() == replay.GetDouble());
+    
+    trace->inputs.Resize(m_test_cpu->GetNumInputsRead());
+    trace->receive.Resize(m_test_cpu->GetNumReceivesRead());
+    
+    return m_test_info;
+  }
+};
+
+
+// cTrialBatch - tParallelRange functor running a slice of the pending trials on a runner of its own
+class cPhenPlastGenotype::cTrialBatch
+{
+private:
+  cWorld* m_world;
+  cAvidaContext& m_ctx;
+  const cCPUTestInfo& m_test_info;
+  const Genome& m_genome;
+  const std::vector<int>& m_seeds;
+  const std::vector<int>& m_pending;
+  std::vector<cPlasticPhenotype*>& m_runs;
+  
+public:
+  cTrialBatch(cWorld* world, cAvidaContext& ctx, const cCPUTestInfo& test_info, const Genome& genome,
+              const std::vector<int>& seeds, const std::vector<int>& pending, std::vector<cPlasticPhenotype*>& runs)
+    : m_world(world), m_ctx(ctx), m_test_info(test_info), m_genome(genome), m_seeds(seeds), m_pending(pending)
+    , m_runs(runs) { ; }
+  
+  void operator()(int begin, int end)
+  {
+    const int num_trials = m_seeds.size();
+    cTrialRunner runner(m_world, m_ctx, m_test_info, m_genome, m_seeds[m_pending[begin]]);
+    for (int i = begin; i < end; i++) m_runs[i] = new cPlasticPhenotype(runner.Run(m_seeds[m_pending[i]]), num_trials);
+  }
+};
 
 cPhenPlastGenotype::cPhenPlastGenotype(const Genome& in_genome, int num_trials, cCPUTestInfo& test_info,  cWorld* world, cAvidaContext& ctx)
 : m_genome(in_genome), m_num_trials(num_trials), m_world(world)
@@ -44,24 +228,14 @@ cPhenPlastGenotype::~cPhenPlastGenotype()
 
 void cPhenPlastGenotype::Process(cCPUTestInfo& test_info, cWorld* world, cAvidaContext& ctx)
 {
-  cTestCPU* test_cpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
-
-  if (m_num_trials > 1) test_info.UseRandomInputs(true);
-  
-  for (int k = 0; k < m_num_trials; k++){
+  if (m_num_trials > 1) {
+    test_info.UseRandomInputs(true);
+    ProcessTrials(test_info, ctx);
+  } else if (m_num_trials == 1) {
+    cTestCPU* test_cpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
     test_cpu->TestGenome(ctx, test_info, m_genome);
-    //Is this a new phenotype?
-    UniquePhenotypes::iterator uit = m_unique.find(&test_info.GetTestPhenotype());
-    if (uit == m_unique.end()){  // Yes, make a new entry for it
-      cPlasticPhenotype* new_phen = new cPlasticPhenotype(test_info, m_num_trials);
-      m_plastic_phenotypes.Push(new_phen);
-      m_unique.insert( static_cast<cPhenotype*>(new_phen) );
-    } else{   // No, add an observation to existing entry, make sure it is equivalent
-      if (!static_cast<cPlasticPhenotype*>((*uit))->AddObservation(test_info)){
-        cerr << "Error with this plastic phenotype. Abort." << endl;
-        exit(3);
-      }
-    }
+    AddObservation(test_info);
+    delete test_cpu;
   }
   
   // Update statistics
@@ -96,14 +270,116 @@ void cPhenPlastGenotype::Process(cCPUTestInfo& test_info, cWorld* world, cAvidaC
     m_avg_fitness += freq * fit;
     m_phenotypic_entropy -= freq * log(freq) / log(2.0);
     
+    const cBitArray& task_bits = this_phen->GetLastTaskBits();
     for (int i = 0; i < num_tasks; i++)
-      m_task_probabilities[i] += (this_phen->GetLastTaskCount()[i] > 0) ? freq : 0;
+      m_task_probabilities[i] += (task_bits.Get(i)) ? freq : 0;
     
     m_viable_probability += (this_phen->IsViable() > 0) ? freq : 0;
     ++uit;
   }
+}
+
+
+// Trials are run in batches rather than one after another through TestGenome.  The first trial is always run here;
+// when it turns out to depend only on the inputs it read, any later trial drawing the same leading inputs is counted
+// as a repeat of it without being run.  The remaining trials are then run across threads, or -- on a single thread --
+// in order here, where every replayable run can stand in for the trials after it.  No trial draws from the world's
+// generator (see cTrialRunner), so the phenotypes found do not depend on the number of threads.  Most genomes draw
+// random numbers as they run (mutation checks are made even at a rate of zero), so when the first trial is not
+// replayable the rest are not traced at all.
+void cPhenPlastGenotype::ProcessTrials(cCPUTestInfo& test_info, cAvidaContext& ctx)
+{
+  std::vector<int> seeds(m_num_trials);
+  for (int k = 0; k < m_num_trials; k++) seeds[k] = ctx.GetRandom().GetInt(1, 0x7FFFFFFF);  // (a seed of 0 means seed from the clock)
   
-  if (test_cpu) delete test_cpu;
+  cTraceIndex traces;
+  tArray<int> inputs;
+  tArray<int> receive;
+  
+  cTrialRunner runner(m_world, ctx, test_info, m_genome, seeds[0]);
+  sTrialTrace first;
+  first.phenotype = AddObservation(runner.Run(seeds[0], &first));
+  if (first.replayable) traces.Add(first.inputs, first.receive, first.phenotype);
+  
+  int num_threads = Apto::Platform::AvailableCPUs();
+  const int max_threads = m_world->GetConfig().MAX_CONCURRENCY.Get();
+  if (max_threads > 0 && max_threads < num_threads) num_threads = max_threads;
+  
+  if (num_threads > 1 && !test_info.GetTraceExecution()) {
+    std::vector<int> pending;
+    for (int k = 1; k < m_num_trials; k++) {
+      if (first.replayable) {
+        runner.DrawInputs(seeds[k], inputs, receive);
+        if (first.Matches(inputs, receive)) {
+          first.phenotype->AddObservations(1);
+          continue;
+        }
+      }
+      pending.push_back(k);
+    }
+    
+    // Tallied afterwards in trial order, so phenotypes are listed (and keep the inputs of) the first trial showing them
+    std::vector<cPlasticPhenotype*> runs(pending.size(), static_cast<cPlasticPhenotype*>(NULL));
+    cTrialBatch batch(m_world, ctx, test_info, m_genome, seeds, pending, runs);
+    tParallelRange<cTrialBatch>::Run(batch, pending.size(), 2, num_threads);
+    for (size_t i = 0; i < runs.size(); i++) AddRun(runs[i]);
+  } else {
+    for (int k = 1; k < m_num_trials; k++) {
+      if (!traces.IsEmpty()) {
+        runner.DrawInputs(seeds[k], inputs, receive);
+        cPlasticPhenotype* repeat = traces.Find(inputs, receive);
+        if (repeat) {
+          repeat->AddObservations(1);
+          continue;
+        }
+      }
+      if (!first.replayable) {
+        AddObservation(runner.Run(seeds[k]));
+        continue;
+      }
+      sTrialTrace trace;
+      trace.phenotype = AddObservation(runner.Run(seeds[k], &trace));
+      if (trace.replayable) traces.Add(trace.inputs, trace.receive, trace.phenotype);
+    }
+  }
+}
+
+
+cPlasticPhenotype* cPhenPlastGenotype::AddObservation(cCPUTestInfo& test_info)
+{
+  //Is this a new phenotype?
+  UniquePhenotypes::iterator uit = m_unique.find(&test_info.GetTestPhenotype());
+  if (uit == m_unique.end()){  // Yes, make a new entry for it
+    cPlasticPhenotype* new_phen = new cPlasticPhenotype(test_info, m_num_trials);
+    m_plastic_phenotypes.Push(new_phen);
+    m_unique.insert( static_cast<cPhenotype*>(new_phen) );
+    return new_phen;
+  }
+  // No, add an observation to existing entry, make sure it is equivalent
+  cPlasticPhenotype* phen = static_cast<cPlasticPhenotype*>(*uit);
+  if (!phen->AddObservation(test_info)){
+    cerr << "Error with this plastic phenotype. Abort." << endl;
+    exit(3);
+  }
+  return phen;
+}
+
+
+void cPhenPlastGenotype::AddRun(cPlasticPhenotype* run)
+{
+  UniquePhenotypes::iterator uit = m_unique.find(run);
+  if (uit == m_unique.end()) {
+    m_plastic_phenotypes.Push(run);
+    m_unique.insert(static_cast<cPhenotype*>(run));
+  } else {
+    // As in AddObservation, the run must be equivalent to the phenotype it is counted towards
+    if (cPhenotype::Compare(run, *uit) != 0) {
+      cerr << "Error with this plastic phenotype. Abort." << endl;
+      exit(3);
+    }
+    static_cast<cPlasticPhenotype*>(*uit)->AddObservations(1);
+    delete run;
+  }
 }
 
 
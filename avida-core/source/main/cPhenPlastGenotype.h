@@ -39,6 +39,7 @@
 
 #include <set>
 #include <utility>
+#include <vector>
 
 class cAvidaContext;
 class cTestCPU;
@@ -73,7 +74,14 @@ class cPhenPlastGenotype
     
     
   
+  class cTrialRunner;
+  class cTrialBatch;
+  struct sTrialTrace;
+  
   void Process(cCPUTestInfo& test_info, cWorld* world, cAvidaContext& ctx);
+  void ProcessTrials(cCPUTestInfo& test_info, cAvidaContext& ctx);
+  cPlasticPhenotype* AddObservation(cCPUTestInfo& test_info);
+  void AddRun(cPlasticPhenotype* run);
   
 public:
   cPhenPlastGenotype(const Genome& in_genome, int num_trails, cCPUTestInfo& test_info,  cWorld* world, cAvidaContext& ctx);
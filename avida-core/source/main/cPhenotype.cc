@@ -42,6 +42,9 @@ cPhenotype::cPhenotype(cWorld* world, int parent_generation, int num_nops)
 , cur_task_count(m_world->GetEnvironment().GetNumTasks())
 , cur_para_tasks(m_world->GetEnvironment().GetNumTasks())
 , cur_host_tasks(m_world->GetEnvironment().GetNumTasks())
+, cur_task_bits(m_world->GetEnvironment().GetNumTasks())
+, cur_para_task_bits(m_world->GetEnvironment().GetNumTasks())
+, cur_host_task_bits(m_world->GetEnvironment().GetNumTasks())
 , cur_internal_task_count(m_world->GetEnvironment().GetNumTasks())
 , eff_task_count(m_world->GetEnvironment().GetNumTasks())
 , cur_task_quality(m_world->GetEnvironment().GetNumTasks())  
@@ -50,6 +53,7 @@ cPhenotype::cPhenotype(cWorld* world, int parent_generation, int num_nops)
 , cur_rbins_total(m_world->GetEnvironment().GetResourceLib().GetSize())
 , cur_rbins_avail(m_world->GetEnvironment().GetResourceLib().GetSize())
 , cur_reaction_count(m_world->GetEnvironment().GetReactionLib().GetSize())
+, cur_reaction_bits(m_world->GetEnvironment().GetReactionLib().GetSize())
 , first_reaction_cycles(m_world->GetEnvironment().GetReactionLib().GetSize())
 , first_reaction_execs(m_world->GetEnvironment().GetReactionLib().GetSize())
 , cur_stolen_reaction_count(m_world->GetEnvironment().GetReactionLib().GetSize())
@@ -69,6 +73,9 @@ cPhenotype::cPhenotype(cWorld* world, int parent_generation, int num_nops)
 , last_task_count(m_world->GetEnvironment().GetNumTasks())
 , last_para_tasks(m_world->GetEnvironment().GetNumTasks())
 , last_host_tasks(m_world->GetEnvironment().GetNumTasks())
+, last_task_bits(m_world->GetEnvironment().GetNumTasks())
+, last_para_task_bits(m_world->GetEnvironment().GetNumTasks())
+, last_host_task_bits(m_world->GetEnvironment().GetNumTasks())
 , last_internal_task_count(m_world->GetEnvironment().GetNumTasks())
 , last_task_quality(m_world->GetEnvironment().GetNumTasks())
 , last_task_value(m_world->GetEnvironment().GetNumTasks())
@@ -149,8 +156,11 @@ cPhenotype& cPhenotype::operator=(const cPhenotype& in_phen)
   cur_num_errors           = in_phen.cur_num_errors;                         
   cur_num_donates          = in_phen.cur_num_donates;                       
   cur_task_count           = in_phen.cur_task_count;  
+  cur_task_bits            = in_phen.cur_task_bits;
   cur_para_tasks           = in_phen.cur_para_tasks;
+  cur_para_task_bits       = in_phen.cur_para_task_bits;
   cur_host_tasks           = in_phen.cur_host_tasks;
+  cur_host_task_bits       = in_phen.cur_host_task_bits;
   eff_task_count           = in_phen.eff_task_count;
   cur_internal_task_count  = in_phen.cur_internal_task_count;
   cur_task_quality         = in_phen.cur_task_quality;    
@@ -160,6 +170,7 @@ cPhenotype& cPhenotype::operator=(const cPhenotype& in_phen)
   cur_rbins_avail          = in_phen.cur_rbins_avail;
   cur_collect_spec_counts  = in_phen.cur_collect_spec_counts;
   cur_reaction_count       = in_phen.cur_reaction_count;            
+  cur_reaction_bits        = in_phen.cur_reaction_bits;
   first_reaction_cycles    = in_phen.first_reaction_cycles;            
   first_reaction_execs     = first_reaction_execs;            
   cur_reaction_add_reward  = in_phen.cur_reaction_add_reward;     
@@ -199,8 +210,11 @@ cPhenotype& cPhenotype::operator=(const cPhenotype& in_phen)
   last_num_errors          = in_phen.last_num_errors; 
   last_num_donates         = in_phen.last_num_donates;
   last_task_count          = in_phen.last_task_count;
+  last_task_bits           = in_phen.last_task_bits;
   last_host_tasks          = in_phen.last_host_tasks;
+  last_host_task_bits      = in_phen.last_host_task_bits;
   last_para_tasks          = in_phen.last_para_tasks;
+  last_para_task_bits      = in_phen.last_para_task_bits;
   last_internal_task_count = in_phen.last_internal_task_count;
   last_task_quality        = in_phen.last_task_quality;
   last_internal_task_quality=in_phen.last_internal_task_quality;
@@ -209,6 +223,7 @@ cPhenotype& cPhenotype::operator=(const cPhenotype& in_phen)
   last_rbins_avail         = in_phen.last_rbins_avail;
   last_collect_spec_counts = in_phen.last_collect_spec_counts;
   last_reaction_count      = in_phen.last_reaction_count;
+  last_reaction_bits       = in_phen.last_reaction_bits;
   last_reaction_add_reward = in_phen.last_reaction_add_reward; 
   last_inst_count          = in_phen.last_inst_count;	  
   last_sense_count         = in_phen.last_sense_count;   
@@ -366,10 +381,13 @@ void cPhenotype::SetupOffspring(const cPhenotype& parent_phenotype, const Sequen
   cur_num_errors  = 0;
   cur_num_donates  = 0;
   cur_task_count.SetAll(0);
+  cur_task_bits.Clear();
   cur_internal_task_count.SetAll(0);
   eff_task_count.SetAll(0);
   cur_host_tasks.SetAll(0);
+  cur_host_task_bits.Clear();
   cur_para_tasks.SetAll(0);
+  cur_para_task_bits.Clear();
   cur_task_quality.SetAll(0);
   cur_task_value.SetAll(0);
   cur_internal_task_quality.SetAll(0);
@@ -389,6 +407,7 @@ void cPhenotype::SetupOffspring(const cPhenotype& parent_phenotype, const Sequen
   }
   cur_collect_spec_counts.SetAll(0);
   cur_reaction_count.SetAll(0);
+  cur_reaction_bits.Clear();
   first_reaction_cycles.SetAll(-1);
   first_reaction_execs.SetAll(-1);
   cur_stolen_reaction_count.SetAll(0);
@@ -424,8 +443,11 @@ void cPhenotype::SetupOffspring(const cPhenotype& parent_phenotype, const Sequen
   last_num_errors           = parent_phenotype.last_num_errors;
   last_num_donates          = parent_phenotype.last_num_donates;
   last_task_count           = parent_phenotype.last_task_count;
+  last_task_bits            = parent_phenotype.last_task_bits;
   last_host_tasks           = parent_phenotype.last_host_tasks;
+  last_host_task_bits       = parent_phenotype.last_host_task_bits;
   last_para_tasks           = parent_phenotype.last_para_tasks;
+  last_para_task_bits       = parent_phenotype.last_para_task_bits;
   last_internal_task_count  = parent_phenotype.last_internal_task_count;
   last_task_quality         = parent_phenotype.last_task_quality;
   last_task_value           = parent_phenotype.last_task_value;
@@ -434,6 +456,7 @@ void cPhenotype::SetupOffspring(const cPhenotype& parent_phenotype, const Sequen
   last_rbins_avail          = parent_phenotype.last_rbins_avail;
   last_collect_spec_counts  = parent_phenotype.last_collect_spec_counts;
   last_reaction_count       = parent_phenotype.last_reaction_count;
+  last_reaction_bits        = parent_phenotype.last_reaction_bits;
   last_reaction_add_reward  = parent_phenotype.last_reaction_add_reward;
   last_inst_count           = parent_phenotype.last_inst_count;
   last_sense_count          = parent_phenotype.last_sense_count;
@@ -587,8 +610,11 @@ void cPhenotype::SetupInject(const Sequence& _genome)
   cur_num_errors  = 0;
   cur_num_donates  = 0;
   cur_task_count.SetAll(0);
+  cur_task_bits.Clear();
   cur_para_tasks.SetAll(0);
+  cur_para_task_bits.Clear();
   cur_host_tasks.SetAll(0);
+  cur_host_task_bits.Clear();
   cur_internal_task_count.SetAll(0);
   eff_task_count.SetAll(0);
   cur_task_quality.SetAll(0);
@@ -602,6 +628,7 @@ void cPhenotype::SetupInject(const Sequence& _genome)
   else cur_rbins_avail.SetAll(0);
   cur_collect_spec_counts.SetAll(0);
   cur_reaction_count.SetAll(0);
+  cur_reaction_bits.Clear();
   first_reaction_cycles.SetAll(-1);
   first_reaction_execs.SetAll(-1);
   cur_stolen_reaction_count.SetAll(0);
@@ -630,8 +657,11 @@ void cPhenotype::SetupInject(const Sequence& _genome)
   last_num_errors = 0;
   last_num_donates = 0;
   last_task_count.SetAll(0);
+  last_task_bits.Clear();
   last_host_tasks.SetAll(0);
+  last_host_task_bits.Clear();
   last_para_tasks.SetAll(0);
+  last_para_task_bits.Clear();
   last_internal_task_count.SetAll(0);
   last_task_quality.SetAll(0);
   last_task_value.SetAll(0);
@@ -640,6 +670,7 @@ void cPhenotype::SetupInject(const Sequence& _genome)
   last_rbins_avail.SetAll(0);
   last_collect_spec_counts.SetAll(0);
   last_reaction_count.SetAll(0);
+  last_reaction_bits.Clear();
   last_reaction_add_reward.SetAll(0);
   last_inst_count.SetAll(0);
   last_sense_count.SetAll(0);
@@ -805,8 +836,11 @@ void cPhenotype::DivideReset(const Sequence& _genome)
   last_num_errors           = cur_num_errors;
   last_num_donates          = cur_num_donates;
   last_task_count           = cur_task_count;
+  last_task_bits            = cur_task_bits;
   last_host_tasks           = cur_host_tasks;
+  last_host_task_bits       = cur_host_task_bits;
   last_para_tasks           = cur_para_tasks;
+  last_para_task_bits       = cur_para_task_bits;
   last_internal_task_count  = cur_internal_task_count;
   last_task_quality         = cur_task_quality;
   last_task_value           = cur_task_value;
@@ -815,6 +849,7 @@ void cPhenotype::DivideReset(const Sequence& _genome)
   last_rbins_avail          = cur_rbins_avail;
   last_collect_spec_counts  = cur_collect_spec_counts;
   last_reaction_count       = cur_reaction_count;
+  last_reaction_bits        = cur_reaction_bits;
   last_reaction_add_reward  = cur_reaction_add_reward;
   last_inst_count           = cur_inst_count;
   last_sense_count          = cur_sense_count;
@@ -830,7 +865,9 @@ void cPhenotype::DivideReset(const Sequence& _genome)
   cur_num_errors  = 0;
   cur_num_donates  = 0;
   cur_task_count.SetAll(0);
+  cur_task_bits.Clear();
   cur_host_tasks.SetAll(0);
+  cur_host_task_bits.Clear();
   
   cur_mating_display_a = 0; //@CHC
   cur_mating_display_b = 0;
@@ -839,7 +876,9 @@ void cPhenotype::DivideReset(const Sequence& _genome)
   //      resonable assumptions
   if (m_world->GetConfig().DIVIDE_METHOD.Get() == DIVIDE_METHOD_SPLIT) {     
     last_para_tasks = cur_para_tasks;
+    last_para_task_bits = cur_para_task_bits;
     cur_para_tasks.SetAll(0);
+    cur_para_task_bits.Clear();
   }
   cur_internal_task_count.SetAll(0);
   eff_task_count.SetAll(0);
@@ -856,6 +895,7 @@ void cPhenotype::DivideReset(const Sequence& _genome)
   }
   cur_collect_spec_counts.SetAll(0);
   cur_reaction_count.SetAll(0);
+  cur_reaction_bits.Clear();
   first_reaction_cycles.SetAll(-1);
   first_reaction_execs.SetAll(-1);
   cur_stolen_reaction_count.SetAll(0);
@@ -1016,8 +1056,11 @@ void cPhenotype::TestDivideReset(const Sequence& _genome)
   last_num_errors           = cur_num_errors;
   last_num_donates          = cur_num_donates;
   last_task_count           = cur_task_count;
+  last_task_bits            = cur_task_bits;
   last_host_tasks           = cur_host_tasks;
+  last_host_task_bits       = cur_host_task_bits;
   last_para_tasks           = cur_para_tasks;
+  last_para_task_bits       = cur_para_task_bits;
   last_internal_task_count  = cur_internal_task_count;
   last_task_quality         = cur_task_quality;
   last_task_value			= cur_task_value;
@@ -1026,6 +1069,7 @@ void cPhenotype::TestDivideReset(const Sequence& _genome)
   last_rbins_avail          = cur_rbins_avail;
   last_collect_spec_counts  = cur_collect_spec_counts;
   last_reaction_count       = cur_reaction_count;
+  last_reaction_bits        = cur_reaction_bits;
   last_reaction_add_reward  = cur_reaction_add_reward;
   last_inst_count           = cur_inst_count;
   last_sense_count          = cur_sense_count;  
@@ -1037,12 +1081,16 @@ void cPhenotype::TestDivideReset(const Sequence& _genome)
   cur_num_errors  = 0;
   cur_num_donates  = 0;
   cur_task_count.SetAll(0);
+  cur_task_bits.Clear();
   cur_host_tasks.SetAll(0);
+  cur_host_task_bits.Clear();
   // @LZ: figure out when and where to reset cur_para_tasks, depending on the divide method, and
   //      resonable assumptions
   if (m_world->GetConfig().DIVIDE_METHOD.Get() == DIVIDE_METHOD_SPLIT) {
     last_para_tasks = cur_para_tasks;
+    last_para_task_bits = cur_para_task_bits;
     cur_para_tasks.SetAll(0);
+    cur_para_task_bits.Clear();
   }
   cur_internal_task_count.SetAll(0);
   eff_task_count.SetAll(0);
@@ -1057,6 +1105,7 @@ void cPhenotype::TestDivideReset(const Sequence& _genome)
   else cur_rbins_avail.SetAll(0);
   cur_collect_spec_counts.SetAll(0);
   cur_reaction_count.SetAll(0);
+  cur_reaction_bits.Clear();
   first_reaction_cycles.SetAll(-1);
   first_reaction_execs.SetAll(-1);
   cur_stolen_reaction_count.SetAll(0);
@@ -1208,14 +1257,18 @@ void cPhenotype::SetupClone(const cPhenotype& clone_phenotype)
   cur_num_errors  = 0;
   cur_num_donates  = 0;
   cur_task_count.SetAll(0);
+  cur_task_bits.Clear();
   cur_host_tasks.SetAll(0);
+  cur_host_task_bits.Clear();
   cur_para_tasks.SetAll(0);
+  cur_para_task_bits.Clear();
   cur_internal_task_count.SetAll(0);
   eff_task_count.SetAll(0);
   cur_rbins_total.SetAll(0);
   cur_rbins_avail.SetAll(0);
   cur_collect_spec_counts.SetAll(0);
   cur_reaction_count.SetAll(0);
+  cur_reaction_bits.Clear();
   first_reaction_cycles.SetAll(-1);
   first_reaction_execs.SetAll(-1);
   cur_stolen_reaction_count.SetAll(0);
@@ -1246,13 +1299,17 @@ void cPhenotype::SetupClone(const cPhenotype& clone_phenotype)
   last_num_errors          = clone_phenotype.last_num_errors;
   last_num_donates         = clone_phenotype.last_num_donates;
   last_task_count          = clone_phenotype.last_task_count;
+  last_task_bits           = clone_phenotype.last_task_bits;
   last_host_tasks          = clone_phenotype.last_host_tasks;
+  last_host_task_bits      = clone_phenotype.last_host_task_bits;
   last_para_tasks          = clone_phenotype.last_para_tasks;
+  last_para_task_bits      = clone_phenotype.last_para_task_bits;
   last_internal_task_count = clone_phenotype.last_internal_task_count;
   last_rbins_total         = clone_phenotype.last_rbins_total;
   last_rbins_avail         = clone_phenotype.last_rbins_avail;
   last_collect_spec_counts = clone_phenotype.last_collect_spec_counts;
   last_reaction_count      = clone_phenotype.last_reaction_count;
+  last_reaction_bits       = clone_phenotype.last_reaction_bits;
   last_reaction_add_reward = clone_phenotype.last_reaction_add_reward;
   last_inst_count          = clone_phenotype.last_inst_count;
   last_sense_count         = clone_phenotype.last_sense_count;  
@@ -1420,14 +1477,17 @@ bool cPhenotype::TestOutput(cAvidaContext& ctx, cTaskContext& taskctx,
 
     if (result.TaskDone(i) == true) {
       cur_task_count[i]++;
+      cur_task_bits.Set(i, true);
       eff_task_count[i]++;
       
       // Update parasite/host task tracking appropriately
       if (is_parasite) {
         cur_para_tasks[i]++;
+        cur_para_task_bits.Set(i, true);
       }
       else {
         cur_host_tasks[i]++;
+        cur_host_task_bits.Set(i, true);
       }
       
       if (context_phenotype != 0) {
@@ -1471,6 +1531,7 @@ bool cPhenotype::TestOutput(cAvidaContext& ctx, cTaskContext& taskctx,
       m_world->GetStats().AddNewReactionCount(i);
     }
     if (result.ReactionTriggered(i) == true) {
+      cur_reaction_bits.Set(i, true);
       if (context_phenotype != 0) {
         context_phenotype->GetReactionCounts()[i]++;
       }
@@ -1996,8 +2057,11 @@ void cPhenotype::NewTrial()
   last_num_errors           = cur_num_errors;
   last_num_donates          = cur_num_donates;
   last_task_count           = cur_task_count;
+  last_task_bits            = cur_task_bits;
   last_host_tasks           = cur_host_tasks;
+  last_host_task_bits       = cur_host_task_bits;
   last_para_tasks           = cur_para_tasks;
+  last_para_task_bits       = cur_para_task_bits;
   last_internal_task_count  = cur_internal_task_count;
   last_task_quality         = cur_task_quality;
   last_internal_task_quality= cur_internal_task_quality;
@@ -2006,6 +2070,7 @@ void cPhenotype::NewTrial()
   last_rbins_avail          = cur_rbins_avail;
   last_collect_spec_counts  = cur_collect_spec_counts;
   last_reaction_count       = cur_reaction_count;
+  last_reaction_bits        = cur_reaction_bits;
   last_reaction_add_reward  = cur_reaction_add_reward;
   last_inst_count           = cur_inst_count;
   last_sense_count          = cur_sense_count;
@@ -2017,8 +2082,11 @@ void cPhenotype::NewTrial()
   cur_num_errors  = 0;
   cur_num_donates  = 0;
   cur_task_count.SetAll(0);
+  cur_task_bits.Clear();
   cur_host_tasks.SetAll(0);
+  cur_host_task_bits.Clear();
   cur_para_tasks.SetAll(0);
+  cur_para_task_bits.Clear();
   cur_internal_task_count.SetAll(0);
   eff_task_count.SetAll(0);
   cur_task_quality.SetAll(0);
@@ -2028,6 +2096,7 @@ void cPhenotype::NewTrial()
   cur_rbins_avail.SetAll(0);
   cur_collect_spec_counts.SetAll(0);
   cur_reaction_count.SetAll(0);
+  cur_reaction_bits.Clear();
   first_reaction_cycles.SetAll(-1);
   first_reaction_execs.SetAll(-1);
   cur_stolen_reaction_count.SetAll(0);
@@ -2187,8 +2256,8 @@ int cPhenotype::Compare(const cPhenotype* lhs, const cPhenotype* rhs) {
   else if ( lhs->GetGestationTime() > rhs->GetGestationTime() ) return 1;
   
   // If gestation times are also equal, compare each task
-  tArray<int> lhsTasks = lhs->GetLastTaskCount();
-  tArray<int> rhsTasks = rhs->GetLastTaskCount();
+  const tArray<int>& lhsTasks = lhs->GetLastTaskCount();
+  const tArray<int>& rhsTasks = rhs->GetLastTaskCount();
   for (int k = 0; k < lhsTasks.GetSize(); k++) {
     if (lhsTasks[k] < rhsTasks[k]) return -1;
     else if (lhsTasks[k] > rhsTasks[k]) return 1;
@@ -2257,9 +2326,25 @@ void cPhenotype::SetLastParasiteTaskCount(tArray<int> oldParaPhenotype)
   for(int i=0;i<oldParaPhenotype.GetSize();i++)
   {
     last_para_tasks[i] = oldParaPhenotype[i];
+    last_para_task_bits.Set(i, oldParaPhenotype[i] > 0);
   }
 }
 
+void cPhenotype::SetLastTaskCount(tArray<int> tasks)
+{
+  assert(initialized == true);
+  last_task_count = tasks;
+  for (int i = 0; i < tasks.GetSize(); i++) last_task_bits.Set(i, tasks[i] > 0);
+}
+
+void cPhenotype::UpdateParasiteTasks()
+{
+  last_para_tasks = cur_para_tasks;
+  last_para_task_bits = cur_para_task_bits;
+  cur_para_tasks.SetAll(0);
+  cur_para_task_bits.Clear();
+}
+
 /* Return the cumulative reaction count if we aren't resetting on divide. */
 tArray<int> cPhenotype::GetCumulativeReactionCount()
 { 
@@ -36,6 +36,9 @@
 #ifndef tArray_h
 #include "tArray.h"
 #endif
+#ifndef cBitArray_h
+#include "cBitArray.h"
+#endif
 #ifndef cCodeLabel_h
 #include "cCodeLabel.h"
 #endif
@@ -125,6 +128,9 @@ private:
   tArray<int> cur_task_count;                 // Total times each task was performed
   tArray<int> cur_para_tasks;                 // Total times each task was performed by the parasite @LZ
   tArray<int> cur_host_tasks;                 // Total times each task was done by JUST the host @LZ
+  cBitArray cur_task_bits;                    // Tasks performed at least once (mirrors the counts above, for word-wide comparisons)
+  cBitArray cur_para_task_bits;
+  cBitArray cur_host_task_bits;
   tArray<int> cur_internal_task_count;        // Total times each task was performed using internal resources
   tArray<int> eff_task_count;                 // Total times each task was performed (resetable during the life of the organism)
   tArray<double> cur_task_quality;            // Average (total?) quality with which each task was performed
@@ -134,6 +140,7 @@ private:
   tArray<double> cur_rbins_avail;             // Amount of internal resources available
   tArray<int> cur_collect_spec_counts;        // How many times each nop-specification was used in a collect-type instruction
   tArray<int> cur_reaction_count;             // Total times each reaction was triggered.  
+  cBitArray cur_reaction_bits;                // Reactions triggered at least once
   tArray<int> first_reaction_cycles;          // CPU cycles of first time reaction was triggered.  
   tArray<int> first_reaction_execs;            // Execution count at first time reaction was triggered (will be > cycles in parallel exec multithreaded orgs).  
   tArray<int> cur_stolen_reaction_count;      // Total counts of reactions stolen by predators. 
@@ -173,6 +180,9 @@ private:
   tArray<int> last_task_count;
   tArray<int> last_para_tasks;
   tArray<int> last_host_tasks;                // Last task counts from hosts only, before last divide @LZ
+  cBitArray last_task_bits;
+  cBitArray last_para_task_bits;
+  cBitArray last_host_task_bits;
   tArray<int> last_internal_task_count;
   tArray<double> last_task_quality;
   tArray<double> last_task_value;
@@ -181,6 +191,7 @@ private:
   tArray<double> last_rbins_avail;
   tArray<int> last_collect_spec_counts;
   tArray<int> last_reaction_count;
+  cBitArray last_reaction_bits;
   tArray<double> last_reaction_add_reward; 
   tArray<int> last_inst_count;	  // Instruction exection counter
   tArray<int> last_sense_count;   // Total times resource combinations have been sensed; @JEB 
@@ -410,6 +421,9 @@ public:
   const tArray<int>& GetCurTaskCount() const { assert(initialized == true); return cur_task_count; }
   const tArray<int>& GetCurHostTaskCount() const { assert(initialized == true); return cur_host_tasks; }
   const tArray<int>& GetCurParasiteTaskCount() const { assert(initialized == true); return cur_para_tasks; }
+  const cBitArray& GetCurTaskBits() const { assert(initialized == true); return cur_task_bits; }
+  const cBitArray& GetCurHostTaskBits() const { assert(initialized == true); return cur_host_task_bits; }
+  const cBitArray& GetCurParasiteTaskBits() const { assert(initialized == true); return cur_para_task_bits; }
   const tArray<int>& GetCurInternalTaskCount() const { assert(initialized == true); return cur_internal_task_count; }
   void ClearEffTaskCount() { assert(initialized == true); eff_task_count.SetAll(0); }
   const tArray<double> & GetCurTaskQuality() const { assert(initialized == true); return cur_task_quality; }
@@ -421,6 +435,7 @@ public:
   double GetCurRBinAvail(int index) const { assert(initialized == true); return cur_rbins_avail[index]; }
   
   const tArray<int>& GetCurReactionCount() const { assert(initialized == true); return cur_reaction_count;}
+  const cBitArray& GetCurReactionBits() const { assert(initialized == true); return cur_reaction_bits; }
   const tArray<int>& GetFirstReactionCycles() const { assert(initialized == true); return first_reaction_cycles;}
   void SetFirstReactionCycle(int idx) { if (first_reaction_cycles[idx] < 0) first_reaction_cycles[idx] = time_used; }
   const tArray<int>& GetFirstReactionExecs() const { assert(initialized == true); return first_reaction_execs;}
@@ -456,9 +471,12 @@ public:
   int GetLastNumErrors() const { assert(initialized == true); return last_num_errors; }
   int GetLastNumDonates() const { assert(initialized == true); return last_num_donates; }
   const tArray<int>& GetLastTaskCount() const { assert(initialized == true); return last_task_count; }
-  void SetLastTaskCount(tArray<int> tasks) { assert(initialized == true); last_task_count = tasks; }
+  void SetLastTaskCount(tArray<int> tasks);
   const tArray<int>& GetLastHostTaskCount() const { assert(initialized == true); return last_host_tasks; }
   const tArray<int>& GetLastParasiteTaskCount() const { assert(initialized == true); return last_para_tasks; }
+  const cBitArray& GetLastTaskBits() const { assert(initialized == true); return last_task_bits; }
+  const cBitArray& GetLastHostTaskBits() const { assert(initialized == true); return last_host_task_bits; }
+  const cBitArray& GetLastParasiteTaskBits() const { assert(initialized == true); return last_para_task_bits; }
   void  SetLastParasiteTaskCount(tArray<int>  oldParaPhenotype);
   const tArray<int>& GetLastInternalTaskCount() const { assert(initialized == true); return last_internal_task_count; }
   const tArray<double>& GetLastTaskQuality() const { assert(initialized == true); return last_task_quality; }
@@ -467,6 +485,7 @@ public:
   const tArray<double>& GetLastRBinsTotal() const { assert(initialized == true); return last_rbins_total; }
   const tArray<double>& GetLastRBinsAvail() const { assert(initialized == true); return last_rbins_avail; }
   const tArray<int>& GetLastReactionCount() const { assert(initialized == true); return last_reaction_count; }
+  const cBitArray& GetLastReactionBits() const { assert(initialized == true); return last_reaction_bits; }
   const tArray<double>& GetLastReactionAddReward() const { assert(initialized == true); return last_reaction_add_reward; }
   const tArray<int>& GetLastInstCount() const { assert(initialized == true); return last_inst_count; }
   const tArray<int>& GetLastSenseCount() const { assert(initialized == true); return last_sense_count; }
@@ -596,7 +615,7 @@ public:
   int GetNumEnergyReceptions() { return num_energy_receptions; }
   int GetNumEnergyApplications() { return num_energy_applications; }
   
-  void SetReactionCount(int index, int val) { cur_reaction_count[index] = val; }
+  void SetReactionCount(int index, int val) { cur_reaction_count[index] = val; cur_reaction_bits.Set(index, val > 0); }
   void SetStolenReactionCount(int index, int val) { cur_stolen_reaction_count[index] = val; }
 
   void SetCurRBinsAvail(const tArray<double>& in_avail) { cur_rbins_avail = in_avail; }
@@ -694,7 +713,7 @@ public:
 
   // @LZ - Parasite Etc. Helpers
   void DivideFailed();
-  void UpdateParasiteTasks() { last_para_tasks = cur_para_tasks; cur_para_tasks.SetAll(0); return; }
+  void UpdateParasiteTasks();
   
 
   void RefreshEnergy();
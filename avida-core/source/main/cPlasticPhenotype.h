@@ -62,6 +62,7 @@ class cPlasticPhenotype : public cPhenotype{
     
     //Modifiers
     bool AddObservation(  cCPUTestInfo& test_info );
+    void AddObservations(int count) { m_num_observations += count; }  // Repeats of an observation already made
     
     //Accessors
     int GetNumObservations()      const { return m_num_observations; }
@@ -26,7 +26,11 @@
 
 #include "AvidaTools.h"
 
+#include "cAnalyze.h"
+#include "cAnalyzeJob.h"
+#include "cAnalyzeJobQueue.h"
 #include "cAvidaContext.h"
+#include "cBinnedProbSchedule.h"
 #include "cBioGroup.h"
 #include "cBioGroupManager.h"
 #include "cClassificationManager.h"
@@ -66,6 +70,7 @@
 #include "tKVPair.h"
 #include "tHashMap.h"
 #include "tManagedPointerArray.h"
+#include "tParallelRange.h"
 
 #include "cHardwareCPU.h"
 
@@ -98,6 +103,7 @@ cPopulation::cPopulation(cWorld* world)
 , num_pred_organisms(0)
 , pop_enforce(0)
 , m_has_predatory_res(false)
+, m_has_deme_res(false)
 , sync_events(false)
 , m_hgt_resid(-1)
 {
@@ -254,6 +260,7 @@ cPopulation::cPopulation(cWorld* world)
   }
   
   BuildTimeSlicer();
+  BuildDemeSchedules();
   
   // Setup the resources...
   const cResourceLib & resource_lib = environment.GetResourceLib();
@@ -268,6 +275,8 @@ cPopulation::cPopulation(cWorld* world)
       num_deme_res++;
   }
   
+  m_has_deme_res = (num_deme_res > 0);
+  
   cResourceCount tmp_res_count(resource_lib.GetSize() - num_deme_res);
   resource_count = tmp_res_count;
   resource_count.ResizeSpatialGrids(world_x, world_y);
@@ -363,7 +372,10 @@ bool cPopulation::InitiatePop(cUserFeedback* feedback)
 cPopulation::~cPopulation()
 {
   for (int i = 0; i < cell_array.GetSize(); i++) KillOrganism(cell_array[i], m_world->GetDefaultContext()); 
+  for (int i = 0; i < m_pending_births.GetSize(); i++) delete m_pending_births[i].offspring;
   delete schedule;
+  for (int i = 0; i < m_deme_schedules.GetSize(); i++) delete m_deme_schedules[i];
+  for (int i = 0; i < m_deme_rngs.GetSize(); i++) delete m_deme_rngs[i];
 }
 
 
@@ -371,14 +383,28 @@ inline void cPopulation::AdjustSchedule(const cPopulationCell& cell, const cMeri
 {
   const int deme_id = cell.GetDemeID();
   const cDeme& deme = deme_array[deme_id];
-  schedule->Adjust(cell.GetID(), deme.HasDemeMerit() ? (merit * deme.GetDemeMerit()) : merit, cell.GetDemeID());
+  const cMerit adj_merit = deme.HasDemeMerit() ? (merit * deme.GetDemeMerit()) : merit;
+  schedule->Adjust(cell.GetID(), adj_merit, cell.GetDemeID());
+  schedule->RecordMerit(cell.GetID(), adj_merit);
+  
+  if (m_deme_schedules.GetSize()) {
+    const int pos = deme.GetRelativeCellID(cell.GetID());
+    m_deme_schedules[deme_id]->Adjust(pos, adj_merit);
+    m_deme_schedules[deme_id]->RecordMerit(pos, adj_merit);
+  }
+}
+
+
+double cPopulation::GetTotalScheduledMerit() const
+{
+  return schedule->GetTotalMerit();
 }
 
 
 
 // Activate the child, given information from the parent.
 // Return true if parent lives through this process.
-bool cPopulation::ActivateOffspring(cAvidaContext& ctx, const Genome& offspring_genome, cOrganism* parent_organism)
+bool cPopulation::ActivateOffspring(cAvidaContext& ctx, Genome& offspring_genome, cOrganism* parent_organism)
 {
   if (m_world->GetConfig().FASTFORWARD_NUM_ORGS.Get() > 0 && GetNumOrganisms() >= m_world->GetConfig().FASTFORWARD_NUM_ORGS.Get())
   {
@@ -610,8 +636,17 @@ bool cPopulation::ActivateOffspring(cAvidaContext& ctx, const Genome& offspring_
   parent_organism->HandleGestation();
   
   // Place all of the offspring...
+  const bool defer_births = CanDeferBirths();
   for (int i = 0; i < offspring_array.GetSize(); i++) {
-    if (target_cells[i] != -1) {
+    if (defer_births && target_cells[i] != -1 && target_cells[i] != parent_id) {
+      // Offspring that do not replace their parent wait for the end of the update.  The birth is recorded now, as the
+      // offspring has already been classified, even if it later loses its cell to an earlier birth.
+      m_world->GetStats().RecordBirth(offspring_array[i]->GetPhenotype().ParentTrue());
+      sPendingBirth pending;
+      pending.offspring = offspring_array[i];
+      pending.target_cell = target_cells[i];
+      m_pending_births.Push(pending);
+    } else if (target_cells[i] != -1) {
       //@JEB - we may want to pass along some state information from parent to offspring
       if ( (m_world->GetConfig().EPIGENETIC_METHOD.Get() == EPIGENETIC_METHOD_OFFSPRING)
           || (m_world->GetConfig().EPIGENETIC_METHOD.Get() == EPIGENETIC_METHOD_BOTH) ) {
@@ -633,6 +668,45 @@ bool cPopulation::ActivateOffspring(cAvidaContext& ctx, const Genome& offspring_
   return parent_alive;
 }
 
+// Deferral is limited to births whose placement needs nothing more from the parent.  It is also limited to worlds of a
+// single deme, since a deme replicated during the update would otherwise receive offspring aimed at its predecessor.
+bool cPopulation::CanDeferBirths()
+{
+  if (!m_world->GetConfig().DEFERRED_BIRTHS.Get() || deme_array.GetSize() > 1) return false;
+  const int epigenetic = m_world->GetConfig().EPIGENETIC_METHOD.Get();
+  return (!m_world->GetConfig().USE_AVATARS.Get() && !m_world->GetConfig().USE_FORM_GROUPS.Get() &&
+          epigenetic != EPIGENETIC_METHOD_OFFSPRING && epigenetic != EPIGENETIC_METHOD_BOTH);
+}
+
+// Place the offspring held back during the update.  Each target cell is resolved once for the whole batch: the first
+// birth queued for a cell claims it and any later births aimed at the same cell are discarded.  Survivors are then
+// placed in the order they were born, so the outcome does not depend upon how the batch is processed.
+void cPopulation::CommitPendingBirths(cAvidaContext& ctx)
+{
+  const int num_pending = m_pending_births.GetSize();
+  if (num_pending == 0) return;
+  
+  if (m_cell_claimed.GetSize() != cell_array.GetSize()) m_cell_claimed.Resize(cell_array.GetSize(), false);
+  
+  for (int i = 0; i < num_pending; i++) {
+    sPendingBirth& pending = m_pending_births[i];
+    if (m_cell_claimed[pending.target_cell]) {
+      delete pending.offspring;
+      pending.offspring = NULL;
+    } else {
+      m_cell_claimed[pending.target_cell] = true;
+    }
+  }
+  
+  for (int i = 0; i < num_pending; i++) {
+    sPendingBirth& pending = m_pending_births[i];
+    if (pending.offspring == NULL) continue;
+    m_cell_claimed[pending.target_cell] = false;
+    ActivateOrganism(ctx, pending.offspring, GetCell(pending.target_cell), true, false, false);
+  }
+  m_pending_births.Resize(0);
+}
+
 void cPopulation::UpdateQs(cOrganism* org, bool reproduced)
 {
   // yank the org out of any current trace queues, as appropriate (i.e. if dead (==!reproduced) or if reproduced and splitting on divide)
@@ -681,9 +755,12 @@ bool cPopulation::TestForParasiteInteraction(cOrganism* infected_host, cOrganism
   
   cPhenotype& parent_phenotype = infected_host->GetPhenotype();
   
-  tArray<int> host_task_counts = target_host->GetPhenotype().GetLastHostTaskCount();
-  tArray<int> parasite_task_counts = parent_phenotype.GetLastParasiteTaskCount();
+  // Task-performed bitsets, so each mechanism below is a few word-wide counts
+  const cBitArray& host_tasks = target_host->GetPhenotype().GetLastHostTaskBits();
+  const cBitArray& parasite_tasks = parent_phenotype.GetLastParasiteTaskBits();
   
+  //handle skipping of first task
+  const int start = (m_world->GetConfig().INJECT_SKIP_FIRST_TASK.Get()) ? 1 : 0;
   
   if (infection_mechanism == 0) {
     interaction_fails = false;
@@ -691,105 +768,41 @@ bool cPopulation::TestForParasiteInteraction(cOrganism* infected_host, cOrganism
   
   // 1: Parasite must match at least 1 task the host does (Overlap)
   if (infection_mechanism == 1) {
-    //handle skipping of first task
-    int start = 0;
-    if (m_world->GetConfig().INJECT_SKIP_FIRST_TASK.Get()) {
-      start += 1;
-    }
-    
-    //find if there is a matching task
-    for (int i = start; i < host_task_counts.GetSize(); i++) {
-      if (host_task_counts[i] > 0 && parasite_task_counts[i] > 0) {
-        //inject should succeed if there is a matching task
-        interaction_fails = false;
-      }
-    }
+    //inject should succeed if there is a matching task
+    if (host_tasks.CountAND(parasite_tasks, start) > 0) interaction_fails = false;
   }
   
   // 2: Parasite must perform at least one task the host does not (Inverse Overlap)
   if (infection_mechanism == 2) {
-    //handle skipping of first task
-    int start = 0;
-    if (m_world->GetConfig().INJECT_SKIP_FIRST_TASK.Get()) {
-      start += 1;
-    }
-    
-    //find if there is a parasite task that the host isn't doing
-    for (int i = start; i < host_task_counts.GetSize(); i++) {
-      if (host_task_counts[i] == 0 && parasite_task_counts[i] > 0) {
-        //inject should succeed if there is a matching task
-        interaction_fails = false;
-      }
-    }
+    //inject should succeed if there is a parasite task that the host isn't doing
+    if (parasite_tasks.CountANDNOT(host_tasks, start) > 0) interaction_fails = false;
   }
   
   // 3: Parasite tasks must match host tasks exactly. (Matching Alleles) 
   if (infection_mechanism == 3) {
-    //handle skipping of first task
-    int start = 0;
-    if (m_world->GetConfig().INJECT_SKIP_FIRST_TASK.Get()) {
-      start += 1;
-    }
-    
-    //This time if we trigger the if statments we DO fail. 
-    interaction_fails = false;
-    for (int i = start; i < host_task_counts.GetSize(); i++) {
-      if ((host_task_counts[i] == 0 && parasite_task_counts[i] > 0) || 
-          (host_task_counts[i] > 0 && parasite_task_counts[i] == 0)) {
-        //inject should fail if either the host or parasite is doing a task the other isn't.
-        interaction_fails = true;
-      }
-    }
+    //inject should fail if either the host or parasite is doing a task the other isn't.
+    interaction_fails = (host_tasks.CountXOR(parasite_tasks, start) > 0);
   }
   
   // 4: Parasite tasks must overcome hosts. (GFG) 
   if (infection_mechanism == 4) {
-    //handle skipping of first task
-    int start = 0;
-    if (m_world->GetConfig().INJECT_SKIP_FIRST_TASK.Get()) {
-      start += 1;
-    }
-    
-    //This time if we trigger the if statments we DO fail. 
-    interaction_fails = false;
-    bool parasite_overcomes = false;
-    for (int i = start; i < host_task_counts.GetSize(); i++) {
-      if (host_task_counts[i] > 0 && parasite_task_counts[i] == 0 ) {
-        //inject should fail if the host overcomes the parasite.
-        interaction_fails = true;
-      }
-      
-      //check if parasite overcomes at least one task
-      if (parasite_task_counts[i] > 0 && host_task_counts[i] == 0) {
-        parasite_overcomes = true;
-      }
-    }
+    //inject should fail if the host overcomes the parasite.
+    interaction_fails = (host_tasks.CountANDNOT(parasite_tasks, start) > 0);
     
-    //if host doesn't overcome, infection may still fail if the parasite doesn't overcome the host
-    if (interaction_fails == false && parasite_overcomes == false) {
+    //if host doesn't overcome, infection may still fail if the parasite doesn't overcome at least one task
+    if (interaction_fails == false && parasite_tasks.CountANDNOT(host_tasks, start) == 0) {
       interaction_fails = true;
     }
   }
   
   // 5: Quantitative Matching Allele -- probability of infection based on phenotype overlap
   if (infection_mechanism == 5) {
-    //handle skipping of first task
-    int start = 0;
-    if(m_world->GetConfig().INJECT_SKIP_FIRST_TASK.Get()) {
-      start += 1;
-    }
-    
     //calculate how many tasks have the same binary phenotype (i.e. how much overlap)
-    int num_overlap = 0;
-    for (int i = start; i < host_task_counts.GetSize(); i++) {
-      if ((host_task_counts[i] > 0 && parasite_task_counts[i] > 0) ||
-          (host_task_counts[i] == 0 && parasite_task_counts[i] == 0)) {
-        num_overlap += 1;
-      }
-    }
+    const int num_considered = host_tasks.GetSize() - start;
+    const int num_overlap = num_considered - host_tasks.CountXOR(parasite_tasks, start);
     
     //turn number into proportion of available tasks that match
-    double prop_overlap = double(num_overlap) / (host_task_counts.GetSize() - start);
+    double prop_overlap = double(num_overlap) / num_considered;
     
     //use config exponent and calculate probability of infection
     double infection_exponent = m_world->GetConfig().INJECT_QMA_EXPONENT.Get();
@@ -931,7 +944,7 @@ bool cPopulation::ActivateParasite(cOrganism* host, cBioUnit* parent, const cStr
   return true;
 }
 
-bool cPopulation::ActivateOrganism(cAvidaContext& ctx, cOrganism* in_organism, cPopulationCell& target_cell, bool assign_group, bool is_inject)
+bool cPopulation::ActivateOrganism(cAvidaContext& ctx, cOrganism* in_organism, cPopulationCell& target_cell, bool assign_group, bool is_inject, bool record_birth)
 {
   assert(in_organism != NULL);
   assert(in_organism->GetGenome().GetSize() >= 1);
@@ -994,7 +1007,7 @@ bool cPopulation::ActivateOrganism(cAvidaContext& ctx, cOrganism* in_organism, c
   }
   
   // Statistics...
-  m_world->GetStats().RecordBirth(in_organism->GetPhenotype().ParentTrue());
+  if (record_birth) m_world->GetStats().RecordBirth(in_organism->GetPhenotype().ParentTrue());
   
   // @MRR Do coalescence clade setup for new organisms.
   CCladeSetupOrganism(in_organism );
@@ -3686,11 +3699,10 @@ void cPopulation::DivideDemes(cAvidaContext& ctx)
       KillOrganism(cell_array[ target_deme.GetCellID(i) ], ctx); 
     }
     
-    // Setup an array to collect the total number of tasks performed.
+    // Setup an array to collect the tasks performed.
     const int num_tasks = cell_array[source_deme.GetCellID(0)].GetOrganism()->
     GetPhenotype().GetLastTaskCount().GetSize();
-    tArray<int> tot_tasks(num_tasks);
-    tot_tasks.SetAll(0);
+    cBitArray tot_tasks(num_tasks);
     
     // Move over the odd numbered cells.
     for (int pos = 0; pos < deme_size; pos += 2) {
@@ -3699,10 +3711,7 @@ void cPopulation::DivideDemes(cAvidaContext& ctx)
       cOrganism * org1 = cell_array[cell1_id].GetOrganism();
       
       // Keep track of what tasks have been done.
-      const tArray<int> & cur_tasks = org1->GetPhenotype().GetLastTaskCount();
-      for (int i = 0; i < num_tasks; i++) {
-        tot_tasks[i] += cur_tasks[i];
-      }
+      tot_tasks |= org1->GetPhenotype().GetLastTaskBits();
       
       // Inject a copy of the odd organisms into the even cells.
       InjectClone(cell2_id, *org1, SRC_DEME_REPLICATE);
@@ -3713,9 +3722,8 @@ void cPopulation::DivideDemes(cAvidaContext& ctx)
     
     // Figure out the merit each organism should have.
     int merit = 100;
-    for (int i = 0; i < num_tasks; i++) {
-      if (tot_tasks[i] > 0) merit *= 2;
-    }
+    const int num_done = tot_tasks.CountBits();
+    for (int i = 0; i < num_done; i++) merit *= 2;
     
     // Setup the merit of both old and new individuals.
     for (int pos = 0; pos < deme_size; pos += 2) {
@@ -3936,17 +3944,24 @@ void cPopulation::AddDemePred(cString type, int times) {
 }
 
 void cPopulation::CheckImplicitDemeRepro(cDeme& deme, cAvidaContext& ctx) {
+  if (TestImplicitDemeRepro(deme)) ReplicateDeme(deme, ctx);
+}
+
+// Has this deme reached any of the configured implicit replication triggers?
+bool cPopulation::TestImplicitDemeRepro(cDeme& deme) {
   
-  if (GetNumDemes() <= 1) return;
+  if (GetNumDemes() <= 1) return false;
   
   if (m_world->GetConfig().DEMES_REPLICATE_CPU_CYCLES.Get()
-      && (deme.GetTimeUsed() >= m_world->GetConfig().DEMES_REPLICATE_CPU_CYCLES.Get())) ReplicateDeme(deme, ctx); 
-  else if (m_world->GetConfig().DEMES_REPLICATE_TIME.Get() 
-           && (deme.GetNormalizedTimeUsed() >= m_world->GetConfig().DEMES_REPLICATE_TIME.Get())) ReplicateDeme(deme, ctx); 
-  else if (m_world->GetConfig().DEMES_REPLICATE_BIRTHS.Get() 
-           && (deme.GetBirthCount() >= m_world->GetConfig().DEMES_REPLICATE_BIRTHS.Get())) ReplicateDeme(deme, ctx); 
-  else if (m_world->GetConfig().DEMES_REPLICATE_ORGS.Get() 
-           && (deme.GetOrgCount() >= m_world->GetConfig().DEMES_REPLICATE_ORGS.Get())) ReplicateDeme(deme, ctx);      
+      && (deme.GetTimeUsed() >= m_world->GetConfig().DEMES_REPLICATE_CPU_CYCLES.Get())) return true;
+  if (m_world->GetConfig().DEMES_REPLICATE_TIME.Get() 
+      && (deme.GetNormalizedTimeUsed() >= m_world->GetConfig().DEMES_REPLICATE_TIME.Get())) return true;
+  if (m_world->GetConfig().DEMES_REPLICATE_BIRTHS.Get() 
+      && (deme.GetBirthCount() >= m_world->GetConfig().DEMES_REPLICATE_BIRTHS.Get())) return true;
+  if (m_world->GetConfig().DEMES_REPLICATE_ORGS.Get() 
+      && (deme.GetOrgCount() >= m_world->GetConfig().DEMES_REPLICATE_ORGS.Get())) return true;
+  
+  return false;
 }
 
 // Print out all statistics about individual demes
@@ -4799,12 +4814,12 @@ cPopulationCell& cPopulation::PositionOffspring(cPopulationCell& parent_cell, cA
   tList<cPopulationCell> found_list;
   
   // First, check if there is an empty organism to work with (always preferred)
-  tList<cPopulationCell>& conn_list = parent_cell.ConnectionList();
+  cPopulationCell::connection_list_type& conn_list = parent_cell.ConnectionList();
   
   const bool prefer_empty = m_world->GetConfig().PREFER_EMPTY.Get();
   
   if (birth_method == POSITION_OFFSPRING_DISPERSAL && conn_list.GetSize() > 0) {
-    tList<cPopulationCell>* disp_list = &conn_list;
+    cPopulationCell::connection_list_type* disp_list = &conn_list;
     
     // hop through connection lists based on the dispersal rate
     int hops = m_world->GetRandom().GetRandPoisson(m_world->GetConfig().DISPERSAL_RATE.Get());
@@ -4818,7 +4833,7 @@ cPopulationCell& cPopulation::PositionOffspring(cPopulationCell& parent_cell, cA
     
     // if prefer empty is off, or there are no empty cells, use the whole connection list as possiblities
     if (found_list.GetSize() == 0) {
-      found_list = *disp_list;
+      for (int i = 0; i < disp_list->GetSize(); i++) found_list.PushRear(disp_list->GetPos(i));
       // if no hops were taken and ALLOW_PARENT is set, throw the parent cell into the hat for possible selection
       if (hops == 0 && parent_ok) found_list.Push(&parent_cell);
     }
@@ -4837,7 +4852,7 @@ cPopulationCell& cPopulation::PositionOffspring(cPopulationCell& parent_cell, cA
         PositionMerit(parent_cell, found_list, parent_ok);
         break;
       case POSITION_OFFSPRING_RANDOM:
-        found_list.Append(conn_list);
+        for (int i = 0; i < conn_list.GetSize(); i++) found_list.PushRear(conn_list.GetPos(i));
         if (parent_ok == true) found_list.Push(&parent_cell);
         break;
       case POSITION_OFFSPRING_NEIGHBORHOOD_ENERGY_USED:
@@ -4868,10 +4883,10 @@ void cPopulation::PositionAge(cPopulationCell & parent_cell,
   if (parent_ok == false) max_age = -1;
   
   // Now look at all of the neighbors.
-  tListIterator<cPopulationCell> conn_it( parent_cell.ConnectionList() );
+  cPopulationCell::connection_list_type& conn_list = parent_cell.ConnectionList();
   
-  cPopulationCell * test_cell;
-  while ( (test_cell = conn_it.Next()) != NULL) {
+  for (int i = 0; i < conn_list.GetSize(); i++) {
+    cPopulationCell* test_cell = conn_list.GetPos(i);
     const int cur_age = test_cell->GetOrganism()->GetPhenotype().GetAge();
     if (cur_age > max_age) {
       max_age = cur_age;
@@ -4896,10 +4911,10 @@ void cPopulation::PositionMerit(cPopulationCell & parent_cell,
   if (parent_ok == false) max_ratio = -1;
   
   // Now look at all of the neighbors.
-  tListIterator<cPopulationCell> conn_it( parent_cell.ConnectionList() );
+  cPopulationCell::connection_list_type& conn_list = parent_cell.ConnectionList();
   
-  cPopulationCell * test_cell;
-  while ( (test_cell = conn_it.Next()) != NULL) {
+  for (int i = 0; i < conn_list.GetSize(); i++) {
+    cPopulationCell* test_cell = conn_list.GetPos(i);
     const double cur_ratio = test_cell->GetOrganism()->CalcMeritRatio();
     if (cur_ratio > max_ratio) {
       max_ratio = cur_ratio;
@@ -4924,10 +4939,10 @@ void cPopulation::PositionEnergyUsed(cPopulationCell & parent_cell,
   if (parent_ok == false) max_energy_used = -1;
   
   // Now look at all of the neighbors.
-  tListIterator<cPopulationCell> conn_it( parent_cell.ConnectionList() );
+  cPopulationCell::connection_list_type& conn_list = parent_cell.ConnectionList();
   
-  cPopulationCell * test_cell;
-  while ( (test_cell = conn_it.Next()) != NULL) {
+  for (int i = 0; i < conn_list.GetSize(); i++) {
+    cPopulationCell* test_cell = conn_list.GetPos(i);
     const int cur_energy_used = test_cell->GetOrganism()->GetPhenotype().GetTimeUsed();
     if (cur_energy_used > max_energy_used) {
       max_energy_used = cur_energy_used;
@@ -5166,9 +5181,11 @@ void cPopulation::ProcessStep(cAvidaContext& ctx, double step_size, int cell_id)
   m_world->GetStats().IncExecuted();
   resource_count.Update(step_size);
   
-  // These must be done even if there is only one deme.
-  for(int i = 0; i < GetNumDemes(); i++) {
-    GetDeme(i).Update(step_size);
+  // These must be done even if there is only one deme, but only matter when there are deme resources to advance.
+  if (m_has_deme_res) {
+    for(int i = 0; i < GetNumDemes(); i++) {
+      GetDeme(i).Update(step_size);
+    }
   }
   
   cDeme & deme = GetDeme(GetCell(cell_id).GetDemeID());
@@ -5180,6 +5197,211 @@ void cPopulation::ProcessStep(cAvidaContext& ctx, double step_size, int cell_id)
 }
 
 
+// Runs the deme partitions in [begin, end) up to their next held step, as one job of the parallel phase
+class cPopulation::cPartitionJob : public cAnalyzeJob
+{
+private:
+  cPopulation* m_pop;
+  cAvidaContext& m_ctx;
+  int m_begin;
+  int m_end;
+  
+public:
+  cPartitionJob(cPopulation* pop, cAvidaContext& ctx, int begin, int end)
+    : m_pop(pop), m_ctx(ctx), m_begin(begin), m_end(end) { ; }
+  
+  void Run(cAvidaContext&) { m_pop->RunDemePartitions(m_ctx, m_begin, m_end); }
+};
+
+
+/*! Process one update's worth of CPU cycles with every deme run as an independent partition.
+ 
+ Each deme is allotted its share of the update up front and runs it with its own schedule and random number stream.
+ The update proceeds in rounds.  In the parallel phase of a round, the demes are handed out to the analyze job queue
+ and each one runs until its next step could reach beyond the deme -- the steps that speculative execution declines:
+ instructions flagged to stall (such as IO and divide) and deaths.  That step is held, and in the serial phase the
+ held steps are executed one deme at a time, in deme order.  Every deme thus sees the same sequence of events whatever
+ the number of worker threads, so runs are repeatable on any machine.
+ 
+ Hardware that cannot speculate, implicit reproduction and parallel thread slicing leave every step to the serial
+ phase; such runs interleave the demes one step at a time without using the job queue.
+ 
+ Implicit deme replication (DEMES_REPLICATE_*) that would have fired part way through the update is instead collected
+ and applied in deme order once every partition has run.
+ */
+void cPopulation::ProcessDemePartitions(cAvidaContext& ctx, int update_size)
+{
+  const int num_demes = deme_array.GetSize();
+  
+  // Apportion the update between the demes according to their scheduling weight
+  tArray<double> weight(num_demes, 0.0);
+  double total_weight = 0.0;
+  for (int i = 0; i < num_demes; i++) {
+    weight[i] = GetDemeScheduleWeight(i);
+    total_weight += weight[i];
+  }
+  
+  double cum_weight = 0.0;
+  int assigned = 0;
+  for (int i = 0; i < num_demes; i++) {
+    cum_weight += weight[i];
+    const int target = (total_weight > 0.0) ? (int)((double)update_size * cum_weight / total_weight + 0.5) : 0;
+    sDemePartition& part = m_deme_partitions[i];
+    part.cycles = target - assigned;
+    part.used = 0;
+    part.held_pos = -1;
+    part.executed = 0;
+    part.replicate = false;
+    assigned = target;
+    if (part.cycles <= 0) deme_array[i].Update(1.0);
+  }
+  
+  // Global resources are shared by every partition, so they advance once for the whole update.  Bringing them up to
+  // date here means that reading them during the parallel phase changes nothing.
+  resource_count.Update(1.0);
+  resource_count.GetResources(ctx);
+  
+  const bool speculative = CanSpeculateDemePartitions();
+  cAnalyzeJobQueue* jobqueue = (speculative) ? &m_world->GetAnalyze().GetJobQueue() : NULL;
+  const int num_jobs = (jobqueue) ? std::min(jobqueue->GetNumWorkers(), num_demes) : 0;
+  
+  bool active = true;
+  while (active) {
+    // Parallel phase
+    if (num_jobs > 1) {
+      for (int i = 0; i < num_jobs; i++) {
+        jobqueue->AddJob(new cPartitionJob(this, ctx, i * num_demes / num_jobs, (i + 1) * num_demes / num_jobs));
+      }
+      jobqueue->Execute();
+    } else if (speculative) {
+      RunDemePartitions(ctx, 0, num_demes);
+    }
+    
+    // Serial phase
+    active = false;
+    for (int i = 0; i < num_demes; i++) {
+      if (m_deme_partitions[i].used >= m_deme_partitions[i].cycles) continue;
+      cAvidaContext deme_ctx(ctx);
+      deme_ctx.SetRandom(m_deme_rngs[i]);
+      StepDemePartition(deme_ctx, i, false);
+      active = true;
+    }
+  }
+  
+  cStats& stats = m_world->GetStats();
+  for (int i = 0; i < num_demes; i++) stats.AddExecuted(m_deme_partitions[i].executed);
+  
+  // Replicate the demes that reached a trigger during the update.  The test is repeated since an earlier replication
+  // may have replaced a later deme.
+  for (int i = 0; i < num_demes; i++) {
+    if (m_deme_partitions[i].replicate) CheckImplicitDemeRepro(deme_array[i], ctx);
+  }
+}
+
+
+// Whether held steps can be found by speculating, which requires that no step divides implicitly and that an
+// organism's threads take their turns one at a time
+bool cPopulation::CanSpeculateDemePartitions()
+{
+  cAvidaConfig& cfg = m_world->GetConfig();
+  return (cfg.THREAD_SLICING_METHOD.Get() != 1 && cfg.IMPLICIT_REPRO_BONUS.Get() == 0 &&
+          cfg.IMPLICIT_REPRO_CPU_CYCLES.Get() == 0 && cfg.IMPLICIT_REPRO_TIME.Get() == 0 &&
+          cfg.IMPLICIT_REPRO_END.Get() == 0 && cfg.IMPLICIT_REPRO_ENERGY.Get() == 0.0);
+}
+
+
+// Parallel phase: run each deme in [begin, end) until it is out of cycles or holds a step for the serial phase.  Code
+// that draws from the world's generator directly draws from the deme's instead, so that threads share no generator.
+void cPopulation::RunDemePartitions(cAvidaContext& ctx, int begin, int end)
+{
+  for (int i = begin; i < end; i++) {
+    sDemePartition& part = m_deme_partitions[i];
+    cAvidaContext deme_ctx(ctx);
+    deme_ctx.SetRandom(m_deme_rngs[i]);
+    cRandom* prev_rng = m_world->SetThreadRandom(m_deme_rngs[i]);
+    while (part.used < part.cycles && StepDemePartition(deme_ctx, i, true)) ;
+    m_world->SetThreadRandom(prev_rng);
+  }
+}
+
+
+// Give a deme's partition its next step.  A speculative step that the organism's hardware declines is held for the
+// serial phase instead, and false is returned.  The deme's resources advance a full update over the partition.
+bool cPopulation::StepDemePartition(cAvidaContext& ctx, int deme_id, bool speculative)
+{
+  sDemePartition& part = m_deme_partitions[deme_id];
+  cDeme& deme = deme_array[deme_id];
+  const double step_size = 1.0 / (double)part.cycles;
+  
+  int pos = part.held_pos;
+  part.held_pos = -1;
+  if (pos < 0) {
+    pos = (deme.GetOrgCount() > 0) ? m_deme_schedules[deme_id]->GetNextID() : -1;
+    if (pos < 0) {
+      // Nothing left alive to run, let the remainder of the update pass
+      deme.Update((double)(part.cycles - part.used) * step_size);
+      part.used = part.cycles;
+      return true;
+    }
+  }
+  
+  // A held step is dropped if an earlier step in the serial phase has since emptied its cell
+  cPopulationCell& cell = cell_array[deme.GetCellID(pos)];
+  if (!cell.IsOccupied()) return true;
+  
+  cOrganism* cur_org = cell.GetOrganism();
+  cPhenotype& phenotype = cur_org->GetPhenotype();
+  if (speculative) {
+    // A declined step leaves the cycle count as it was.  An accepted one may still leave the organism due to die,
+    // which will be its next step.
+    const int cycles_used = phenotype.GetCPUCyclesUsed();
+    cell.GetHardware()->SingleProcess(ctx, true);
+    if (phenotype.GetCPUCyclesUsed() == cycles_used) {
+      part.held_pos = pos;
+      return false;
+    }
+  } else {
+    cell.GetHardware()->SingleProcess(ctx);
+  }
+  
+  double merit = phenotype.GetMerit().GetDouble();
+  if (phenotype.GetToDelete() == true) {
+    cur_org->GetHardware().DeleteMiniTrace(print_mini_trace_reacs);
+    delete cur_org;
+  }
+  
+  part.executed++;
+  part.used++;
+  deme.Update(step_size);
+  deme.IncTimeUsed(merit);
+  
+  if (TestImplicitDemeRepro(deme)) {
+    // The deme is about to be replaced, so it forfeits the rest of its cycles
+    deme.Update((double)(part.cycles - part.used) * step_size);
+    part.used = part.cycles;
+    part.replicate = true;
+  }
+  return true;
+}
+
+
+// Weight used to divide an update between deme partitions, mirroring how SLICING_METHOD divides it between organisms
+double cPopulation::GetDemeScheduleWeight(int deme_id)
+{
+  cDeme& deme = deme_array[deme_id];
+  switch (m_world->GetConfig().SLICING_METHOD.Get()) {
+    case SLICE_CONSTANT:
+    case SLICE_CONSTANT_BURST:
+    case SLICE_PROB_DEMESIZE_PROB_MERIT:
+      return (double)deme.GetOrgCount();
+    case SLICE_DEME_PROB_MERIT:
+      return (deme.GetOrgCount() > 0) ? 1.0 : 0.0;
+    default:
+      return m_deme_schedules[deme_id]->GetTotalMerit();
+  }
+}
+
+
 void cPopulation::ProcessStepSpeculative(cAvidaContext& ctx, double step_size, int cell_id)
 {
   assert(step_size > 0.0);
@@ -5213,7 +5435,7 @@ void cPopulation::ProcessStepSpeculative(cAvidaContext& ctx, double step_size, i
   
   // Deme specific
   if (GetNumDemes() > 1) {
-    for(int i = 0; i < GetNumDemes(); i++) GetDeme(i).Update(step_size);
+    if (m_has_deme_res) for(int i = 0; i < GetNumDemes(); i++) GetDeme(i).Update(step_size);
     
     cDeme& deme = GetDeme(GetCell(cell_id).GetDemeID());
     deme.IncTimeUsed(cur_org->GetPhenotype().GetMerit().GetDouble());
@@ -5604,12 +5826,18 @@ void cPopulation::UpdateResStats(cAvidaContext& ctx)
 
 void cPopulation::ProcessPreUpdate()
 {
-  resource_count.SetSpatialUpdate(m_world->GetStats().GetUpdate());
+  // Spatial resources only step on SPATIAL_RES_UPDATE_INTERVAL boundaries, with one step standing for the whole interval
+  const int update = m_world->GetStats().GetUpdate();
+  const int spatial_interval = m_world->GetConfig().SPATIAL_RES_UPDATE_INTERVAL.Get();
+  if (spatial_interval <= 1) resource_count.SetSpatialUpdate(update);
+  else if (update % spatial_interval == 0) resource_count.SetSpatialUpdate(update, spatial_interval);
   for (int i = 0; i < deme_array.GetSize(); i++) deme_array[i].ProcessPreUpdate();   
 }
 
 void cPopulation::ProcessPostUpdate(cAvidaContext& ctx)
 {
+  CommitPendingBirths(ctx);
+  
   ProcessUpdateCellActions(ctx);
   
   cStats& stats = m_world->GetStats();
@@ -5941,9 +6169,12 @@ struct sTmpGenotype
 {
 public:
   int id_num;
-  tDictionary<cString>* props;
+  tArray<cString> fields;   // Columns of this genotype's line, in #format order
   
   int num_cpus;
+  double merit;
+  double gest_time;
+  bool has_parent_merit;
   tArray<int> cells;
   tArray<int> offsets;
   tArray<int> lineage_labels;
@@ -5958,13 +6189,133 @@ public:
   cBioGroup* bg;
   
   
-  inline sTmpGenotype() : id_num(-1), props(NULL) { ; }
+  inline sTmpGenotype() : id_num(-1), num_cpus(0), merit(0.0), gest_time(0.0), has_parent_merit(false), bg(NULL) { ; }
   inline bool operator<(const sTmpGenotype& rhs) const { return id_num > rhs.id_num; }
   inline bool operator>(const sTmpGenotype& rhs) const { return id_num < rhs.id_num; }
   inline bool operator<=(const sTmpGenotype& rhs) const { return id_num >= rhs.id_num; }
   inline bool operator>=(const sTmpGenotype& rhs) const { return id_num <= rhs.id_num; }
 };
 
+// Parses the lines of a population save file straight into sTmpGenotype fields.  Lines are independent, so ranges
+// of them are handed to separate threads; nothing here copies a string that another line could be using.
+struct sTmpGenotypeParser
+{
+  const cInitFile& file;
+  tManagedPointerArray<sTmpGenotype>& genotypes;
+  bool load_groups;
+  bool load_birth_cells;
+  bool load_avatars;
+  bool load_rebirth;
+  bool use_avatars;
+  
+  int col_id, col_num_units, col_num_cpus, col_cells, col_gest_offset, col_lineage, col_merit, col_gest_time;
+  int col_birth_cell, col_av_bcell, col_avatar_cell, col_parent_is_teach, col_parent_ft, col_parent_merit;
+  int col_group_id, col_forager_type;
+  
+  sTmpGenotypeParser(const cInitFile& in_file, tManagedPointerArray<sTmpGenotype>& in_genotypes)
+    : file(in_file), genotypes(in_genotypes)
+    , load_groups(false), load_birth_cells(false), load_avatars(false), load_rebirth(false), use_avatars(false)
+  {
+    col_id = file.GetFormatColumn("id");
+    col_num_units = file.GetFormatColumn("num_units");
+    col_num_cpus = file.GetFormatColumn("num_cpus");
+    col_cells = file.GetFormatColumn("cells");
+    col_gest_offset = file.GetFormatColumn("gest_offset");
+    col_lineage = file.GetFormatColumn("lineage");
+    col_merit = file.GetFormatColumn("merit");
+    col_gest_time = file.GetFormatColumn("gest_time");
+    col_birth_cell = file.GetFormatColumn("birth_cell");
+    col_av_bcell = file.GetFormatColumn("av_bcell");
+    col_avatar_cell = file.GetFormatColumn("avatar_cell");
+    col_parent_is_teach = file.GetFormatColumn("parent_is_teach");
+    col_parent_ft = file.GetFormatColumn("parent_ft");
+    col_parent_merit = file.GetFormatColumn("parent_merit");
+    col_group_id = file.GetFormatColumn("group_id");
+    col_forager_type = file.GetFormatColumn("forager_type");
+  }
+  
+  static inline bool Has(const tArray<cString>& fields, int col) { return col >= 0 && col < fields.GetSize(); }
+  static inline const char* Field(const tArray<cString>& fields, int col) { return Has(fields, col) ? (const char*)fields[col] : ""; }
+  
+  // Comma separated lists parse the same way repeated cString::Pop(',') would: every comma ends an entry, and a
+  // non-empty tail is the last one.
+  template <typename T> static void ParseList(const tArray<cString>& fields, int col, tArray<T>& values)
+  {
+    const char* str = Field(fields, col);
+    while (*str) {
+      T value;
+      ParseValue(str, value);
+      values.Push(value);
+      const char* comma = strchr(str, ',');
+      if (comma == NULL) break;
+      str = comma + 1;
+    }
+  }
+  static inline void ParseValue(const char* str, int& value) { value = static_cast<int>(strtol(str, NULL, 0)); }
+  static inline void ParseValue(const char* str, bool& value) { value = (bool)static_cast<int>(strtol(str, NULL, 0)); }
+  static inline void ParseValue(const char* str, double& value) { value = strtod(str, NULL); }
+  
+  void operator()(int begin, int end)
+  {
+    for (int line_id = begin; line_id < end; line_id++) {
+      sTmpGenotype& tmp = genotypes[line_id];
+      tArray<cString>& fields = tmp.fields;
+      file.GetLineFields(line_id, fields);
+      
+      ParseValue(Field(fields, col_id), tmp.id_num);
+      
+      // Loads "num_units" preferrentially, but will fall back to "num_cpus" if present
+      assert(Has(fields, col_num_cpus) || Has(fields, col_num_units));
+      ParseValue(Field(fields, Has(fields, col_num_units) ? col_num_units : col_num_cpus), tmp.num_cpus);
+      
+      ParseValue(Field(fields, col_merit), tmp.merit);
+      ParseValue(Field(fields, col_gest_time), tmp.gest_time);
+      tmp.has_parent_merit = Has(fields, col_parent_merit);
+      
+      // Resident cell ids (structured populations)
+      ParseList(fields, col_cells, tmp.cells);
+      
+      // Gestation time offsets
+      if (!load_rebirth) {
+        ParseList(fields, col_gest_offset, tmp.offsets);
+        assert(tmp.offsets.GetSize() == 0 || tmp.offsets.GetSize() == tmp.num_cpus);
+      }
+      
+      // Lineage label (only set if given in file)
+      ParseList(fields, col_lineage, tmp.lineage_labels);
+      // @blw preserve compatability with older .spop files that don't have lineage labels
+      assert(tmp.lineage_labels.GetSize() == 0 || tmp.lineage_labels.GetSize() == tmp.num_cpus);
+      
+      // Other org specs (if given in file)
+      if (load_rebirth) {
+        ParseList(fields, col_birth_cell, tmp.birth_cells);
+        if (use_avatars) ParseList(fields, col_av_bcell, tmp.avatar_cells);
+        ParseList(fields, col_parent_is_teach, tmp.parent_teacher);
+        ParseList(fields, col_parent_ft, tmp.parent_ft);
+        ParseList(fields, col_parent_merit, tmp.parent_merit);
+      } else {
+        if (load_groups) {
+          ParseList(fields, col_group_id, tmp.group_ids);
+          ParseList(fields, col_forager_type, tmp.forager_types);
+        }
+        if (load_birth_cells) {
+          ParseList(fields, col_birth_cell, tmp.birth_cells);
+          if (use_avatars) ParseList(fields, col_av_bcell, tmp.avatar_cells);
+        } else if (load_avatars) {
+          ParseList(fields, col_avatar_cell, tmp.avatar_cells);
+        }
+      }
+      assert(tmp.birth_cells.GetSize() == 0 || tmp.birth_cells.GetSize() == tmp.num_cpus);
+      assert(tmp.avatar_cells.GetSize() == 0 || tmp.avatar_cells.GetSize() == tmp.num_cpus);
+      assert(tmp.parent_teacher.GetSize() == 0 || tmp.parent_teacher.GetSize() == tmp.num_cpus);
+      assert(tmp.parent_ft.GetSize() == 0 || tmp.parent_ft.GetSize() == tmp.num_cpus);
+      assert(tmp.parent_merit.GetSize() == 0 || tmp.parent_merit.GetSize() == tmp.num_cpus);
+      assert(tmp.group_ids.GetSize() == 0 || tmp.group_ids.GetSize() == tmp.num_cpus);
+      assert(tmp.forager_types.GetSize() == 0 || tmp.forager_types.GetSize() == tmp.num_cpus);
+    }
+  }
+};
+
 bool cPopulation::LoadPopulation(const cString& filename, cAvidaContext& ctx, int cellid_offset, int lineage_offset, bool load_groups, 
                                  bool load_birth_cells, bool load_avatars, bool load_rebirth) 
 {
@@ -5990,112 +6341,38 @@ bool cPopulation::LoadPopulation(const cString& filename, cAvidaContext& ctx, in
   
   // First, we read in all the genotypes and store them in an array
   tManagedPointerArray<sTmpGenotype> genotypes(input_file.GetNumLines());
-
+  
+  sTmpGenotypeParser parser(input_file, genotypes);
+  parser.load_groups = load_groups;
+  parser.load_birth_cells = load_birth_cells;
+  parser.load_avatars = load_avatars;
+  parser.load_rebirth = load_rebirth;
+  parser.use_avatars = m_world->GetConfig().USE_AVATARS.Get();
+  tParallelRange<sTmpGenotypeParser>::Run(parser, genotypes.GetSize(), 4096, m_world->GetConfig().MAX_CONCURRENCY.Get());
+  
+  // The population is structured if cell ids were saved (for all genotypes)
   bool structured = false;
-  for (int line_id = 0; line_id < input_file.GetNumLines(); line_id++) {
-    cString cur_line = input_file.GetLine(line_id);
-    
-    // Setup the genotype for this line...
-    sTmpGenotype& tmp = genotypes[line_id];
-    tmp.props = input_file.GetLineAsDict(line_id);
-    tmp.id_num = tmp.props->Get("id").AsInt();
-
-    // Loads "num_units" preferrentially, but will fall back to "num_cpus" if present
-    assert(tmp.props->HasEntry("num_cpus") || tmp.props->HasEntry("num_units"));
-    tmp.num_cpus = (tmp.props->HasEntry("num_units")) ? tmp.props->Get("num_units").AsInt() : tmp.props->Get("num_cpus").AsInt();
-    
-    // Process resident cell ids
-    cString cellstr(tmp.props->Get("cells"));
-    if (structured || cellstr.GetSize()) {
-      structured = true;
-      while (cellstr.GetSize()) tmp.cells.Push(cellstr.Pop(',').AsInt());
-      assert(tmp.cells.GetSize() == tmp.num_cpus);
-    }
-    
-    // Process gestation time offsets
-    if (!load_rebirth) {
-      cString offsetstr(tmp.props->Get("gest_offset"));
-      if (offsetstr.GetSize()) {
-        while (offsetstr.GetSize()) tmp.offsets.Push(offsetstr.Pop(',').AsInt());
-        assert(tmp.offsets.GetSize() == tmp.num_cpus);
-      }
-    }
-    // Lineage label (only set if given in file)
-    cString lineagestr(tmp.props->Get("lineage"));
-    while (lineagestr.GetSize()) tmp.lineage_labels.Push(lineagestr.Pop(',').AsInt());
-    // @blw preserve compatability with older .spop files that don't have lineage labels
-    assert(tmp.lineage_labels.GetSize() == 0 || tmp.lineage_labels.GetSize() == tmp.num_cpus);
-    
-    // Other org specs (if given in file)
-    if (load_rebirth) {
-      if (tmp.props->HasEntry("birth_cell")) {
-        cString birthstr(tmp.props->Get("birth_cell"));
-        while (birthstr.GetSize()) tmp.birth_cells.Push(birthstr.Pop(',').AsInt());
-        assert(tmp.birth_cells.GetSize() == 0 || tmp.birth_cells.GetSize() == tmp.num_cpus);      
-      }
-      if (tmp.props->HasEntry("av_bcell") && m_world->GetConfig().USE_AVATARS.Get()) {
-        cString avatarstr(tmp.props->Get("av_bcell"));
-        while (avatarstr.GetSize()) tmp.avatar_cells.Push(avatarstr.Pop(',').AsInt());
-        assert(tmp.avatar_cells.GetSize() == 0 || tmp.avatar_cells.GetSize() == tmp.num_cpus);
-      }
-      if (tmp.props->HasEntry("parent_is_teach")) {
-        cString teachstr(tmp.props->Get("parent_is_teach"));
-        while (teachstr.GetSize()) tmp.parent_teacher.Push((bool)(teachstr.Pop(',').AsInt()));
-        assert(tmp.parent_teacher.GetSize() == 0 || tmp.parent_teacher.GetSize() == tmp.num_cpus);
-      }
-      if (tmp.props->HasEntry("parent_ft")) {
-        cString parentftstr(tmp.props->Get("parent_ft"));
-        while (parentftstr.GetSize()) tmp.parent_ft.Push(parentftstr.Pop(',').AsInt());
-        assert(tmp.parent_ft.GetSize() == 0 || tmp.parent_ft.GetSize() == tmp.num_cpus);
-      }
-      if (tmp.props->HasEntry("parent_merit")) {
-        cString meritstr(tmp.props->Get("parent_merit"));
-        while (meritstr.GetSize()) tmp.parent_merit.Push(meritstr.Pop(',').AsDouble());
-        assert(tmp.parent_merit.GetSize() == 0 || tmp.parent_merit.GetSize() == tmp.num_cpus);      
-      }
-    }
-    else {
-      if (load_groups) {
-        if (tmp.props->HasEntry("group_id")) {
-          cString groupstr(tmp.props->Get("group_id"));
-          while (groupstr.GetSize()) tmp.group_ids.Push(groupstr.Pop(',').AsInt());
-          assert(tmp.group_ids.GetSize() == 0 || tmp.group_ids.GetSize() == tmp.num_cpus);
-        }
-        if (tmp.props->HasEntry("forager_type")) {
-          cString foragestr(tmp.props->Get("forager_type"));
-          while (foragestr.GetSize()) tmp.forager_types.Push(foragestr.Pop(',').AsInt());
-          assert(tmp.forager_types.GetSize() == 0 || tmp.forager_types.GetSize() == tmp.num_cpus);
-        }
-      }
-      if (load_birth_cells) {   
-        if (tmp.props->HasEntry("birth_cell")) {
-          cString birthstr(tmp.props->Get("birth_cell"));
-          while (birthstr.GetSize()) tmp.birth_cells.Push(birthstr.Pop(',').AsInt());
-          assert(tmp.birth_cells.GetSize() == 0 || tmp.birth_cells.GetSize() == tmp.num_cpus);
-        }
-        if (tmp.props->HasEntry("av_bcell") && m_world->GetConfig().USE_AVATARS.Get()) {
-          cString avatarstr(tmp.props->Get("av_bcell"));
-          while (avatarstr.GetSize()) tmp.avatar_cells.Push(avatarstr.Pop(',').AsInt());
-          assert(tmp.avatar_cells.GetSize() == 0 || tmp.avatar_cells.GetSize() == tmp.num_cpus);
-        }
-      }
-      else if (!load_birth_cells && load_avatars && tmp.props->HasEntry("avatar_cell")) {
-        cString avatarstr(tmp.props->Get("avatar_cell"));
-        while (avatarstr.GetSize()) tmp.avatar_cells.Push(avatarstr.Pop(',').AsInt());
-        assert(tmp.avatar_cells.GetSize() == 0 || tmp.avatar_cells.GetSize() == tmp.num_cpus);
-      }
-    }
+  for (int i = 0; i < genotypes.GetSize(); i++) {
+    if (genotypes[i].cells.GetSize()) structured = true;
+    assert(!structured || genotypes[i].cells.GetSize() == genotypes[i].num_cpus);
   }
   
   // Sort genotypes in ascending order according to their id_num
   tArrayUtils::QSort(genotypes);
   
+  const cStringList& format = input_file.GetFormat();
+  tArray<cString> format_names(format.GetSize());
+  tConstListIterator<cString> format_it(format.GetList());
+  for (int i = 0; format_it.Next() != NULL; i++) format_names[i] = *format_it.Get();
+  const int col_parents = input_file.GetFormatColumn("parents");
+  
   cBioGroupManager* bgm = m_world->GetClassificationManager().GetBioGroupManager("genotype");
   for (int i = 0; i < genotypes.GetSize(); i++) {
     // Fix Parent IDs
     cString nparentstr;
     int pcount = 0;
-    cString lparentstr = genotypes[i].props->Get("parents");
+    cString lparentstr;
+    if (col_parents >= 0 && col_parents < genotypes[i].fields.GetSize()) lparentstr = genotypes[i].fields[col_parents];
     if (lparentstr == "(none)") lparentstr = ""; 
     cStringList opidlist(lparentstr, ',');
     while (opidlist.GetSize()) {
@@ -6112,9 +6389,14 @@ bool cPopulation::LoadPopulation(const cString& filename, cAvidaContext& ctx, in
       nparentstr += cStringUtil::Convert(npid);
       pcount++; 
     }
-    genotypes[i].props->Set("parents", nparentstr);
     
-    genotypes[i].bg = bgm->LoadBioGroup(*genotypes[i].props);
+    // The bio group takes its properties by name; build them for just this genotype
+    tDictionary<cString> props;
+    for (int c = 0; c < genotypes[i].fields.GetSize(); c++) props.Set(format_names[c], genotypes[i].fields[c]);
+    props.Set("parents", nparentstr);
+    
+    genotypes[i].bg = bgm->LoadBioGroup(props);
+    genotypes[i].fields.Resize(0);
   }
   
   
@@ -6157,9 +6439,8 @@ bool cPopulation::LoadPopulation(const cString& filename, cAvidaContext& ctx, in
         phenotype.SetMerit(cMerit(phenotype.ConvertEnergyToMerit(phenotype.GetStoredEnergy())));
       } else {
         // Set the phenotype merit from the save file
-        assert(tmp.props->HasEntry("merit"));
-        double merit = tmp.props->Get("merit").AsDouble();
-        if (load_rebirth && m_world->GetConfig().INHERIT_MERIT.Get() && tmp.props->HasEntry("parent_merit")) { 
+        double merit = tmp.merit;
+        if (load_rebirth && m_world->GetConfig().INHERIT_MERIT.Get() && tmp.has_parent_merit) { 
           merit = tmp.parent_merit[cell_i]; 
         }
         
@@ -6173,7 +6454,7 @@ bool cPopulation::LoadPopulation(const cString& filename, cAvidaContext& ctx, in
           // Adjust initial merit to account for organism execution at the time the population was saved
           // - this factors the merit by the fraction of the gestation time remaining
           // - this will be approximate, since gestation time may vary for each organism, but it should work for many cases
-          double gest_time = tmp.props->Get("gest_time").AsDouble();
+          double gest_time = tmp.gest_time;
           double gest_remain = gest_time - (double)tmp.offsets[cell_i];
           if (gest_remain > 0.0 && gest_time > 0.0) {
             double new_merit = phenotype.GetMerit().GetDouble() * (gest_time / gest_remain);
@@ -6570,6 +6851,9 @@ void cPopulation::BuildTimeSlicer()
     case SLICE_INTEGRATED_MERIT:
       schedule = new cIntegratedSchedule(cell_array.GetSize());
       break;
+    case SLICE_BINNED_PROB_MERIT:
+      schedule = new cBinnedProbSchedule(cell_array.GetSize(), m_world->GetRandom().GetInt(0x7FFFFFFF));
+      break;
     case SLICE_CONSTANT_BURST:
       schedule = new cConstBurstSchedule(cell_array.GetSize(), m_world->GetConfig().SLICING_BURST_SIZE.Get());
     default:
@@ -6580,13 +6864,47 @@ void cPopulation::BuildTimeSlicer()
 }
 
 
-void cPopulation::FindEmptyCell(tList<cPopulationCell> & cell_list,
-                                tList<cPopulationCell> & found_list)
+void cPopulation::BuildDemeSchedules()
 {
-  tListIterator<cPopulationCell> cell_it(cell_list);
-  cPopulationCell * test_cell;
+  if (!m_world->GetConfig().DEMES_PARTITIONED_EXECUTION.Get()) return;
+  
+  const int num_demes = deme_array.GetSize();
+  m_deme_schedules.Resize(num_demes, NULL);
+  m_deme_rngs.Resize(num_demes, NULL);
+  m_deme_partitions.Resize(num_demes);
   
-  while ( (test_cell = cell_it.Next()) != NULL) {
+  // Within a deme, every organism-level slicing method reduces to its single-deme form
+  for (int i = 0; i < num_demes; i++) {
+    const int deme_size = deme_array[i].GetSize();
+    switch (m_world->GetConfig().SLICING_METHOD.Get()) {
+      case SLICE_CONSTANT:
+        m_deme_schedules[i] = new cConstSchedule(deme_size);
+        break;
+      case SLICE_PROB_MERIT:
+      case SLICE_DEME_PROB_MERIT:
+      case SLICE_PROB_DEMESIZE_PROB_MERIT:
+        m_deme_schedules[i] = new cProbSchedule(deme_size, m_world->GetRandom().GetInt(0x7FFFFFFF));
+        break;
+      case SLICE_CONSTANT_BURST:
+        m_deme_schedules[i] = new cConstBurstSchedule(deme_size, m_world->GetConfig().SLICING_BURST_SIZE.Get());
+        break;
+      case SLICE_BINNED_PROB_MERIT:
+        m_deme_schedules[i] = new cBinnedProbSchedule(deme_size, m_world->GetRandom().GetInt(0x7FFFFFFF));
+        break;
+      default:
+        m_deme_schedules[i] = new cIntegratedSchedule(deme_size);
+        break;
+    }
+    m_deme_rngs[i] = new cRandom(m_world->GetRandom().GetInt(0x7FFFFFFF));
+  }
+}
+
+
+void cPopulation::FindEmptyCell(cPopulationCell::connection_list_type& cell_list,
+                                tList<cPopulationCell>& found_list)
+{
+  for (int i = 0; i < cell_list.GetSize(); i++) {
+    cPopulationCell* test_cell = cell_list.GetPos(i);
     // If this cell is empty, add it to the list...
     if (test_cell->IsOccupied() == false) found_list.Push(test_cell);
   }
@@ -6788,14 +7106,13 @@ void cPopulation::RemovePredators(cAvidaContext& ctx)
 
 void cPopulation::PrintPhenotypeData(const cString& filename)
 {
-  set<int> ids;
   set<cString> complete;
   double average_shannon_diversity = 0.0;
   int num_orgs = 0; //could get from elsewhere, but more self-contained this way
   double average_num_tasks = 0.0;
   
   //implementing a very poor man's hash...
-  tArray<int> phenotypes;
+  tArray<cBitArray> phenotypes;
   tArray<int> phenotype_counts;
   
   for (int i = 0; i < cell_array.GetSize(); i++) {
@@ -6805,30 +7122,30 @@ void cPopulation::PrintPhenotypeData(const cString& filename)
     num_orgs++;
     const cPhenotype& phenotype = cell_array[i].GetOrganism()->GetPhenotype();
     
+    // Phenotypes are told apart by the set of tasks done, compared a word at a time
+    const cBitArray& task_bits = phenotype.GetLastTaskBits();
+    average_num_tasks += task_bits.CountBits();
+    
     int total_tasks = 0;
-    int id = 0;
     cString key;
     for (int j = 0; j < phenotype.GetLastTaskCount().GetSize(); j++) {
-      if (phenotype.GetLastTaskCount()[j] > 0) id += (1 << j);
-      if (phenotype.GetLastTaskCount()[j] > 0) average_num_tasks += 1.0;
       key += cStringUtil::Stringf("%i-", phenotype.GetLastTaskCount()[j]);
       total_tasks += phenotype.GetLastTaskCount()[j];
     }
-    ids.insert(id);
     complete.insert(key);
     
     // add one to our count for this key
     int k;
     for(k=0; k<phenotypes.GetSize(); k++)
     {
-      if (phenotypes[k] == id) {
+      if (phenotypes[k] == task_bits) {
         phenotype_counts[k] = phenotype_counts[k] + 1;
         break;
       }
     }
     // this is a new key
     if (k == phenotypes.GetSize()) {
-      phenotypes.Push(id);
+      phenotypes.Push(task_bits);
       phenotype_counts.Push(1);
     }
     
@@ -6856,7 +7173,7 @@ void cPopulation::PrintPhenotypeData(const cString& filename)
   cDataFile& df = m_world->GetDataFile(filename);
   df.WriteTimeStamp();
   df.Write(m_world->GetStats().GetUpdate(), "Update");
-  df.Write(static_cast<int>(ids.size()), "Unique Phenotypes (by task done)");
+  df.Write(phenotypes.GetSize(), "Unique Phenotypes (by task done)");
   df.Write(shannon_diversity_of_phenotypes, "Shannon Diversity of Phenotypes (by task done)");
   df.Write(static_cast<int>(complete.size()), "Unique Phenotypes (by task count)");
   df.Write(average_shannon_diversity, "Average Phenotype Shannon Diversity (by task count)");
@@ -6912,14 +7229,13 @@ void cPopulation::PrintPhenotypeStatus(const cString& filename)
 
 void cPopulation::PrintHostPhenotypeData(const cString& filename)
 {
-  set<int> ids;
   set<cString> complete;
   double average_shannon_diversity = 0.0;
   int num_orgs = 0; //could get from elsewhere, but more self-contained this way
   double average_num_tasks = 0.0;
   
   //implementing a very poor man's hash...
-  tArray<int> phenotypes;
+  tArray<cBitArray> phenotypes;
   tArray<int> phenotype_counts;
   
   for (int i = 0; i < cell_array.GetSize(); i++) {
@@ -6929,30 +7245,30 @@ void cPopulation::PrintHostPhenotypeData(const cString& filename)
     num_orgs++;
     const cPhenotype& phenotype = cell_array[i].GetOrganism()->GetPhenotype();
     
+    // Phenotypes are told apart by the set of tasks done, compared a word at a time
+    const cBitArray& task_bits = phenotype.GetLastHostTaskBits();
+    average_num_tasks += task_bits.CountBits();
+    
     int total_tasks = 0;
-    int id = 0;
     cString key;
     for (int j = 0; j < phenotype.GetLastHostTaskCount().GetSize(); j++) {
-      if (phenotype.GetLastHostTaskCount()[j] > 0) id += (1 << j);
-      if (phenotype.GetLastHostTaskCount()[j] > 0) average_num_tasks += 1.0;
       key += cStringUtil::Stringf("%i-", phenotype.GetLastHostTaskCount()[j]);
       total_tasks += phenotype.GetLastHostTaskCount()[j];
     }
-    ids.insert(id);
     complete.insert(key);
     
     // add one to our count for this key
     int k;
     for(k=0; k<phenotypes.GetSize(); k++)
     {
-      if (phenotypes[k] == id) {
+      if (phenotypes[k] == task_bits) {
         phenotype_counts[k] = phenotype_counts[k] + 1;
         break;
       }
     }
     // this is a new key
     if (k == phenotypes.GetSize()) {
-      phenotypes.Push(id);
+      phenotypes.Push(task_bits);
       phenotype_counts.Push(1);
     }
     
@@ -6980,7 +7296,7 @@ void cPopulation::PrintHostPhenotypeData(const cString& filename)
   cDataFile& df = m_world->GetDataFile(filename);
   df.WriteTimeStamp();
   df.Write(m_world->GetStats().GetUpdate(), "Update");
-  df.Write(static_cast<int>(ids.size()), "Unique Phenotypes (by task done)");
+  df.Write(phenotypes.GetSize(), "Unique Phenotypes (by task done)");
   df.Write(shannon_diversity_of_phenotypes, "Shannon Diversity of Phenotypes (by task done)");
   df.Write(static_cast<int>(complete.size()), "Unique Phenotypes (by task count)");
   df.Write(average_shannon_diversity, "Average Phenotype Shannon Diversity (by task count)");
@@ -6990,14 +7306,13 @@ void cPopulation::PrintHostPhenotypeData(const cString& filename)
 
 void cPopulation::PrintParasitePhenotypeData(const cString& filename)
 {
-  set<int> ids;
   set<cString> complete;
   double average_shannon_diversity = 0.0;
   int num_orgs = 0; //could get from elsewhere, but more self-contained this way
   double average_num_tasks = 0.0;
   
   //implementing a very poor man's hash...
-  tArray<int> phenotypes;
+  tArray<cBitArray> phenotypes;
   tArray<int> phenotype_counts;
   
   for (int i = 0; i < cell_array.GetSize(); i++) {
@@ -7007,30 +7322,30 @@ void cPopulation::PrintParasitePhenotypeData(const cString& filename)
     num_orgs++;
     const cPhenotype& phenotype = cell_array[i].GetOrganism()->GetPhenotype();
     
+    // Phenotypes are told apart by the set of tasks done, compared a word at a time
+    const cBitArray& task_bits = phenotype.GetLastParasiteTaskBits();
+    average_num_tasks += task_bits.CountBits();
+    
     int total_tasks = 0;
-    int id = 0;
     cString key;
     for (int j = 0; j < phenotype.GetLastParasiteTaskCount().GetSize(); j++) {
-      if (phenotype.GetLastParasiteTaskCount()[j] > 0) id += (1 << j);
-      if (phenotype.GetLastParasiteTaskCount()[j] > 0) average_num_tasks += 1.0;
       key += cStringUtil::Stringf("%i-", phenotype.GetLastParasiteTaskCount()[j]);
       total_tasks += phenotype.GetLastParasiteTaskCount()[j];
     }
-    ids.insert(id);
     complete.insert(key);
     
     // add one to our count for this key
     int k;
     for(k=0; k<phenotypes.GetSize(); k++)
     {
-      if (phenotypes[k] == id) {
+      if (phenotypes[k] == task_bits) {
         phenotype_counts[k] = phenotype_counts[k] + 1;
         break;
       }
     }
     // this is a new key
     if (k == phenotypes.GetSize()) {
-      phenotypes.Push(id);
+      phenotypes.Push(task_bits);
       phenotype_counts.Push(1);
     }
     
@@ -7058,7 +7373,7 @@ void cPopulation::PrintParasitePhenotypeData(const cString& filename)
   cDataFile& df = m_world->GetDataFile(filename);
   df.WriteTimeStamp();
   df.Write(m_world->GetStats().GetUpdate(), "Update");
-  df.Write(static_cast<int>(ids.size()), "Unique Phenotypes (by task done)");
+  df.Write(phenotypes.GetSize(), "Unique Phenotypes (by task done)");
   df.Write(shannon_diversity_of_phenotypes, "Shannon Diversity of Phenotypes (by task done)");
   df.Write(static_cast<int>(complete.size()), "Unique Phenotypes (by task count)");
   df.Write(average_shannon_diversity, "Average Phenotype Shannon Diversity (by task count)");
@@ -7677,6 +7992,8 @@ void cPopulation::UpdateResourceCount(const int Verbosity, cWorld* world) {
       num_deme_res++;
   }
   
+  m_has_deme_res = (num_deme_res > 0);
+  
   for(int i = 0; i < GetNumDemes(); i++) {
     cResourceCount tmp_deme_res_count(num_deme_res);
     GetDeme(i).SetDemeResourceCount(tmp_deme_res_count);
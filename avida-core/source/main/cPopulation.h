@@ -31,6 +31,7 @@
 #include "cString.h"
 #include "cWorld.h"
 #include "tArray.h"
+#include "tConnectionList.h"
 #include "tList.h"
 #include "tVector.h"
 
@@ -49,6 +50,7 @@ class cEnvironment;
 class cLineage;
 class cOrganism;
 class cPopulationCell;
+class cRandom;
 class cSchedule;
 class cSaleItem;
 
@@ -105,6 +107,31 @@ private:
   bool m_has_predatory_res;
   
   tArray<cDeme> deme_array;            // Deme structure of the population.
+  bool m_has_deme_res;                 // Are there deme-level resources whose clocks must advance?
+  
+  // Deme-partitioned execution (DEMES_PARTITIONED_EXECUTION)
+  struct sDemePartition
+  {
+    int cycles;       // CPU cycles allotted to the deme in the current update
+    int used;         // Cycles used so far
+    int held_pos;     // Schedule position of a step held for the serial phase, -1 if none
+    int executed;     // Steps executed, added to the stats once the update is done
+    bool replicate;   // Implicit replication awaits the end of the update
+  };
+  class cPartitionJob;
+  
+  tArray<cSchedule*> m_deme_schedules;  // Per-deme schedules, indexed by cell position within the deme
+  tArray<cRandom*> m_deme_rngs;         // Per-deme random number streams
+  tArray<sDemePartition> m_deme_partitions;
+  
+  // Deferred births (DEFERRED_BIRTHS)
+  struct sPendingBirth
+  {
+    cOrganism* offspring;
+    int target_cell;
+  };
+  tSmartArray<sPendingBirth> m_pending_births; // Offspring awaiting placement at the end of the update
+  tArray<bool> m_cell_claimed;                 // Cells already taken by a birth in the batch being committed
  
   // Outside interactions...
   bool sync_events;   // Do we need to sync up the event list with population?
@@ -131,7 +158,7 @@ public:
   void InjectGenome(int cell_id, eBioUnitSource src, const Genome& genome, cAvidaContext& ctx, int lineage_label = 0, bool assign_group = true); 
 
   // Activate the offspring of an organism in the population
-  bool ActivateOffspring(cAvidaContext& ctx, const Genome& offspring_genome, cOrganism* parent_organism);
+  bool ActivateOffspring(cAvidaContext& ctx, Genome& offspring_genome, cOrganism* parent_organism);
   bool ActivateParasite(cOrganism* host, cBioUnit* parent, const cString& label, const Sequence& injected_code);
   
   // Helper function for ActivateParasite - returns if the parasite from the infected host should infect the target host
@@ -236,6 +263,10 @@ public:
   int ScheduleOrganism();          // Determine next organism to be processed.
   void ProcessStep(cAvidaContext& ctx, double step_size, int cell_id);
   void ProcessStepSpeculative(cAvidaContext& ctx, double step_size, int cell_id);
+  
+  // Process a whole update with each deme run as an independent partition...
+  bool UsesDemePartitions() const { return m_deme_schedules.GetSize() > 0; }
+  void ProcessDemePartitions(cAvidaContext& ctx, int update_size);
 
   // Calculate the statistics from the most recent update.
   void ProcessPostUpdate(cAvidaContext& ctx);
@@ -313,6 +344,7 @@ public:
 
   cEnvironment& GetEnvironment() { return environment; }
   int GetNumOrganisms() { return num_organisms; }
+  double GetTotalScheduledMerit() const;
 
   int GetNumPreyOrganisms() { return num_prey_organisms; }
   int GetNumPredOrganisms() { return num_pred_organisms; }
@@ -412,6 +444,14 @@ public:
 
 private:
   void BuildTimeSlicer(); // Build the schedule object
+  void BuildDemeSchedules(); // Build the per-deme schedules and random streams for partitioned execution
+  double GetDemeScheduleWeight(int deme_id);
+  bool CanSpeculateDemePartitions();
+  void RunDemePartitions(cAvidaContext& ctx, int begin, int end);
+  bool StepDemePartition(cAvidaContext& ctx, int deme_id, bool speculative);
+  bool CanDeferBirths();
+  void CommitPendingBirths(cAvidaContext& ctx);
+  bool TestImplicitDemeRepro(cDeme& deme);
   
   // Methods to place offspring in the population.
   cPopulationCell& PositionOffspring(cPopulationCell& parent_cell, cAvidaContext& ctx, bool parent_ok = true); 
@@ -422,7 +462,7 @@ private:
   cPopulationCell& PositionDemeRandom(int deme_id, cPopulationCell& parent_cell, bool parent_ok = true);
   int UpdateEmptyCellIDArray(int deme_id = -1);
   tArray<int>& GetEmptyCellIDArray() { return empty_cell_id_array; }
-  void FindEmptyCell(tList<cPopulationCell>& cell_list, tList<cPopulationCell>& found_list);
+  void FindEmptyCell(tConnectionList<cPopulationCell>& cell_list, tList<cPopulationCell>& found_list);
   int FindRandEmptyCell();
   
   // Update statistics collecting...
@@ -440,7 +480,7 @@ private:
   void CCladeSetupOrganism(cOrganism* organism); 
 	
   // Must be called to activate *any* organism in the population.
-  bool ActivateOrganism(cAvidaContext& ctx, cOrganism* in_organism, cPopulationCell& target_cell, bool assign_group = true, bool is_inject = false);
+  bool ActivateOrganism(cAvidaContext& ctx, cOrganism* in_organism, cPopulationCell& target_cell, bool assign_group = true, bool is_inject = false, bool record_birth = true);
   
   void TestForMiniTrace(cOrganism* in_organism);
   void SetupMiniTrace(cOrganism* in_organism);
@@ -30,6 +30,7 @@
 #include "cPopulation.h"
 #include "cDeme.h"
 
+#include <algorithm>
 #include <cmath>
 #include <iterator>
 
@@ -48,14 +49,13 @@ cPopulationCell::cPopulationCell(const cPopulationCell& in_cell)
 , can_input(false)
 , can_output(false)
 , m_hgt(0)
+, m_neighborhood(0)
 {
   // Copy the mutation rates into a new structure
   m_mut_rates = new cMutationRates(*in_cell.m_mut_rates);
 	
   // Copy the connection list
-  tConstListIterator<cPopulationCell> conn_it(in_cell.m_connections);
-  cPopulationCell* test_cell;
-  while ((test_cell = const_cast<cPopulationCell*>(conn_it.Next()))) m_connections.PushRear(test_cell);
+  m_connections = in_cell.m_connections;
 	
 	// copy the hgt information, if needed.
 	if(in_cell.m_hgt) {
@@ -85,9 +85,7 @@ void cPopulationCell::operator=(const cPopulationCell& in_cell)
 			m_mut_rates->Copy(*in_cell.m_mut_rates);
 		
 		// Copy the connection list
-		tConstListIterator<cPopulationCell> conn_it(in_cell.m_connections);
-		cPopulationCell* test_cell;
-		while ((test_cell = const_cast<cPopulationCell*>(conn_it.Next()))) m_connections.PushRear(test_cell);
+		m_connections = in_cell.m_connections;
 		
 		// copy hgt information, if needed.
 		delete m_hgt;
@@ -96,6 +94,10 @@ void cPopulationCell::operator=(const cPopulationCell& in_cell)
 			InitHGTSupport();
 			*m_hgt = *in_cell.m_hgt;
 		}
+		
+		// neighborhood rings are rebuilt on demand
+		delete m_neighborhood;
+		m_neighborhood = 0;
 	}
 }
 
@@ -128,15 +130,7 @@ void cPopulationCell::Rotate(cPopulationCell& new_facing)
     return;
   }
 	
-#ifdef DEBUG
-  int scan_count = 0;
-#endif
-  while (m_connections.GetFirst() != &new_facing) {
-    m_connections.CircNext();
-#ifdef DEBUG
-    assert(++scan_count < m_connections.GetSize());
-#endif
-  }
+  m_connections.Face(&new_facing);
 }
 
 /*! This method recursively builds a set of cells that neighbor this cell, out to 
@@ -147,10 +141,9 @@ void cPopulationCell::GetNeighboringCells(std::set<cPopulationCell*>& cell_set,
 	typedef std::set<cPopulationCell*> cell_set_t;
   
   // For each cell in our connection list...
-  tConstListIterator<cPopulationCell> i(m_connections);
-  while(!i.AtEnd()) {
+  for (int i = 0; i < m_connections.GetSize(); i++) {
 		// store the cell pointer, and check to see if we've already visited that cell...
-    cPopulationCell* cell = i.Next();
+    cPopulationCell* cell = m_connections.GetPos(i);
 		assert(cell != 0); // cells should never be null.
 		std::pair<cell_set_t::iterator, bool> ins = cell_set.insert(cell);
 		// and if so, recurse to it...
@@ -173,14 +166,88 @@ void cPopulationCell::GetOccupiedNeighboringCells(std::set<cPopulationCell*>& oc
 	}
 }
 
+static bool CellIDLess(const cPopulationCell* a, const cPopulationCell* b) { return a->GetID() < b->GetID(); }
+
+/*! Build the rings of cells around this one by breadth-first search over the connection
+ lists: ring d holds the cells first reached in d hops.  The rings are kept until the
+ connection list of a cell they were expanded from changes, and grown in place when a deeper
+ neighborhood is requested, so a broadcast is a walk over a prefix of one array.
+ */
+const cPopulationCell::Neighborhood& cPopulationCell::BuildNeighborhood(int depth) const
+{
+  if (m_neighborhood == 0) {
+    m_neighborhood = new Neighborhood;
+    m_neighborhood->complete = false;
+  }
+  Neighborhood& nbhd = *m_neighborhood;
+  
+  // Expanded cells are this one followed by cells in ring order, so edits[i] belongs to cells[i - 1]
+  for (int i = 0; i < nbhd.edits.GetSize(); i++) {
+    const cPopulationCell* cell = (i == 0) ? this : nbhd.cells[i - 1];
+    if (cell->m_connections.GetEditCount() != nbhd.edits[i]) {
+      nbhd.complete = false;
+      nbhd.cells.Resize(0);
+      nbhd.ring_end.Resize(0);
+      nbhd.edits.Resize(0);
+      break;
+    }
+  }
+  if (nbhd.complete || nbhd.ring_end.GetSize() >= depth) return nbhd;
+
+  std::set<const cPopulationCell*> visited;
+  visited.insert(this);
+  for (int i = 0; i < nbhd.cells.GetSize(); i++) visited.insert(nbhd.cells[i]);
+
+  while (nbhd.ring_end.GetSize() < depth) {
+    const int num_rings = nbhd.ring_end.GetSize();
+    const int prev_begin = (num_rings > 1) ? nbhd.ring_end[num_rings - 2] : 0;
+    const int ring_begin = nbhd.cells.GetSize();
+
+    // Expand every cell of the outermost ring (or this cell, to start)
+    const int num_frontier = (num_rings > 0) ? (ring_begin - prev_begin) : 1;
+    for (int f = 0; f < num_frontier; f++) {
+      const cPopulationCell* from = (num_rings > 0) ? nbhd.cells[prev_begin + f] : this;
+      nbhd.edits.Push(from->m_connections.GetEditCount());
+      for (int i = 0; i < from->m_connections.GetSize(); i++) {
+        cPopulationCell* cell = from->m_connections.GetPos(i);
+        assert(cell != 0); // cells should never be null.
+        if (visited.insert(cell).second) nbhd.cells.Push(cell);
+      }
+    }
+
+    const int ring_size = nbhd.cells.GetSize() - ring_begin;
+    if (ring_size == 0) {
+      nbhd.complete = true;
+      break;
+    }
+    std::sort(&nbhd.cells[0] + ring_begin, &nbhd.cells[0] + nbhd.cells.GetSize(), CellIDLess);
+    nbhd.ring_end.Push(nbhd.cells.GetSize());
+  }
+
+  return nbhd;
+}
+
+cPopulationCell::NeighborhoodIterator cPopulationCell::GetNeighborhood(int depth, bool occupied_only) const
+{
+  return NeighborhoodIterator(BuildNeighborhood(depth).cells, GetNeighborhoodSize(depth), occupied_only);
+}
+
+int cPopulationCell::GetNeighborhoodSize(int depth) const
+{
+  if (depth < 1) return 0;
+  const Neighborhood& nbhd = BuildNeighborhood(depth);
+  const int num_rings = nbhd.ring_end.GetSize();
+  if (num_rings == 0) return 0;
+  return nbhd.ring_end[((depth < num_rings) ? depth : num_rings) - 1];
+}
+
 void cPopulationCell::GetOccupiedNeighboringCells(Apto::Array<cPopulationCell*>& occupied_cells) const
 {
   occupied_cells.Resize(m_connections.GetSize());
   int occupied_count = 0;
 
-  tLWConstListIterator<cPopulationCell> i(m_connections);
-  while(!i.AtEnd()) {
-    cPopulationCell* cell = i.Next();
+  for (int i = 0; i < m_connections.GetSize(); i++) {
+    cPopulationCell* cell = m_connections.GetPos(i);
 		assert(cell); // cells should never be null.
     if (cell->IsOccupied()) occupied_cells[occupied_count++] = cell;
   }
@@ -531,8 +598,7 @@ unsigned int cPopulationCell::CountGenomeFragments() const {
  */
 Sequence cPopulationCell::PopGenomeFragment() {
 	assert(m_hgt!=0);
-	fragment_list_type::iterator i = m_hgt->fragments.begin();
-	std::advance(i, m_world->GetRandom().GetUInt(0, m_hgt->fragments.size()));	
+	fragment_list_type::iterator i = m_hgt->fragments.begin() + m_world->GetRandom().GetUInt(0, m_hgt->fragments.size());
 	Sequence tmp = *i;
 	m_hgt->fragments.erase(i);
 	return tmp;
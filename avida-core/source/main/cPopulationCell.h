@@ -36,9 +36,15 @@
 #ifndef tArray_h
 #include "tArray.h"
 #endif
+#ifndef tConnectionList_h
+#include "tConnectionList.h"
+#endif
 #ifndef tList_h
 #include "tList.h"
 #endif
+#ifndef tSmartArray_h
+#include "tSmartArray.h"
+#endif
 #include "cGenomeUtil.h"
 
 class cHardwareBase;
@@ -60,7 +66,7 @@ private:
   cOrganism* m_organism;                    // The occupent of this cell.
   cHardwareBase* m_hardware;
 
-  tList<cPopulationCell> m_connections;  // A list of neighboring cells.
+  tConnectionList<cPopulationCell> m_connections;  // Neighboring cells; the first is the one faced.
   cMutationRates* m_mut_rates;           // Mutation rates at this cell.
   tArray<int> m_inputs;                 // Environmental Inputs...
 
@@ -93,10 +99,13 @@ private:
 
 public:
   typedef std::set<cPopulationCell*> neighborhood_type; //!< Type for cell neighborhoods.
+  typedef tConnectionList<cPopulationCell> connection_list_type; //!< Type for the connections to neighboring cells.
+
+  class NeighborhoodIterator;
 
-  cPopulationCell() : m_world(NULL), m_organism(NULL), m_hardware(NULL), m_mut_rates(NULL), m_migrant(false), can_input(false), can_output(false), m_hgt(0) { ; }
+  cPopulationCell() : m_world(NULL), m_organism(NULL), m_hardware(NULL), m_mut_rates(NULL), m_migrant(false), can_input(false), can_output(false), m_hgt(0), m_neighborhood(0) { ; }
   cPopulationCell(const cPopulationCell& in_cell);
-  ~cPopulationCell() { delete m_mut_rates; delete m_hgt; }
+  ~cPopulationCell() { delete m_mut_rates; delete m_hgt; delete m_neighborhood; }
 
   void operator=(const cPopulationCell& in_cell);
 
@@ -111,11 +120,15 @@ public:
 
   inline cOrganism* GetOrganism() const { return m_organism; }
   inline cHardwareBase* GetHardware() const { return m_hardware; }
-  inline tList<cPopulationCell>& ConnectionList() { return m_connections; }
+  inline connection_list_type& ConnectionList() { return m_connections; }
   //! Recursively build a set of cells that neighbor this one, out to the given depth.
   void GetNeighboringCells(std::set<cPopulationCell*>& cell_set, int depth) const;
   //! Recursively build a set of occupied cells that neighbor this one, out to the given depth.
   void GetOccupiedNeighboringCells(std::set<cPopulationCell*>& occupied_cell_set, int depth) const;
+  //! Iterate over the cells within the given number of hops of this one, nearest first (each ring in cell ID order).
+  NeighborhoodIterator GetNeighborhood(int depth, bool occupied_only = false) const;
+  //! Number of cells (occupied or not) within the given number of hops of this one.
+  int GetNeighborhoodSize(int depth) const;
   void GetOccupiedNeighboringCells(Apto::Array<cPopulationCell*>& occupied_cells) const;
   inline cPopulationCell& GetCellFaced() { return *(m_connections.GetFirst()); }
   int GetFacing();  // Returns the facing of this cell.
@@ -216,8 +229,46 @@ private:
   inline void InitHGTSupport() { if(!m_hgt) { m_hgt = new HGTSupport(); } }
   //! Is HGT initialized?
   inline bool IsHGTInitialized() const { return m_hgt != 0; }
+
+  //! Cells in rings of increasing hop distance from this one, built on first use.
+  struct Neighborhood {
+    bool complete;                      //!< True if no cells lie beyond the last ring.
+    tSmartArray<cPopulationCell*> cells; //!< Ring 1 first, then ring 2...; each ring in cell ID order.
+    tSmartArray<int> ring_end;          //!< ring_end[d - 1] is the number of cells within d hops.
+    tSmartArray<unsigned int> edits;    //!< Connection edit count of each cell expanded so far, this one first.
+  };
+  mutable Neighborhood* m_neighborhood; //!< Lazily-built neighborhood rings, discarded when the connections they came from change.
+  //! Return the neighborhood rings, (re)building them out to at least the given depth as needed.
+  const Neighborhood& BuildNeighborhood(int depth) const;
+
+public:
+  //! Walks the cells of a neighborhood in order, optionally skipping empty ones.
+  class NeighborhoodIterator
+  {
+  private:
+    const tSmartArray<cPopulationCell*>* m_cells;
+    int m_pos;
+    int m_end;
+    bool m_occupied_only;
+
+  public:
+    NeighborhoodIterator(const tSmartArray<cPopulationCell*>& cells, int end, bool occupied_only)
+      : m_cells(&cells), m_pos(0), m_end(end), m_occupied_only(occupied_only) { ; }
+
+    //! Return the next cell, or NULL once the neighborhood is exhausted.
+    inline cPopulationCell* Next();
+  };
 };
 
+inline cPopulationCell* cPopulationCell::NeighborhoodIterator::Next()
+{
+  while (m_pos < m_end) {
+    cPopulationCell* cell = (*m_cells)[m_pos++];
+    if (!m_occupied_only || cell->IsOccupied()) return cell;
+  }
+  return NULL;
+}
+
 inline int cPopulationCell::GetInputAt(int& input_pointer)
 {
   input_pointer %= m_inputs.GetSize();
@@ -238,7 +238,7 @@ bool cPopulationInterface::GetLGTFragment(cAvidaContext& ctx, int region, const
 }
 
 
-bool cPopulationInterface::Divide(cAvidaContext& ctx, cOrganism* parent, const Genome& offspring_genome)
+bool cPopulationInterface::Divide(cAvidaContext& ctx, cOrganism* parent, Genome& offspring_genome)
 {
   assert(parent != NULL);
   assert(m_world->GetPopulation().GetCell(m_cell_id).GetOrganism() == parent);
@@ -272,9 +272,7 @@ void cPopulationInterface::GetNeighborhoodCellIDs(tArray<int>& list)
   assert(cell.IsOccupied());
   
   list.Resize(cell.ConnectionList().GetSize());
-  tConstListIterator<cPopulationCell> it(cell.ConnectionList());
-  int i = 0;
-  while (it.Next() != NULL) list[i++] = it.Get()->GetID();
+  for (int i = 0; i < list.GetSize(); i++) list[i] = cell.ConnectionList().GetPos(i)->GetID();
 }
 
 int cPopulationInterface::GetFacing()
@@ -621,6 +619,15 @@ bool cPopulationInterface::BroadcastMessage(cOrgMessage& msg, int depth) {
   cPopulationCell& cell = m_world->GetPopulation().GetCell(m_cell_id);
   assert(cell.IsOccupied()); // This organism; sanity.
 	
+	if (m_world->GetConfig().BCAST_NEIGHBORHOOD_RINGS.Get()) {
+		// Send a message towards each cell within range, nearest first (a cell is never part of its own neighborhood).
+		cPopulationCell::NeighborhoodIterator it = cell.GetNeighborhood(depth);
+		while (cPopulationCell* rcell = it.Next()) {
+			SendMessage(msg, *rcell);
+		}
+		return true;
+	}
+	
 	// Get the set of cells that are within range.
 	std::set<cPopulationCell*> cell_set;
 	cell.GetNeighboringCells(cell_set, depth);
@@ -643,7 +650,16 @@ bool cPopulationInterface::BcastAlarm(int jump_label, int bcast_range) {
 	
   const int ALARM_SELF = m_world->GetConfig().ALARM_SELF.Get(); // does an alarm affect the sender; 0=no  non-0=yes
   
-  if(bcast_range > 1) { // multi-hop messaging
+  if (m_world->GetConfig().BCAST_NEIGHBORHOOD_RINGS.Get()) {
+    // Alarm every organism within range over the cell connections; anything less than one hop is treated as one hop.
+    cPopulationCell::NeighborhoodIterator it = scell.GetNeighborhood(max(bcast_range, 1), true);
+    while (cPopulationCell* rcell = it.Next()) {
+      cOrganism* recvr = rcell->GetOrganism();
+      assert(recvr != NULL);
+      recvr->moveIPtoAlarmLabel(jump_label);
+      successfully_sent = true;
+    }
+  } else if(bcast_range > 1) { // multi-hop messaging
     cDeme& deme = m_world->GetPopulation().GetDeme(GetDemeID());
     for(int i = 0; i < deme.GetSize(); i++) {
       int possible_receiver_id = deme.GetCellID(i);
@@ -1135,8 +1151,7 @@ void cPopulationInterface::DoHGTMutation(cAvidaContext& ctx, Genome& offspring)
 		if(cell.CountGenomeFragments() > 0) {
 			// add a randomly-selected fragment to the list of fragments to be HGT'd,
 			// remove it from the cell, and adjust the level of HGT resource.
-			fragment_list_type::iterator selected=cell.GetFragments().begin();
-			std::advance(selected, ctx.GetRandom().GetInt(cell.GetFragments().size()));
+			fragment_list_type::iterator selected=cell.GetFragments().begin() + ctx.GetRandom().GetInt(cell.GetFragments().size());
 			fragments.insert(fragments.end(), *selected);			
 			m_world->GetPopulation().AdjustHGTResource(ctx, -selected->GetSize());
 			cell.GetFragments().erase(selected);
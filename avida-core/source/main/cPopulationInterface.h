@@ -100,7 +100,7 @@ public:
 
   bool GetLGTFragment(cAvidaContext& ctx, int region, const Genome& dest_genome, Sequence& seq);
 
-  bool Divide(cAvidaContext& ctx, cOrganism* parent, const Genome& offspring_genome);
+  bool Divide(cAvidaContext& ctx, cOrganism* parent, Genome& offspring_genome);
   cOrganism* GetNeighbor();
   bool IsNeighborCellOccupied();
   int GetNumNeighbors();
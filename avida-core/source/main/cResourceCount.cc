@@ -28,10 +28,12 @@
 #include "cStats.h"
 
 #include "nGeometry.h"
+#include "AvidaTools.h"
 
 #include <cmath>
 
 using namespace std;
+using namespace AvidaTools;
 
 const double cResourceCount::UPDATE_STEP(1.0 / 10000.0);
 const double cResourceCount::EPSILON (1.0e-15);
@@ -103,6 +105,7 @@ cResourceCount::cResourceCount(int num_resources)
   , spatial_update_time(0.0)
   , m_last_updated(0)
   , m_spatial_update(0)
+  , m_spatial_interval(1)
 {
   if(num_resources > 0) {
     SetSize(num_resources);
@@ -735,42 +738,54 @@ void cResourceCount::DoUpdates(cAvidaContext& ctx, bool global_only) const
   // Determine how many update steps have progressed
   int num_steps = (int) (update_time / UPDATE_STEP);
 
-  // Preserve remainder of update_time
-  update_time -=  num_steps * UPDATE_STEP;
+  // Until a full step has passed there is nothing to apply to the global resources
+  if (num_steps > 0) {
+    // Preserve remainder of update_time
+    update_time -=  num_steps * UPDATE_STEP;
 
+    // Whole blocks of PRECALC_DISTANCE steps are applied in closed form; n repetitions of x -> d * x + f
+    // leave d^n * x + f * (1 - d^n) / (1 - d).  The remainder comes straight from the tables.
+    const int num_blocks = num_steps / PRECALC_DISTANCE;
+    const int rem_steps = num_steps % PRECALC_DISTANCE;
 
-  while (num_steps > PRECALC_DISTANCE) {
     for (int i = 0; i < resource_count.GetSize(); i++) {
       if (geometry[i] == nGeometry::GLOBAL || geometry[i]==nGeometry::PARTIAL) {
-        resource_count[i] *= decay_precalc(i, PRECALC_DISTANCE);
-        resource_count[i] += inflow_precalc(i, PRECALC_DISTANCE);
+        if (num_blocks > 0) {
+          const double block_decay = decay_precalc(i, PRECALC_DISTANCE);
+          const double block_inflow = inflow_precalc(i, PRECALC_DISTANCE);
+          const double total_decay = pow(block_decay, num_blocks);
+          resource_count[i] *= total_decay;
+          if (block_decay == 1.0) resource_count[i] += block_inflow * num_blocks;
+          else resource_count[i] += block_inflow * (1.0 - total_decay) / (1.0 - block_decay);
+        }
+        resource_count[i] *= decay_precalc(i, rem_steps);
+        resource_count[i] += inflow_precalc(i, rem_steps);
       }
     }
-    num_steps -= PRECALC_DISTANCE;
-  }
-
-  for (int i = 0; i < resource_count.GetSize(); i++) {
-    if (geometry[i] == nGeometry::GLOBAL || geometry[i]==nGeometry::PARTIAL) {
-      resource_count[i] *= decay_precalc(i, num_steps);
-      resource_count[i] += inflow_precalc(i, num_steps);
-    }
   }
   
   if (global_only) return;
 
-  // If one (or more) complete update has occured update the spatial resources
+  // If one (or more) complete update has occured update the spatial resources.  A single step covers up to
+  // m_spatial_interval updates, with inflow, decay, outflow and flow scaled to the number of updates it stands for.
   while (m_spatial_update > m_last_updated) {
-    m_last_updated++;
+    const int num_updates = Min(m_spatial_interval, m_spatial_update - m_last_updated);
+    m_last_updated += num_updates;
     for (int i = 0; i < resource_count.GetSize(); i++) {
      if (geometry[i] != nGeometry::GLOBAL && geometry[i] != nGeometry::PARTIAL) {
         spatial_resource_count[i]->UpdateCount(ctx);
-        spatial_resource_count[i]->Source(inflow_rate[i]);
-        spatial_resource_count[i]->Sink(decay_rate[i]);
+        if (num_updates == 1) {
+          spatial_resource_count[i]->Source(inflow_rate[i]);
+          spatial_resource_count[i]->Sink(decay_rate[i]);
+        } else {
+          spatial_resource_count[i]->Source(inflow_rate[i] * num_updates);
+          spatial_resource_count[i]->Sink(pow(decay_rate[i], num_updates));
+        }
         if (spatial_resource_count[i]->GetCellListSize() > 0) {
-          spatial_resource_count[i]->CellInflow();
-          spatial_resource_count[i]->CellOutflow();
+          spatial_resource_count[i]->CellInflow(num_updates);
+          spatial_resource_count[i]->CellOutflow(num_updates);
         }
-        spatial_resource_count[i]->FlowAll();
+        spatial_resource_count[i]->FlowAll(num_updates);
         spatial_resource_count[i]->StateAll();
         // BDB: resource_count[i] = spatial_resource_count[i]->SumAll();
       }
@@ -60,6 +60,7 @@ private:
   mutable double spatial_update_time;
   mutable int m_last_updated;
   mutable int m_spatial_update;
+  int m_spatial_interval;         // Most updates a single spatial step may cover
 
   void DoUpdates(cAvidaContext& ctx, bool global_only = false) const;         // Update resource count based on update time
 
@@ -164,7 +165,7 @@ public:
   int GetMaxUsedX(int res_id);
   int GetMaxUsedY(int res_id);
   
-  void SetSpatialUpdate(int update) { m_spatial_update = update; }
+  void SetSpatialUpdate(int update, int interval = 1) { m_spatial_update = update; m_spatial_interval = interval; }
   void UpdateGlobalResources(cAvidaContext& ctx) { DoUpdates(ctx, true); }
   void UpdateResources(cAvidaContext& ctx) { DoUpdates(ctx, false); }
 };
@@ -313,13 +313,32 @@ void cSpatialResCount::StateAll() {
   } 
 }
 
-void cSpatialResCount::FlowAll() {
+/* Scale a diffusion or gravity rate to cover num_updates updates in one step.  The
+   result is capped at a magnitude of 1 (or the rate's own, if larger), beyond which
+   a single step would overshoot the equilibrium it is flowing towards */
+
+static inline double ScaleFlowRate(double rate, int num_updates)
+{
+  const double limit = Max(fabs(rate), 1.0);
+  return Max(Min(rate * num_updates, limit), -limit);
+}
+
+void cSpatialResCount::FlowAll(int num_updates) {
 
   // @JEB save time if diffusion and gravity off...
   if ((xdiffuse == 0.0) && (ydiffuse == 0.0) && (xgravity == 0.0) && (ygravity == 0.0)) return;
 
   int     i,k,ii,xdist,ydist;
   double  dist;
+  double  step_xdiffuse = xdiffuse, step_ydiffuse = ydiffuse;
+  double  step_xgravity = xgravity, step_ygravity = ygravity;
+
+  if (num_updates > 1) {
+    step_xdiffuse = ScaleFlowRate(xdiffuse, num_updates);
+    step_ydiffuse = ScaleFlowRate(ydiffuse, num_updates);
+    step_xgravity = ScaleFlowRate(xgravity, num_updates);
+    step_ygravity = ScaleFlowRate(ygravity, num_updates);
+  }
  
   for (i = 0; i < num_cells; i++) {
       
@@ -332,7 +351,7 @@ void cSpatialResCount::FlowAll() {
       ydist = grid[i].GetPtrYdist(k);
       dist = grid[i].GetPtrDist(k);
       if (ii >= 0) {
-        FlowMatter(grid[i],grid[ii],xdiffuse,ydiffuse,xgravity,ygravity,
+        FlowMatter(grid[i],grid[ii],step_xdiffuse,step_ydiffuse,step_xgravity,step_ygravity,
                    xdist, ydist, dist);
       }
     }
@@ -370,9 +389,9 @@ void cSpatialResCount::Source(double amount) const {
   }
 }
 
-/* Handle the inflow for a list of individual cells */
+/* Handle the inflow for a list of individual cells, over num_updates updates */
 
-void cSpatialResCount::CellInflow() const {
+void cSpatialResCount::CellInflow(int num_updates) const {
   for (int i=0; i < cell_list_ptr->GetSize(); i++) {
     const int cell_id = (*cell_list_ptr)[i].GetId();
     
@@ -380,7 +399,7 @@ void cSpatialResCount::CellInflow() const {
        the resource for the testCPU that does not have a grid set up */
        
     if (cell_id >= 0 && cell_id < grid.GetSize()) {
-      Rate(cell_id, (*cell_list_ptr)[i].GetInflow());
+      Rate(cell_id, (*cell_list_ptr)[i].GetInflow() * num_updates);
     }
   }
 }
@@ -403,9 +422,10 @@ void cSpatialResCount::Sink(double decay) const {
   }
 }
 
-/* Take away a give percentage of a resource from individual cells */
+/* Take away a give percentage of a resource from individual cells, compounded
+   over num_updates updates */
 
-void cSpatialResCount::CellOutflow() const {
+void cSpatialResCount::CellOutflow(int num_updates) const {
 
   double deltaamount = 0.0;
 
@@ -416,8 +436,9 @@ void cSpatialResCount::CellOutflow() const {
        the resource for the testCPU that does not have a grid set up */
        
     if (cell_id >= 0 && cell_id < grid.GetSize()) {
-      deltaamount = Max((GetAmount(cell_id) *
-                         (*cell_list_ptr)[i].GetOutflow()), 0.0);
+      double outflow = (*cell_list_ptr)[i].GetOutflow();
+      if (num_updates > 1) outflow = 1.0 - pow(1.0 - outflow, num_updates);
+      deltaamount = Max((GetAmount(cell_id) * outflow), 0.0);
     }                     
     Rate((*cell_list_ptr)[i].GetId(), -deltaamount); 
   }
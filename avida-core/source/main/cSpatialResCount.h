@@ -81,12 +81,12 @@ public:
   double GetAmount(int x, int y) const;
   void RateAll(double ratein); 
   virtual void StateAll();
-  void FlowAll(); 
+  void FlowAll(int num_updates = 1); 
   double SumAll() const;
   void Source(double amount) const;
-  void CellInflow() const;
+  void CellInflow(int num_updates = 1) const;
   void Sink(double percent) const;
-  void CellOutflow() const;
+  void CellOutflow(int num_updates = 1) const;
   void SetCellAmount(int cell_id, double res);
   void SetInitial(double initial) { m_initial = initial; }
   double GetInitial() const { return m_initial; }
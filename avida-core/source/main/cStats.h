@@ -695,6 +695,7 @@ public:
                      int total_genotypes, double fitness, double lineage_stat1, double lineage_stat2 );
 
   void IncExecuted() { num_executed++; }
+  void AddExecuted(int count) { num_executed += count; }
 
   void AddNumOrgsKilled(long num) { sum_orgs_killed.Add(num); }
 	void AddNumUnoccupiedCellAttemptedToKill(long num) { sum_unoccupied_cell_kill_attempts.Add(num); }
@@ -39,6 +39,7 @@
 #include "cPopulation.h"
 #include "cStats.h"
 #include "cTestCPU.h"
+#include "cTestResultCache.h"
 #include "cUserFeedback.h"
 
 #include <cassert>
@@ -48,7 +49,7 @@ using namespace AvidaTools;
 
 cWorld::cWorld(cAvidaConfig* cfg, const cString& wd)
   : m_working_dir(wd), m_analyze(NULL), m_conf(cfg), m_ctx(this, m_rng), m_class_mgr(NULL), m_datafile_mgr(NULL)
-  , m_env(NULL), m_event_list(NULL), m_hw_mgr(NULL),m_mig_mat(NULL), m_pop(NULL), m_stats(NULL), m_driver(NULL), m_data_mgr(NULL)   // MIGRATION_MATRIX
+  , m_env(NULL), m_event_list(NULL), m_hw_mgr(NULL),m_mig_mat(NULL), m_pop(NULL), m_stats(NULL), m_driver(NULL), m_test_cache(NULL), m_test_cache_revision(0), m_test_cache_settings(0), m_data_mgr(NULL), m_thread_rng_users(0)   // MIGRATION_MATRIX
 {
 }
 
@@ -73,6 +74,7 @@ cWorld::~cWorld()
   delete m_class_mgr; m_class_mgr = NULL;
   delete m_env; m_env = NULL;
   delete m_event_list; m_event_list = NULL;
+  delete m_test_cache; m_test_cache = NULL;
   delete m_hw_mgr; m_hw_mgr = NULL;
 
   // Delete after all classes that may be logging items
@@ -187,12 +189,52 @@ bool cWorld::setup(cUserFeedback* feedback)
     success = false;
   }
   
+  // Open the test result cache last, once setup has filled in any settings left to it (e.g. ENERGY_CAP), so that the
+  // settings it is keyed on are those in effect for the run
+  if (m_conf->TEST_RESULT_CACHE.Get() != "") {
+    cString cache_path(Apto::FileSystem::GetAbsolutePath(Apto::String(m_conf->TEST_RESULT_CACHE.Get()), Apto::String(m_working_dir)));
+    m_test_cache = new cTestResultCache(this, cache_path);
+    if (!m_test_cache->IsOpen()) {
+      if (feedback) feedback->Warning("unable to open test result cache '%s', continuing without it", (const char*)cache_path);
+      delete m_test_cache;
+      m_test_cache = NULL;
+    }
+    m_test_cache_revision = m_conf->GetRevision();
+    m_test_cache_settings = cTestResultCache::SettingsFingerprint(*m_conf);
+  }
+  
   return success;
 }
 
 Apto::SmartPtr<Data::Provider, Apto::ThreadSafeRefCount> cWorld::GetStatsProvider(cWorld*) { return m_stats; }
 
 
+cTestResultCache* cWorld::GetTestResultCache()
+{
+  // The cached results only hold for the settings the cache was opened with.  Should events or analyze commands change
+  // them during the run, the cache is set aside for as long as they differ.
+  if (m_test_cache && m_conf->GetRevision() != m_test_cache_revision) {
+    const unsigned int revision = m_conf->GetRevision();
+    if (cTestResultCache::SettingsFingerprint(*m_conf) != m_test_cache_settings) return NULL;
+    m_test_cache_revision = revision;
+  }
+  return m_test_cache;
+}
+
+
+// Point the calling thread's GetRandom() at rng (or back at the world's generator, for NULL).  The generator replaced
+// is returned so that callers can put it back once done.
+cRandom* cWorld::SetThreadRandom(cRandom* rng)
+{
+  cRandom** cur = m_thread_rng.Get();
+  cRandom* prev = (cur) ? *cur : NULL;
+  if (rng && !prev) Apto::Atomic::Inc(&m_thread_rng_users);
+  m_thread_rng.Set((rng) ? new cRandom*(rng) : NULL);
+  if (prev && !rng) Apto::Atomic::Add(&m_thread_rng_users, -1);
+  return prev;
+}
+
+
 cAnalyze& cWorld::GetAnalyze()
 {
   if (m_analyze == NULL) m_analyze = new cAnalyze(this);
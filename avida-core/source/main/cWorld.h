@@ -22,7 +22,9 @@
 #ifndef cWorld_h
 #define cWorld_h
 
+#include "apto/core/Atomic.h"
 #include "apto/core/SmartPtr.h"
+#include "apto/core/ThreadSpecific.h"
 #include "avida/data/Types.h"
 
 #include "cAvidaConfig.h"
@@ -49,6 +51,7 @@ class cMerit;
 class cPopulationCell;
 class cStats;
 class cTestCPU;
+class cTestResultCache;
 class cUserFeedback;
 template<class T> class tDataEntry;
 template<class T> class tDictionary;
@@ -73,11 +76,16 @@ protected:
   cPopulation* m_pop;
   Apto::SmartPtr<cStats, Apto::ThreadSafeRefCount> m_stats;
   WorldDriver* m_driver;
+  cTestResultCache* m_test_cache;
+  unsigned int m_test_cache_revision;  // Config revision and settings fingerprint when the cache was opened
+  unsigned int m_test_cache_settings;
   
   Avida::Data::Manager* m_data_mgr;
 
   cRandom m_rng;
   cRandom m_srng;         // second random number seq to be used for random sampling etc without changing run processes
+  Apto::ThreadSpecific<cRandom*> m_thread_rng;  // stands in for m_rng on threads that have set one
+  volatile int m_thread_rng_users;              // threads holding one; m_thread_rng is only looked up while nonzero
   
   bool m_test_on_div;     // flag derived from a collection of configuration settings
   bool m_test_sterilize;  // flag derived from a collection of configuration settings
@@ -110,9 +118,11 @@ public:
   cHardwareManager& GetHardwareManager() { return *m_hw_mgr; }
   cMigrationMatrix& GetMigrationMatrix(){ return *m_mig_mat; }; // MIGRATION_MATRIX
   cPopulation& GetPopulation() { return *m_pop; }
-  cRandom& GetRandom() { return m_rng; } 
+  cRandom& GetRandom() { return (Apto::Atomic::Get(&m_thread_rng_users)) ? getThreadRandom() : m_rng; }
+  cRandom* SetThreadRandom(cRandom* rng);  // calling thread only; NULL clears, returns the generator replaced
   cRandom& GetRandomSample() { return m_srng; }
   cStats& GetStats() { return *m_stats; }
+  cTestResultCache* GetTestResultCache();  // NULL unless TEST_RESULT_CACHE names a file
   WorldDriver& GetDriver() { return *m_driver; }
   
   Data::Manager& GetDataManager() { return *m_data_mgr; }
@@ -157,6 +167,7 @@ public:
 protected:
   // Internal Methods
   bool setup(cUserFeedback* errors); 
+  cRandom& getThreadRandom() { cRandom** rng = m_thread_rng.Get(); return (rng) ? **rng : m_rng; }
 
 };
 
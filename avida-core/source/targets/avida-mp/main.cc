@@ -32,12 +32,14 @@
 #include <boost/mpi/environment.hpp>
 #include <boost/mpi/communicator.hpp>
 
+#include "apto/core/FileSystem.h"
+#include "avida/core/Version.h"
+#include "avida/util/CmdLine.h"
+
 #include "cAvidaConfig.h"
-#include "AvidaTools.h"
 #include "cDefaultAnalyzeDriver.h"
 #include "cDefaultRunDriver.h"
 #include "cMultiProcessWorld.h"
-#include "Platform.h"
 
 using namespace std;
 
@@ -47,11 +49,11 @@ int main(int argc, char * argv[])
 {
   Avida::Initialize();
   
-  Avida::PrintVersionBanner();
+  cout << Avida::Version::Banner() << endl;
 
   // Initialize the configuration data...
   cAvidaConfig* cfg = new cAvidaConfig();
-  Avida::ProcessCmdLineArgs(argc, argv, cfg);
+  Avida::Util::ProcessCmdLineArgs(argc, argv, cfg);
 
 	boost::mpi::environment mpi_env; //!< MPI environment.
 	boost::mpi::communicator mpi_world; //!< World-wide MPI communicator.
@@ -64,7 +66,8 @@ int main(int argc, char * argv[])
 	cfg->DATA_DIR.Set(dirname.str().c_str());
 	cout << "Data directory overwritten for Avida-MP: " << cfg->DATA_DIR.Get() << endl;
   
-  cWorld* world = cMultiProcessWorld::Initialize(cfg, AvidaTools::FileSystem::GetCWD(), mpi_env, mpi_world);
+  cWorld* world = cMultiProcessWorld::Initialize(cfg, cString(Apto::FileSystem::GetCWD()), mpi_env, mpi_world);
+  if (!world) return -1;
 
   cout << endl;
   
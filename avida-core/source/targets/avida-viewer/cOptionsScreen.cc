@@ -87,6 +87,9 @@ void cOptionsScreen::Draw(cAvidaContext& ctx)
   case SLICE_INTEGRATED_MERIT:
     Print(1, 55, "Integrated");
     break;
+  case SLICE_BINNED_PROB_MERIT:
+    Print(1, 55, "Binned Probablistic");
+    break;
   }
 
   switch(info.GetConfig().BASE_MERIT_METHOD.Get()) {
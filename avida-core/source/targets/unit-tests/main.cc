@@ -19,6 +19,8 @@
  *
  */
 
+#include <cmath>
+#include <cstring>
 #include <iostream>
 #include <iomanip>
 
@@ -349,7 +351,54 @@ protected:
     for (int i = 0; i < 32; i++) { bit_array11.SetBit(i, true); }
     bit_array11.INCREMENT(33);
     ReportTestResult("Increment (multiple bit fields)", (bit_array11.GetBit(32) == 1 && bit_array11.CountBits(33) == 1));
-    
+
+    // COUNTAND, COUNTANDNOT, COUNTXOR
+
+    // Bits are set past num_bits in the last field so that those beyond the end must be masked out
+    cRawBitArray bit_array12(96);
+    cRawBitArray bit_array13(96);
+    for (int i = 0; i < 96; i++) {
+      if (i % 3 == 0 || i % 5 == 0) bit_array12.SetBit(i, true);
+      if (i % 2 == 0 || i % 7 == 0) bit_array13.SetBit(i, true);
+    }
+
+    // num_bits, start_bit: within one field, across fields, and ending in a partial last field
+    const int count_ranges[][2] = { {10, 0}, {10, 3}, {32, 31}, {70, 0}, {70, 40}, {70, 65}, {70, 70}, {64, 32} };
+    const int num_count_ranges = sizeof(count_ranges) / sizeof(count_ranges[0]);
+
+    result = true;
+    for (int r = 0; r < num_count_ranges; r++) {
+      const int num_bits = count_ranges[r][0];
+      const int start_bit = count_ranges[r][1];
+      int count = 0;
+      for (int i = start_bit; i < num_bits; i++) if (bit_array12.GetBit(i) && bit_array13.GetBit(i)) count++;
+      if (bit_array12.CountAND(bit_array13, num_bits, start_bit) != count) result = false;
+    }
+    ReportTestResult("CountAND", result);
+
+    result = true;
+    for (int r = 0; r < num_count_ranges; r++) {
+      const int num_bits = count_ranges[r][0];
+      const int start_bit = count_ranges[r][1];
+      int count = 0;
+      for (int i = start_bit; i < num_bits; i++) if (bit_array12.GetBit(i) && !bit_array13.GetBit(i)) count++;
+      if (bit_array12.CountANDNOT(bit_array13, num_bits, start_bit) != count) result = false;
+    }
+    ReportTestResult("CountANDNOT", result);
+
+    result = true;
+    for (int r = 0; r < num_count_ranges; r++) {
+      const int num_bits = count_ranges[r][0];
+      const int start_bit = count_ranges[r][1];
+      int count = 0;
+      for (int i = start_bit; i < num_bits; i++) if (bit_array12.GetBit(i) != bit_array13.GetBit(i)) count++;
+      if (bit_array12.CountXOR(bit_array13, num_bits, start_bit) != count) result = false;
+    }
+    ReportTestResult("CountXOR", result);
+
+    result = (bit_array12.CountAND(bit_array13, 70) == bit_array12.CountAND(bit_array13, 70, 0));
+    ReportTestResult("CountAND (default start bit)", result);
+
   }
 };
 
@@ -382,6 +431,243 @@ protected:
 
 
 
+#include "cBinnedWeightedIndex.h"
+#include "cBinnedProbSchedule.h"
+#include "cMerit.h"
+#include "cRandom.h"
+class cBinnedWeightedIndexTests : public cUnitTest
+{
+public:
+  const char* GetUnitName() { return "cBinnedWeightedIndex"; }
+protected:
+  void RunTests()
+  {
+    bool result = true;
+    cRandom rng(100);
+    
+    cBinnedWeightedIndex index(8);
+    ReportTestResult("Constructor", index.GetSize() == 8 && index.GetTotalWeight() == 0.0);
+    ReportTestResult("Draw with no weight", index.Draw(rng) == -1);
+    
+    index.SetWeight(3, 5.0);
+    result = true;
+    for (int i = 0; i < 100; i++) if (index.Draw(rng) != 3) result = false;
+    ReportTestResult("Draw single item", result);
+    
+    // Weights spread across several bins, including bin boundaries
+    const double weights[8] = { 1.0, 0.5, 2.0, 0.0, 3.75, 1000.0, 0.001, 64.0 };
+    for (int i = 0; i < 8; i++) index.SetWeight(i, weights[i]);
+    result = true;
+    double total = 0.0;
+    for (int i = 0; i < 8; i++) {
+      if (index.GetWeight(i) != weights[i]) result = false;
+      total += weights[i];
+    }
+    ReportTestResult("SetWeight/GetWeight", result);
+    ReportTestResult("GetTotalWeight", fabs(index.GetTotalWeight() - total) < 1e-9);
+    
+    // Move items between bins and back out of the index
+    index.SetWeight(5, 0.25);
+    index.SetWeight(1, 12.0);
+    index.SetWeight(7, 64.0);
+    index.SetWeight(6, 0.0);
+    total += (0.25 - 1000.0) + (12.0 - 0.5) - 0.001;
+    ReportTestResult("GetTotalWeight after updates", fabs(index.GetTotalWeight() - total) < 1e-9);
+    
+    result = true;
+    for (int i = 0; i < 10000; i++) {
+      const int id = index.Draw(rng);
+      if (id < 0 || id >= 8 || index.GetWeight(id) == 0.0) result = false;
+    }
+    ReportTestResult("Zero weight items never drawn", result);
+    
+    // Draw frequencies should match the weights; the chi-squared bound is far above the 99.9th percentile for 5 d.f.
+    const int num_draws = 200000;
+    int counts[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    for (int i = 0; i < num_draws; i++) counts[index.Draw(rng)]++;
+    double chi_sq = 0.0;
+    for (int i = 0; i < 8; i++) {
+      const double expected = num_draws * index.GetWeight(i) / index.GetTotalWeight();
+      if (expected > 0.0) chi_sq += (counts[i] - expected) * (counts[i] - expected) / expected;
+    }
+    ReportTestResult("Sampling distribution", counts[3] == 0 && counts[6] == 0 && chi_sq < 30.0);
+    
+    for (int i = 0; i < 8; i++) index.SetWeight(i, 0.0);
+    ReportTestResult("Cleared index", index.GetTotalWeight() == 0.0 && index.Draw(rng) == -1);
+    
+    cBinnedProbSchedule schedule(4, 100);
+    schedule.Adjust(0, cMerit(10.0));
+    schedule.Adjust(2, cMerit(30.0));
+    schedule.Adjust(0, cMerit(0.0));
+    result = true;
+    for (int i = 0; i < 100; i++) if (schedule.GetNextID() != 2) result = false;
+    ReportTestResult("cBinnedProbSchedule Adjust", result);
+  }
+};
+
+
+
+
+#include "cConstSchedule.h"
+class cScheduleTests : public cUnitTest
+{
+public:
+  const char* GetUnitName() { return "cSchedule"; }
+protected:
+  void RunTests()
+  {
+    cConstSchedule schedule(4);
+    ReportTestResult("Empty total merit", schedule.GetTotalMerit() == 0.0);
+    
+    schedule.RecordMerit(0, cMerit(1.1));
+    schedule.RecordMerit(1, cMerit(2.2));
+    schedule.RecordMerit(2, cMerit(3.3));
+    schedule.RecordMerit(1, cMerit(7.7));
+    ReportTestResult("RecordMerit total", fabs(schedule.GetTotalMerit() - 12.1) < 1e-12);
+    
+    // Merits that do not sum exactly must still leave a total of zero once every item is gone
+    schedule.RecordMerit(2, cMerit(0.0));
+    schedule.RecordMerit(0, cMerit(0.0));
+    schedule.RecordMerit(1, cMerit(0.0));
+    ReportTestResult("Emptied total merit", schedule.GetTotalMerit() == 0.0);
+    
+    schedule.RecordMerit(3, cMerit(2.5));
+    ReportTestResult("Refilled total merit", schedule.GetTotalMerit() == 2.5);
+  }
+};
+
+
+
+
+#include "cActionLibrary.h"
+#include "cAvidaContext.h"
+#include "cEventList.h"
+#include "cUserFeedback.h"
+class cEventListTests : public cUnitTest
+{
+private:
+  static cEventList* s_events;
+  static int s_fired;
+  
+  // Adds an event that counts its firings, as an action run from an event file might
+  class cActionAddCountEvent : public cAction
+  {
+  public:
+    cActionAddCountEvent(cWorld* world, const cString& args, Feedback&) : cAction(world, args) { ; }
+    static const cString GetDescription() { return "No Arguments"; }
+    void Process(cAvidaContext&)
+    {
+      cUserFeedback feedback;
+      s_events->AddEvent(cEventList::IMMEDIATE, cEventList::TRIGGER_BEGIN, cEventList::TRIGGER_ONCE,
+                         cEventList::TRIGGER_END, "UnitTestCountEvent", "", feedback);
+    }
+  };
+  class cActionCountEvent : public cAction
+  {
+  public:
+    cActionCountEvent(cWorld* world, const cString& args, Feedback&) : cAction(world, args) { ; }
+    static const cString GetDescription() { return "No Arguments"; }
+    void Process(cAvidaContext&) { s_fired++; }
+  };
+  
+public:
+  const char* GetUnitName() { return "cEventList"; }
+protected:
+  void RunTests()
+  {
+    cActionLibrary::Initialize();
+    cActionLibrary& library = cActionLibrary::GetInstance();
+    library.Register<cActionAddCountEvent>("UnitTestAddCountEvent");
+    library.Register<cActionCountEvent>("UnitTestCountEvent");
+    
+    cRandom rng(100);
+    cAvidaContext ctx(NULL, rng);
+    cUserFeedback feedback;
+    cEventList events(NULL);
+    s_events = &events;
+    s_fired = 0;
+    
+    events.AddEvent(cEventList::IMMEDIATE, cEventList::TRIGGER_BEGIN, cEventList::TRIGGER_ONCE, cEventList::TRIGGER_END,
+                    "UnitTestAddCountEvent", "", feedback);
+    events.Process(ctx);
+    ReportTestResult("Event added while processing fires in the same pass", s_fired == 1);
+    
+    events.Process(ctx);
+    ReportTestResult("Fired immediate event removed", s_fired == 1);
+    
+    library.Unregister("UnitTestAddCountEvent");
+    library.Unregister("UnitTestCountEvent");
+  }
+};
+cEventList* cEventListTests::s_events = NULL;
+int cEventListTests::s_fired = 0;
+
+
+
+
+#include "cAvidaConfig.h"
+#include "cTestResultCache.h"
+#include <cstdio>
+class cTestResultCacheTests : public cUnitTest
+{
+public:
+  const char* GetUnitName() { return "cTestResultCache"; }
+protected:
+  void RunTests()
+  {
+    const char* filename = "unit-tests-result-cache.tmp";
+    cAvidaConfig* base = new cAvidaConfig();
+    cAvidaConfig* changed = new cAvidaConfig();
+    
+    const unsigned int base_print = cTestResultCache::SettingsFingerprint(*base);
+    ReportTestResult("Fingerprint of equal settings", cTestResultCache::SettingsFingerprint(*changed) == base_print);
+    
+    changed->Set("DATA_DIR", "elsewhere");
+    changed->Set("RANDOM_SEED", "42");
+    ReportTestResult("Output settings and seed ignored", cTestResultCache::SettingsFingerprint(*changed) == base_print);
+    
+    const unsigned int revision = changed->GetRevision();
+    const unsigned int base_revision = base->GetRevision();
+    changed->COPY_MUT_PROB.Set(0.25);
+    ReportTestResult("Set bumps config revision", changed->GetRevision() != revision);
+    ReportTestResult("Other configs keep their revision", base->GetRevision() == base_revision);
+    const unsigned int changed_print = cTestResultCache::SettingsFingerprint(*changed);
+    ReportTestResult("Changed setting alters fingerprint", changed_print != base_print);
+    
+    cTestResultCache::cRecord record;
+    record.Write(7);
+    record.Write(2.5);
+    remove(filename);
+    {
+      cTestResultCache cache(filename, base_print);
+      cache.Add("key", record);
+    }
+    {
+      cTestResultCache cache(filename, base_print);
+      cTestResultCache::cRecord found;
+      int ival = 0;
+      double dval = 0.0;
+      const bool read = cache.Find("key", found) && found.Read(ival) && found.Read(dval);
+      ReportTestResult("Records kept on reopen", cache.GetNumRecords() == 1 && read && ival == 7 && dval == 2.5);
+    }
+    {
+      cTestResultCache cache(filename, changed_print);
+      cTestResultCache::cRecord found;
+      ReportTestResult("Records dropped for changed settings", cache.GetNumRecords() == 0 && !cache.Find("key", found));
+    }
+    {
+      cTestResultCache cache(filename, base_print);
+      ReportTestResult("Stale records not restored", cache.GetNumRecords() == 0);
+    }
+    remove(filename);
+    
+    delete changed;
+    delete base;
+  }
+};
+
+
+
 
 #define TEST(CLASS) \
 tester = new CLASS ## Tests(); \
@@ -403,6 +689,10 @@ int main(int argc, const char* argv[])
   TEST(tArray);
   TEST(cRawBitArray);
   TEST(cBitArray);
+  TEST(cBinnedWeightedIndex);
+  TEST(cSchedule);
+  TEST(cEventList);
+  TEST(cTestResultCache);
   
   if (failed == 0)
     cout << "All unit tests passed." << endl;
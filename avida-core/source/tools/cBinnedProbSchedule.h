@@ -0,0 +1,60 @@
+/*
+ *  cBinnedProbSchedule.h
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cBinnedProbSchedule_h
+#define cBinnedProbSchedule_h
+
+#ifndef cBinnedWeightedIndex_h
+#include "cBinnedWeightedIndex.h"
+#endif
+#ifndef cRandom_h
+#include "cRandom.h"
+#endif
+#ifndef cSchedule_h
+#include "cSchedule.h"
+#endif
+
+class cMerit;
+
+/**
+ * The Binned Probabilistic Schedule gives each item the same chance of being scheduled as the Probabilistic Schedule,
+ * proportional to its merit, but draws (and merit adjustments) take constant expected time rather than walking a
+ * tree of the whole population.
+ **/
+class cBinnedProbSchedule : public cSchedule
+{
+private:
+  cRandom m_rng;
+  cBinnedWeightedIndex m_index;
+  
+  
+  cBinnedProbSchedule(const cBinnedProbSchedule&); // @not_implemented
+  cBinnedProbSchedule& operator=(const cBinnedProbSchedule&); // @not_implemented
+
+public:
+  cBinnedProbSchedule(int num_cells, int seed) : cSchedule(num_cells), m_rng(seed), m_index(num_cells) { ; }
+  ~cBinnedProbSchedule() { ; }
+
+  virtual void Adjust(int item_id, const cMerit& merit, int deme_id = 0);
+
+  int GetNextID() { return m_index.Draw(m_rng); }
+};
+
+#endif
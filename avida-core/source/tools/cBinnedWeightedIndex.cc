@@ -0,0 +1,125 @@
+/*
+ *  cBinnedWeightedIndex.cc
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cBinnedWeightedIndex.h"
+
+#include "cRandom.h"
+
+#include <cassert>
+#include <cmath>
+
+
+cBinnedWeightedIndex::cBinnedWeightedIndex(int in_size)
+  : m_size(in_size), m_item_weight(in_size), m_item_bin(in_size), m_item_slot(in_size)
+{
+  m_item_weight.SetAll(0.0);
+  m_item_bin.SetAll(-1);
+  m_item_slot.SetAll(-1);
+}
+
+cBinnedWeightedIndex::~cBinnedWeightedIndex()
+{
+  for (int i = 0; i < m_bins.GetSize(); i++) delete m_bins[i];
+}
+
+
+int cBinnedWeightedIndex::findBin(int exponent)
+{
+  for (int i = 0; i < m_bins.GetSize(); i++) if (m_bins[i]->exponent == exponent) return i;
+
+  sBin* bin = new sBin;
+  bin->exponent = exponent;
+  bin->bound = ldexp(1.0, exponent);
+  bin->total = 0.0;
+  m_bins.Push(bin);
+  return m_bins.GetSize() - 1;
+}
+
+
+void cBinnedWeightedIndex::removeItem(int id)
+{
+  sBin& bin = *m_bins[m_item_bin[id]];
+  const int slot = m_item_slot[id];
+  const int last = bin.items[bin.items.GetSize() - 1];
+  bin.items[slot] = last;
+  m_item_slot[last] = slot;
+  bin.items.Pop();
+
+  // Running totals drift with rounding as weights come and go; an empty bin must weigh exactly nothing
+  bin.total = (bin.items.GetSize()) ? bin.total - m_item_weight[id] : 0.0;
+
+  m_item_bin[id] = -1;
+  m_item_slot[id] = -1;
+}
+
+
+void cBinnedWeightedIndex::SetWeight(int id, double weight)
+{
+  assert(weight >= 0.0);
+
+  if (m_item_bin[id] >= 0) removeItem(id);
+  m_item_weight[id] = weight;
+  if (weight <= 0.0) return;
+
+  int exponent;
+  frexp(weight, &exponent);  // weight < 2^exponent
+  const int bin_id = findBin(exponent);
+  sBin& bin = *m_bins[bin_id];
+  m_item_bin[id] = bin_id;
+  m_item_slot[id] = bin.items.GetSize();
+  bin.items.Push(id);
+  bin.total += weight;
+}
+
+
+double cBinnedWeightedIndex::GetTotalWeight() const
+{
+  double total = 0.0;
+  for (int i = 0; i < m_bins.GetSize(); i++) total += m_bins[i]->total;
+  return total;
+}
+
+
+int cBinnedWeightedIndex::Draw(cRandom& rng) const
+{
+  const double total = GetTotalWeight();
+  if (total <= 0.0) return -1;
+
+  // Pick the bin, falling back on the last occupied one should rounding leave the position past the end
+  double position = rng.GetDouble(total);
+  const sBin* bin = NULL;
+  for (int i = 0; i < m_bins.GetSize(); i++) {
+    const sBin* cur = m_bins[i];
+    if (!cur->items.GetSize()) continue;
+    bin = cur;
+    if (position < cur->total) break;
+    position -= cur->total;
+  }
+  assert(bin);
+
+  // Then an item from it; the fractional part of the scaled draw serves as the acceptance test
+  const int num_items = bin->items.GetSize();
+  while (true) {
+    const double scaled = rng.GetDouble() * num_items;
+    const int slot = static_cast<int>(scaled);
+    const int id = bin->items[slot];
+    if ((scaled - slot) * bin->bound < m_item_weight[id]) return id;
+  }
+}
@@ -0,0 +1,82 @@
+/*
+ *  cBinnedWeightedIndex.h
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cBinnedWeightedIndex_h
+#define cBinnedWeightedIndex_h
+
+#ifndef tArray_h
+#include "tArray.h"
+#endif
+#ifndef tSmartArray_h
+#include "tSmartArray.h"
+#endif
+
+class cRandom;
+
+/**
+ * Like cWeightedIndex, this class allows indices to be assigned a weight and then drawn with probability proportional
+ * to that weight, but both setting a weight and drawing take constant expected time.
+ *
+ * Items are binned by the binary exponent of their weight, so every weight in a bin lies within a factor of two of the
+ * bin's upper bound.  A draw picks a bin in proportion to its total weight (there are only as many bins as distinct
+ * exponents in use, a few dozen at most in practice), then a uniformly chosen item of the bin is accepted with
+ * probability weight / bound -- at least one half -- and the choice is repeated on rejection.  Items are drawn with
+ * exactly the probabilities a cWeightedIndex gives them, though from different random numbers.
+ **/
+class cBinnedWeightedIndex
+{
+private:
+  struct sBin
+  {
+    int exponent;
+    double bound;  // 2^exponent, above every weight in the bin
+    double total;
+    tSmartArray<int> items;
+  };
+
+  int m_size;
+  tArray<double> m_item_weight;
+  tArray<int> m_item_bin;   // Bin holding each item, or -1 while its weight is zero
+  tArray<int> m_item_slot;  // Position of each item within its bin's item list
+  tSmartArray<sBin*> m_bins;  // Every bin used so far; emptied bins are kept for reuse
+
+
+  cBinnedWeightedIndex(); // @not_implemented
+  cBinnedWeightedIndex(const cBinnedWeightedIndex&); // @not_implemented
+  cBinnedWeightedIndex& operator=(const cBinnedWeightedIndex&); // @not_implemented
+
+  int findBin(int exponent);
+  void removeItem(int id);
+
+public:
+  cBinnedWeightedIndex(int in_size);
+  ~cBinnedWeightedIndex();
+
+  void SetWeight(int id, double weight);
+  double GetWeight(int id) const { return m_item_weight[id]; }
+
+  double GetTotalWeight() const;
+  int GetSize() const { return m_size; }
+
+  //! Draw an index with probability proportional to its weight, or -1 if every weight is zero
+  int Draw(cRandom& rng) const;
+};
+
+#endif
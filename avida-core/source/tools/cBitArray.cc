@@ -115,6 +115,53 @@ int cRawBitArray::CountBits2(const int num_bits) const
   return bit_count;
 }
 
+// Parallel count of the bits in a single field, as in CountBits2().
+static inline int CountFieldBits(const unsigned int v)
+{
+  const unsigned int t1 = v - ((v >> 1) & 0x55555555);
+  const unsigned int t2 = (t1 & 0x33333333) + ((t1 >> 2) & 0x33333333);
+  return (((t2 + (t2 >> 4)) & 0xF0F0F0F) * 0x1010101) >> 24;
+}
+
+// Mask selecting the bits of field_id that lie in [start_bit, num_bits).
+static inline unsigned int RangeFieldMask(const int field_id, const int num_bits, const int start_bit)
+{
+  unsigned int mask = ~0u;
+  if (field_id == (start_bit >> 5)) mask &= ~0u << (start_bit & 31);
+  if (field_id == ((num_bits - 1) >> 5) && (num_bits & 31) != 0) mask &= (1u << (num_bits & 31)) - 1;
+  return mask;
+}
+
+int cRawBitArray::CountAND(const cRawBitArray & array2, const int num_bits, const int start_bit) const
+{
+  const int num_fields = GetNumFields(num_bits);
+  int bit_count = 0;
+  for (int i = GetField(start_bit); i < num_fields; i++) {
+    bit_count += CountFieldBits(bit_fields[i] & array2.bit_fields[i] & RangeFieldMask(i, num_bits, start_bit));
+  }
+  return bit_count;
+}
+
+int cRawBitArray::CountANDNOT(const cRawBitArray & array2, const int num_bits, const int start_bit) const
+{
+  const int num_fields = GetNumFields(num_bits);
+  int bit_count = 0;
+  for (int i = GetField(start_bit); i < num_fields; i++) {
+    bit_count += CountFieldBits(bit_fields[i] & ~array2.bit_fields[i] & RangeFieldMask(i, num_bits, start_bit));
+  }
+  return bit_count;
+}
+
+int cRawBitArray::CountXOR(const cRawBitArray & array2, const int num_bits, const int start_bit) const
+{
+  const int num_fields = GetNumFields(num_bits);
+  int bit_count = 0;
+  for (int i = GetField(start_bit); i < num_fields; i++) {
+    bit_count += CountFieldBits((bit_fields[i] ^ array2.bit_fields[i]) & RangeFieldMask(i, num_bits, start_bit));
+  }
+  return bit_count;
+}
+
 int cRawBitArray::FindBit1(const int num_bits, const int start_pos) const
 {
   // @CAO -- There are probably better ways to do this with bit tricks.
@@ -45,6 +45,11 @@ using namespace std;
 //  int CountBits2()  -- Count 1s -- fast for arbitary arrays.
 //  int FindBit1(int start_bit)   -- Return pos of first 1 after start_bit 
 
+// Combined bit counts (no temporary array is built; bits below start_bit are ignored):
+//  int CountAND(const cBitArray & array2, int start_bit=0) const    -- 1s in both arrays
+//  int CountANDNOT(const cBitArray & array2, int start_bit=0) const -- 1s here that are 0s in array2
+//  int CountXOR(const cBitArray & array2, int start_bit=0) const    -- positions where the arrays differ
+
 // Boolean math functions:
 //  cBitArray NOT() const
 //  cBitArray AND(const cBitArray & array2) const
@@ -135,8 +140,15 @@ public:
   }
 
   // The Copy() method and the Copy Constructor must both be told how many
-  // bits they are working with.
+  // bits they are working with.  CopyFields() reuses the existing storage, which
+  // must already hold num_bits.
   void Copy(const cRawBitArray & in_array, const int num_bits);
+  void CopyFields(const cRawBitArray & in_array, const int num_bits) {
+    const int num_fields = GetNumFields(num_bits);
+    for (int i = 0; i < num_fields; i++) {
+      bit_fields[i] = in_array.bit_fields[i];
+    }
+  }
   cRawBitArray(const cRawBitArray & in_array, const int num_bits)
     : bit_fields(NULL)
   {
@@ -175,6 +187,12 @@ public:
   int CountBits(const int num_bits) const; // Better for sparse arrays
   int CountBits2(const int num_bits) const; // Better for dense arrays
 
+  // Counts of the 1s in a combination of this array and array2, without storing
+  // the combination; bits below start_bit are not counted.
+  int CountAND(const cRawBitArray & array2, const int num_bits, const int start_bit = 0) const;
+  int CountANDNOT(const cRawBitArray & array2, const int num_bits, const int start_bit = 0) const;
+  int CountXOR(const cRawBitArray & array2, const int num_bits, const int start_bit = 0) const;
+
   // Other bit-play
   int FindBit1(const int num_bits, const int start_pos) const;
   tArray<int> GetOnes(const int num_bits) const;
@@ -261,6 +279,10 @@ public:
     , array_size(in_size) { ; }
 
   cBitArray & operator=(const cBitArray & in_array) {
+    if (array_size == in_array.array_size) {
+      bit_array.CopyFields(in_array.bit_array, array_size);
+      return *this;
+    }
     bit_array.Copy(in_array.bit_array, in_array.array_size);
     array_size = in_array.array_size;
     return *this;
@@ -305,6 +327,19 @@ public:
   int CountBits() const { return bit_array.CountBits(array_size); }
   int CountBits2() const { return bit_array.CountBits2(array_size); }
 
+  int CountAND(const cBitArray & array2, int start_bit=0) const {
+    assert(array_size == array2.array_size);
+    return bit_array.CountAND(array2.bit_array, array_size, start_bit);
+  }
+  int CountANDNOT(const cBitArray & array2, int start_bit=0) const {
+    assert(array_size == array2.array_size);
+    return bit_array.CountANDNOT(array2.bit_array, array_size, start_bit);
+  }
+  int CountXOR(const cBitArray & array2, int start_bit=0) const {
+    assert(array_size == array2.array_size);
+    return bit_array.CountXOR(array2.bit_array, array_size, start_bit);
+  }
+
   int FindBit1(int start_bit=0) const
     { return bit_array.FindBit1(array_size, start_bit); }
   tArray<int> GetOnes() const { return bit_array.GetOnes(array_size); }
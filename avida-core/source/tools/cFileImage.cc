@@ -0,0 +1,74 @@
+/*
+ *  cFileImage.cc
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cFileImage.h"
+
+#include "apto/platform.h"
+
+#include <fstream>
+
+#if APTO_PLATFORM(UNIX)
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+
+cFileImage::cFileImage(const cString& path, bool sequential) : m_data(NULL), m_size(0), m_mapped(false), m_open(false)
+{
+#if APTO_PLATFORM(UNIX)
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) return;
+  struct stat st;
+  if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode)) {
+    m_open = true;
+    m_size = st.st_size;
+    if (m_size == 0) {
+      close(fd);
+      return;
+    }
+    void* map = mmap(NULL, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map != MAP_FAILED) {
+      madvise(map, m_size, (sequential) ? MADV_SEQUENTIAL : MADV_RANDOM);
+      m_data = static_cast<const char*>(map);
+      m_mapped = true;
+      close(fd);
+      return;
+    }
+  }
+  close(fd);
+#endif
+  // Not mappable (or not a regular file), just read it all in
+  std::ifstream fp(path, std::ios::in | std::ios::binary);
+  if (!fp.good()) return;
+  m_open = true;
+  char chunk[65536];
+  while (fp.read(chunk, sizeof(chunk)) || fp.gcount() > 0) m_buffer.insert(m_buffer.end(), chunk, chunk + fp.gcount());
+  m_size = m_buffer.size();
+  m_data = m_size ? &m_buffer[0] : NULL;
+}
+
+cFileImage::~cFileImage()
+{
+#if APTO_PLATFORM(UNIX)
+  if (m_mapped) munmap(const_cast<char*>(m_data), m_size);
+#endif
+}
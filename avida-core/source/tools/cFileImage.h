@@ -0,0 +1,54 @@
+/*
+ *  cFileImage.h
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cFileImage_h
+#define cFileImage_h
+
+#include "cString.h"
+
+#include <cstddef>
+#include <vector>
+
+
+// Read-only view of a whole file: memory mapped where the platform allows, otherwise read into a buffer.
+class cFileImage
+{
+private:
+  const char* m_data;
+  size_t m_size;
+  bool m_mapped;
+  bool m_open;
+  std::vector<char> m_buffer;
+
+  cFileImage(); // @not_implemented
+  cFileImage(const cFileImage&); // @not_implemented
+  cFileImage& operator=(const cFileImage&); // @not_implemented
+
+public:
+  //! Map the file at path; sequential hints the platform that it will be read front to back
+  cFileImage(const cString& path, bool sequential = true);
+  ~cFileImage();
+
+  bool IsOpen() const { return m_open; }
+  const char* GetData() const { return m_data; }
+  size_t GetSize() const { return m_size; }
+};
+
+#endif
@@ -23,15 +23,41 @@
 #include "cInitFile.h"
 
 #include "apto/core/FileSystem.h"
+#include "apto/platform.h"
 
 #include "AvidaTools.h"
-#include "cFile.h"
+#include "cFileImage.h"
 #include "cStringIterator.h"
+#include "tParallelRange.h"
+
+#include <cstring>
+#include <fstream>
 
 
 using namespace std;
 
 
+// Strips comments and compresses whitespace (pass 1 of postProcess) over a range of lines
+struct cInitFile::sCleanLines
+{
+  tSmartArray<sLine*>& lines;
+
+  sCleanLines(tSmartArray<sLine*>& in_lines) : lines(in_lines) { ; }
+
+  void operator()(int begin, int end)
+  {
+    for (int i = begin; i < end; i++) {
+      cString& cur_line = lines[i]->line;
+
+      // Remove all characters past a comment mark and reduce whitespace.
+      int comment_pos = cur_line.Find('#');
+      if (comment_pos >= 0) cur_line.Clip(comment_pos);
+      cur_line.CompressWhitespace();
+    }
+  }
+};
+
+
 cInitFile::cInitFile(const cString& filename, const cString& working_dir, Feedback& feedback,
                      const Apto::Set<cString>* custom_directives)
 : m_filename(filename), m_found(false), m_opened(false), m_ftype("unknown")
@@ -107,7 +133,7 @@ bool cInitFile::loadFile(const cString& filename, tSmartArray<sLine*>& lines, co
                          const Apto::Set<cString>* custom_directives, Feedback& feedback)
 {
   cString path = cString(Apto::FileSystem::GetAbsolutePath(Apto::String(filename), Apto::String(working_dir))); 
-  cFile file(path);
+  cFileImage file(path);
   if (!file.IsOpen()) {
     feedback.Error("unable to open file '%s'.", (const char*)filename);
     return false;   // The file must be opened!
@@ -115,20 +141,32 @@ bool cInitFile::loadFile(const cString& filename, tSmartArray<sLine*>& lines, co
   
   m_found = true;
   
-  cStringList line_list;   // Create a list to load all of the lines into.
-
+  // Walk the lines of the image in place.  As with reading line by line, a trailing newline yields a final empty
+  // line, and a line ends at an embedded NUL.
+  const char* cur = file.GetData();
+  const char* const file_end = cur + file.GetSize();
   int linenum = 0;
-  cString buf;
-  while (!file.Eof() && file.ReadLine(buf)) {
+  while (true) {
+    const char* eol = cur ? static_cast<const char*>(memchr(cur, '\n', file_end - cur)) : NULL;
+    if (eol == NULL) eol = file_end;
     linenum++;
 
+    const char* nul = cur ? static_cast<const char*>(memchr(cur, '\0', eol - cur)) : NULL;
+    int len = (int)(((nul) ? nul : eol) - cur);
+#if APTO_PLATFORM(WINDOWS)
+    if (len > 0 && cur[len - 1] == '\r') len--;
+#endif
+    cString buf(cur ? cur : "", len);
+
     if (buf.GetSize() && buf[0] == '#') {
       if (!processCommand(buf, lines, filename, linenum, working_dir, custom_directives, feedback)) return false;
     } else {
       lines.Push(new sLine(buf, filename, linenum));
     }
+
+    if (eol == file_end) break;
+    cur = eol + 1;
   }
-  file.Close();
   
   return true;
 }
@@ -220,15 +258,10 @@ void cInitFile::postProcess(tSmartArray<sLine*>& lines)
   const int num_lines = lines.GetSize();
 
   // PASS 1: Remove all comments -- everything after a '#' sign -- and
-  // compress all whitespace into a single space.
-  for (int i = 0; i < num_lines; i++) {
-    cString& cur_line = lines[i]->line;
-
-    // Remove all characters past a comment mark and reduce whitespace.
-    int comment_pos = cur_line.Find('#');
-    if (comment_pos >= 0) cur_line.Clip(comment_pos);
-    cur_line.CompressWhitespace();
-  }
+  // compress all whitespace into a single space.  Each line is independent,
+  // so large files (population saves, detail dumps) are split across threads.
+  sCleanLines clean(lines);
+  tParallelRange<sCleanLines>::Run(clean, num_lines, 16384);
 
   // PASS 2: Merge each line ending with a continue marker '\' with the
   // next line.
@@ -301,15 +334,46 @@ tDictionary<cString>* cInitFile::GetLineAsDict(int line_num)
 {
   tDictionary<cString>* dict = new tDictionary<cString>;
   
-  cStringList fmt = m_format;
-  cStringList line;
-  if (line_num >= 0 && line_num < m_lines.GetSize()) line.Load(m_lines[line_num]->line);  
+  tArray<cString> fields;
+  GetLineFields(line_num, fields);
   
-  while (fmt.GetSize() && line.GetSize()) dict->Set(fmt.Pop(), line.Pop());
+  tConstListIterator<cString> fmt_it(m_format.GetList());
+  for (int i = 0; i < fields.GetSize(); i++) dict->Set(*fmt_it.Next(), fields[i]);
   
   return dict;
 }
 
+void cInitFile::GetLineFields(int line_num, tArray<cString>& fields) const
+{
+  fields.Resize(0);
+  if (line_num < 0 || line_num >= m_lines.GetSize()) return;
+  
+  // Same word boundaries as cStringList::Load -- every space ends a word, and a non-empty tail is the last word
+  const cString& line = m_lines[line_num]->line;
+  const int num_cols = m_format.GetSize();
+  const int size = line.GetSize();
+  fields.Resize(num_cols);
+  int num_fields = 0;
+  int start = 0;
+  while (start < size && num_fields < num_cols) {
+    int stop = line.Find(' ', start);
+    if (stop < 0) stop = size;
+    fields[num_fields++] = line.Substring(start, stop - start);
+    start = stop + 1;
+  }
+  fields.Resize(num_fields);
+}
+
+int cInitFile::GetFormatColumn(const cString& name) const
+{
+  int col = -1;
+  tConstListIterator<cString> fmt_it(m_format.GetList());
+  for (int i = 0; fmt_it.Next() != NULL; i++) {
+    if (*fmt_it.Get() == name) col = i;
+  }
+  return col;
+}
+
 
 bool cInitFile::Find(cString& in_string, const cString& keyword, int col) const
 {
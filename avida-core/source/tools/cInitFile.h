@@ -91,6 +91,21 @@ public:
   
   tDictionary<cString>* GetLineAsDict(int line_num = 0);
   
+  /**
+   * Split a line into its columns, without building a dictionary.  Entry i holds
+   * the value for column i of the #format directive; like GetLineAsDict, the
+   * result stops at whichever runs out first, the columns or the words on the line.
+   * Lines are independent, so different lines may be split concurrently.
+   **/
+  void GetLineFields(int line_num, tArray<cString>& fields) const;
+  
+  /**
+   * Position of the named column in the #format directive, or -1 if it is not
+   * listed.  If a name is listed twice the later position is returned, matching
+   * the value GetLineAsDict would keep.
+   **/
+  int GetFormatColumn(const cString& name) const;
+  
 
   /**
    * Checks whether any line contains a given keyword in the specified 
@@ -151,6 +166,8 @@ private:
   bool processCommand(cString cmdstr, tSmartArray<sLine*>& lines, const cString& filename, int linenum,
                       const cString& working_dir, const Apto::Set<cString>* custom_directives, Feedback& feedback);
   void postProcess(tSmartArray<sLine*>& lines);
+  
+  struct sCleanLines;
 };
 
 #endif
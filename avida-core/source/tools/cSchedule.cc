@@ -22,7 +22,22 @@
 
 #include "cSchedule.h"
 
+#include "cMerit.h"
 
-cSchedule::cSchedule(int _item_count) : item_count(_item_count) { ; }
+
+cSchedule::cSchedule(int _item_count) : item_count(_item_count), m_item_merit(_item_count, 0.0), m_total_merit(0.0), m_num_merit(0) { ; }
 
 cSchedule::~cSchedule() { ; }
+
+void cSchedule::RecordMerit(int item_id, const cMerit& merit)
+{
+  const double value = merit.GetDouble();
+  const double old_value = m_item_merit[item_id];
+  if (old_value != 0.0) m_num_merit--;
+  if (value != 0.0) m_num_merit++;
+  m_item_merit[item_id] = value;
+  
+  // Once the schedule empties out, clear any rounding error accumulated by the incremental updates
+  if (m_num_merit == 0) m_total_merit = 0.0;
+  else m_total_merit += value - old_value;
+}
@@ -23,6 +23,10 @@
 #ifndef cSchedule_h
 #define cSchedule_h
 
+#ifndef tArray_h
+#include "tArray.h"
+#endif
+
 class cDeme;
 class cMerit;
 
@@ -35,6 +39,9 @@ class cSchedule
 {
 protected:
   int item_count;
+  tArray<double> m_item_merit;  // Merit most recently recorded for each item
+  double m_total_merit;         // Sum of m_item_merit, maintained incrementally
+  int m_num_merit;              // Number of items with a nonzero entry in m_item_merit
   
 
   cSchedule(); // @not_implemented
@@ -49,6 +56,10 @@ public:
   virtual void Adjust(int item_id, const cMerit& merit, int deme_id = 0) = 0;
   virtual int GetNextID() = 0;
   virtual double GetStatus(int id) { return 0.0; }
+  
+  // Record the merit given to an item alongside Adjust, so the schedule-wide total is available without a scan
+  void RecordMerit(int item_id, const cMerit& merit);
+  double GetTotalMerit() const { return m_total_merit; }
 };
 
 #endif
@@ -29,29 +29,23 @@ specified by a begin/end iterator pair.
 */
 
 #include "AvidaTools.h"
+#include "tConnectionList.h"
 
 using namespace AvidaTools;
 
 /*! Builds a torus topology out of the cells betwen the iterators.
 In a torus, each cell is connected to up to 8 neighbors (including diagonals), 
-and connections DO wrap around the logical edges of the torus.
+and connections DO wrap around the logical edges of the torus.  The neighbors
+are computed from each cell's position, so no edges are stored.
 */
 template< typename InputIterator >
 void build_torus(InputIterator begin, InputIterator end, unsigned int x_size, unsigned int y_size) {
-  // Get the offset from the start of this range.  This is used to modify the 
-  // parameters and return for GridNeighbor.
+  // Get the offset from the start of this range.  This is used to find the
+  // position of each cell within the torus.
   int offset = begin->GetID();
   
   for(InputIterator i=begin; i!=end; ++i) {
-    // The majority of all connections.
-    i->ConnectionList().Push(&begin[GridNeighbor(i->GetID()-offset, x_size, y_size, -1, -1)]);
-    i->ConnectionList().Push(&begin[GridNeighbor(i->GetID()-offset, x_size, y_size, 0, -1)]);
-    i->ConnectionList().Push(&begin[GridNeighbor(i->GetID()-offset, x_size, y_size, 1, -1)]);
-    i->ConnectionList().Push(&begin[GridNeighbor(i->GetID()-offset, x_size, y_size, 1, 0)]);
-    i->ConnectionList().Push(&begin[GridNeighbor(i->GetID()-offset, x_size, y_size, 1, 1)]);
-    i->ConnectionList().Push(&begin[GridNeighbor(i->GetID()-offset, x_size, y_size, 0, 1)]);
-    i->ConnectionList().Push(&begin[GridNeighbor(i->GetID()-offset, x_size, y_size, -1, 1)]);
-    i->ConnectionList().Push(&begin[GridNeighbor(i->GetID()-offset, x_size, y_size, -1, 0)]);
+    i->ConnectionList().SetLattice(CONNECTIONS_TORUS, &begin[0], i->GetID()-offset, x_size, y_size);
   }
 }
 
@@ -62,10 +56,18 @@ and connections do NOT wrap around the logical edges of the grid.
 */
 template< typename InputIterator >
 void build_grid(InputIterator begin, InputIterator end, unsigned int x_size, unsigned int y_size) {
-  // Start with a torus.
-  build_torus(begin, end, x_size, y_size);
   int offset = begin->GetID();
 
+  if (x_size >= 3 && y_size >= 3) {
+    for(InputIterator i=begin; i!=end; ++i) {
+      i->ConnectionList().SetLattice(CONNECTIONS_GRID, &begin[0], i->GetID()-offset, x_size, y_size);
+    }
+    return;
+  }
+  
+  // Grids this narrow wrap onto themselves; start with a torus...
+  build_torus(begin, end, x_size, y_size);
+
   // And now remove the connections that wrap around.
   for(InputIterator i=begin; i!=end; ++i) {
     int id = i->GetID();
@@ -101,12 +103,9 @@ In a clique, each cell is connected to all other cells in the given range.
 */
 template< typename InputIterator >
 void build_clique(InputIterator begin, InputIterator end, unsigned int x_size, unsigned int y_size) {
+  const int num_cells = end - begin;
   for(InputIterator i=begin; i!=end; ++i) {
-    for(InputIterator j=begin; j!=end; ++j) {
-      if(j!=i) {
-        i->ConnectionList().Push(j);
-      }
-    }
+    i->ConnectionList().SetClique(&begin[0], i - begin, num_cells);
   }
 }
 
@@ -117,9 +116,17 @@ edges.
 */
 template< typename InputIterator >
 void build_hex(InputIterator begin, InputIterator end, unsigned int x_size, unsigned int y_size) {
+  int offset = begin->GetID();  
+
+  if (x_size >= 3 && y_size >= 3) {
+    for(InputIterator i=begin; i!=end; ++i) {
+      i->ConnectionList().SetLattice(CONNECTIONS_HEX, &begin[0], i->GetID()-offset, x_size, y_size);
+    }
+    return;
+  }
+  
   // Start with a grid:
   build_grid(begin, end, x_size, y_size);
-  int offset = begin->GetID();  
   // ... and remove connections to the NE,SW:
   for(InputIterator i=begin; i!=end; ++i) {
     i->ConnectionList().Remove(&begin[GridNeighbor(i->GetID()-offset, x_size, y_size, 1, -1)]);
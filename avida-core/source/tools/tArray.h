@@ -168,6 +168,18 @@ public:
     m_data[idx2] = v;
   }
 
+  // Exchange contents with another array, without copying any elements
+  void Swap(tArray& other)
+  {
+    T* data = m_data;
+    m_data = other.m_data;
+    other.m_data = data;
+
+    const int size = m_size;
+    m_size = other.m_size;
+    other.m_size = size;
+  }
+
   void SetAll(const T& value)
   {
     for (int i = 0; i < m_size; i++) m_data[i] = value;
@@ -0,0 +1,243 @@
+/*
+ *  tConnectionList.h
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef tConnectionList_h
+#define tConnectionList_h
+
+#include "AvidaTools.h"
+
+#include <cassert>
+#include <vector>
+
+#ifndef NULL
+#define NULL 0
+#endif
+
+//! How a tConnectionList finds its neighbors
+enum eConnectionLayout {
+  CONNECTIONS_EXPLICIT = 0, // Stored array of neighbors
+  CONNECTIONS_TORUS,        // Computed: 8 neighbors, wrapping at the edges
+  CONNECTIONS_GRID,         // Computed: up to 8 neighbors, no wrapping
+  CONNECTIONS_HEX,          // Computed: grid without the NE and SW links
+  CONNECTIONS_CLIQUE        // Computed: every other cell in the range
+};
+
+
+/*! The connections from one cell to its neighbors.
+
+ Regular topologies (torus, grid, hex, clique) store no edges at all; the neighbors of a cell are computed from its
+ position within the range of cells the topology was built over.  Irregular topologies, and regular ones that have
+ been edited at runtime, keep a contiguous array of neighbor pointers.  Either way the list is circular and the
+ faced neighbor is held as an index into it, so rotating is O(1).
+
+ The interface mirrors the parts of tList that cells have always used: GetFirst() is the faced neighbor, GetPos(i)
+ counts from it, CircNext()/CircPrev() turn, Push() inserts in front of the faced neighbor and Remove() takes out the
+ first match searching from it.  Implicit layouts enumerate their neighbors in the same order the old list-building
+ code produced, so facings and neighbor indices are unchanged.
+ */
+template <class T> class tConnectionList
+{
+private:
+  eConnectionLayout m_layout;
+  T* m_base;                 // First cell of the range the implicit layout was built over
+  int m_pos;                 // Position of the owning cell within that range
+  int m_x_size;
+  int m_y_size;              // (for a clique, the number of cells in the range)
+  unsigned char m_dir_mask;  // Directions present in a torus, grid or hex layout, in canonical order
+  int m_size;
+  int m_facing;              // Index of the faced neighbor
+  std::vector<T*> m_edges;   // Neighbors of an explicit layout
+
+  unsigned int m_edit_count; // Bumped whenever this list gains or loses connections
+
+  // Canonical neighbor order of the lattice layouts: W, SW, S, SE, E, NE, N, NW
+  static int DirX(int dir) { static const int dx[8] = { -1, -1, 0, 1, 1, 1, 0, -1 }; return dx[dir]; }
+  static int DirY(int dir) { static const int dy[8] = { 0, 1, 1, 1, 0, -1, -1, -1 }; return dy[dir]; }
+
+  T* GetDir(int dir) const
+  {
+    return m_base + AvidaTools::GridNeighbor(m_pos, m_x_size, m_y_size, DirX(dir), DirY(dir));
+  }
+
+  // Neighbor at index idx of the list, before accounting for facing
+  T* Get(int idx) const
+  {
+    assert(idx >= 0 && idx < m_size);
+    switch (m_layout) {
+      case CONNECTIONS_EXPLICIT:
+        return m_edges[idx];
+      case CONNECTIONS_CLIQUE:
+        // Every other cell in the range, highest position first
+        return m_base + ((idx < m_y_size - 1 - m_pos) ? (m_y_size - 1 - idx) : (m_y_size - 2 - idx));
+      default:
+        for (int dir = 0; dir < 8; dir++) {
+          if ((m_dir_mask & (1 << dir)) && idx-- == 0) return GetDir(dir);
+        }
+    }
+    assert(false);
+    return NULL;
+  }
+
+  // Convert an implicit layout into an explicit one holding the same neighbors in the same order
+  void Materialize()
+  {
+    if (m_layout == CONNECTIONS_EXPLICIT) return;
+    std::vector<T*> edges(m_size);
+    for (int i = 0; i < m_size; i++) edges[i] = Get(i);
+    m_edges.swap(edges);
+    m_layout = CONNECTIONS_EXPLICIT;
+  }
+
+  // Index of the first occurrence of cell searching forward from the faced neighbor, or -1
+  int Find(const T* cell) const
+  {
+    if (m_layout == CONNECTIONS_CLIQUE) {
+      const int pos = (int)(cell - m_base);
+      if (pos < 0 || pos >= m_y_size || pos == m_pos) return -1;
+      return (pos > m_pos) ? (m_y_size - 1 - pos) : (m_y_size - 2 - pos);
+    }
+    for (int i = 0; i < m_size; i++) {
+      const int idx = (m_facing + i) % m_size;
+      if (Get(idx) == cell) return idx;
+    }
+    return -1;
+  }
+
+public:
+  tConnectionList() : m_layout(CONNECTIONS_EXPLICIT), m_base(NULL), m_pos(0), m_x_size(0), m_y_size(0), m_dir_mask(0), m_size(0), m_facing(0), m_edit_count(0) { ; }
+
+  //! Take on the connections of another list; this counts as an edit of this list.
+  tConnectionList& operator=(const tConnectionList& in_list)
+  {
+    if (this == &in_list) return *this;
+    m_layout = in_list.m_layout;
+    m_base = in_list.m_base;
+    m_pos = in_list.m_pos;
+    m_x_size = in_list.m_x_size;
+    m_y_size = in_list.m_y_size;
+    m_dir_mask = in_list.m_dir_mask;
+    m_size = in_list.m_size;
+    m_facing = in_list.m_facing;
+    m_edges = in_list.m_edges;
+    m_edit_count++;
+    return *this;
+  }
+
+  //! Connect to every in-bounds neighbor in a torus, grid or hex layout of x_size by y_size cells.
+  void SetLattice(eConnectionLayout layout, T* base, int pos, int x_size, int y_size)
+  {
+    assert(layout == CONNECTIONS_TORUS || layout == CONNECTIONS_GRID || layout == CONNECTIONS_HEX);
+    m_layout = layout;
+    m_base = base;
+    m_pos = pos;
+    m_x_size = x_size;
+    m_y_size = y_size;
+    m_edges.clear();
+
+    const int x = pos % x_size;
+    const int y = pos / x_size;
+    m_dir_mask = 0;
+    m_size = 0;
+    for (int dir = 0; dir < 8; dir++) {
+      if (layout != CONNECTIONS_TORUS) {
+        const int nx = x + DirX(dir);
+        const int ny = y + DirY(dir);
+        if (nx < 0 || nx >= x_size || ny < 0 || ny >= y_size) continue;
+        if (layout == CONNECTIONS_HEX && DirX(dir) == -DirY(dir) && DirX(dir) != 0) continue;  // no NE or SW links
+      }
+      m_dir_mask |= (1 << dir);
+      m_size++;
+    }
+    m_facing = 0;
+    m_edit_count++;
+  }
+
+  //! Connect to every other cell among the num_cells starting at base.
+  void SetClique(T* base, int pos, int num_cells)
+  {
+    m_layout = CONNECTIONS_CLIQUE;
+    m_base = base;
+    m_pos = pos;
+    m_x_size = num_cells;
+    m_y_size = num_cells;
+    m_dir_mask = 0;
+    m_edges.clear();
+    m_size = num_cells - 1;
+    m_facing = 0;
+    m_edit_count++;
+  }
+
+  //! Number of connection changes made to this list; anything cached from the topology compares against it.
+  unsigned int GetEditCount() const { return m_edit_count; }
+
+  eConnectionLayout GetLayout() const { return m_layout; }
+  inline int GetSize() const { return m_size; }
+
+  inline T* GetFirst() const { return (m_size > 0) ? Get(m_facing) : NULL; }
+  inline T* GetPos(int pos) const { return (pos < m_size) ? Get((m_facing + pos) % m_size) : NULL; }
+  T* FindPtr(T* cell) const { return (Find(cell) >= 0) ? cell : NULL; }
+
+  inline int GetFacing() const { return m_facing; }
+  inline void CircNext() { if (m_size > 0) m_facing = (m_facing + 1) % m_size; }
+  inline void CircPrev() { if (m_size > 0) m_facing = (m_facing + m_size - 1) % m_size; }
+
+  //! Turn to face the given neighbor; returns false if it is not connected.
+  bool Face(const T* cell)
+  {
+    const int idx = Find(cell);
+    if (idx < 0) return false;
+    m_facing = idx;
+    return true;
+  }
+
+  //! Add a connection in front of the faced neighbor (it becomes the faced neighbor).
+  void Push(T* cell)
+  {
+    Materialize();
+    m_edges.insert(m_edges.begin() + m_facing, cell);
+    m_size++;
+    m_edit_count++;
+  }
+
+  //! Add a connection behind all the others (just before the faced neighbor, going around).
+  void PushRear(T* cell)
+  {
+    Materialize();
+    m_edges.insert(m_edges.begin() + m_facing, cell);
+    if (m_size++ > 0) m_facing++;
+    m_edit_count++;
+  }
+
+  //! Remove the first connection to the given cell, searching forward from the faced neighbor.
+  T* Remove(T* cell)
+  {
+    const int idx = Find(cell);
+    if (idx < 0) return NULL;
+    Materialize();
+    m_edges.erase(m_edges.begin() + idx);
+    m_size--;
+    if (idx < m_facing) m_facing--;
+    if (m_facing >= m_size) m_facing = 0;
+    m_edit_count++;
+    return cell;
+  }
+};
+
+#endif
@@ -64,6 +64,55 @@ public:
   virtual bool Set(TargetType* target, const cFlexVar&, const cStringList&, const cString&) const { return false; }
   virtual cFlexVar Get(const TargetType* target, const cFlexVar& idx, const cStringList& args) const = 0;
   virtual cFlexVar Get(const TargetType* target) const { return Get(target, 0, m_default_args); }
+  
+  //! Fill values with the stat of each target, if it is a plain number (int, bool or double); otherwise return false.
+  virtual bool GetNumbers(const TargetType* const* targets, int count, double* values, cFlexVar::eFlexType& type) const
+  {
+    return false;
+  }
+};
+
+
+// Column-at-a-time retrieval for tDataEntryOfType; only stats stored as plain numbers are supported
+template <class TargetType, class EntryType> struct tDataEntryNumbers
+{
+  static bool Get(EntryType (TargetType::*)() const, const TargetType* const*, int, double*, cFlexVar::eFlexType&)
+  {
+    return false;
+  }
+};
+
+template <class TargetType> struct tDataEntryNumbers<TargetType, int>
+{
+  static bool Get(int (TargetType::*fun)() const, const TargetType* const* targets, int count, double* values,
+                  cFlexVar::eFlexType& type)
+  {
+    for (int i = 0; i < count; i++) values[i] = (targets[i]->*fun)();
+    type = cFlexVar::TYPE_INT;
+    return true;
+  }
+};
+
+template <class TargetType> struct tDataEntryNumbers<TargetType, bool>
+{
+  static bool Get(bool (TargetType::*fun)() const, const TargetType* const* targets, int count, double* values,
+                  cFlexVar::eFlexType& type)
+  {
+    for (int i = 0; i < count; i++) values[i] = (targets[i]->*fun)() ? 1 : 0;
+    type = cFlexVar::TYPE_INT;  // cFlexVar holds bools as ints
+    return true;
+  }
+};
+
+template <class TargetType> struct tDataEntryNumbers<TargetType, double>
+{
+  static bool Get(double (TargetType::*fun)() const, const TargetType* const* targets, int count, double* values,
+                  cFlexVar::eFlexType& type)
+  {
+    for (int i = 0; i < count; i++) values[i] = (targets[i]->*fun)();
+    type = cFlexVar::TYPE_DOUBLE;
+    return true;
+  }
 };
 
 template <class TargetType, class EntryType> class tDataEntryOfType;
@@ -95,6 +144,11 @@ public:
     assert(target != NULL);
     return cFlexVar((target->*DataGet)());
   }
+  
+  bool GetNumbers(const TargetType* const* targets, int count, double* values, cFlexVar::eFlexType& type) const
+  {
+    return tDataEntryNumbers<TargetType, EntryType>::Get(DataGet, targets, count, values, type);
+  }
 };
 
 
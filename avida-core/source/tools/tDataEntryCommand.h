@@ -61,6 +61,10 @@ public:
   
   bool SetValue(T* target, const cString& value) const { return m_data_entry->Set(target, m_idx, m_args, value); }
   cFlexVar GetValue(const T* target) const { return m_data_entry->Get(target, m_idx, m_args); }
+  bool GetNumbers(const T* const* targets, int count, double* values, cFlexVar::eFlexType& type) const
+  {
+    return m_data_entry->GetNumbers(targets, count, values, type);
+  }
 };
 
 #endif
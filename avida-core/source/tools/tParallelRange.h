@@ -0,0 +1,81 @@
+/*
+ *  tParallelRange.h
+ *  Avida
+ *
+ *  Copyright 1999-2011 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef tParallelRange_h
+#define tParallelRange_h
+
+#include "apto/core/Thread.h"
+#include "apto/platform.h"
+
+#include <vector>
+
+
+/*! Runs fn(begin, end) over contiguous slices of [0, count), one slice per available CPU.
+
+ The calling thread works on the last slice itself and returns once every slice is done.  Slices are never smaller
+ than min_range items, so small inputs run inline without starting any threads.  fn must be safe to call
+ concurrently on disjoint slices; in particular it should not copy cStrings (or other reference counted objects)
+ that are shared between slices, since their reference counts are not atomic.
+ */
+template <class Fn> class tParallelRange
+{
+private:
+  class cWorker : public Apto::Thread
+  {
+  private:
+    Fn& m_fn;
+    int m_begin;
+    int m_end;
+
+    void Run() { m_fn(m_begin, m_end); }
+
+  public:
+    cWorker(Fn& fn, int begin, int end) : m_fn(fn), m_begin(begin), m_end(end) { ; }
+  };
+
+public:
+  static void Run(Fn& fn, int count, int min_range, int max_threads = 0)
+  {
+    if (count <= 0) return;
+
+    int num_slices = Apto::Platform::AvailableCPUs();
+    if (max_threads > 0 && max_threads < num_slices) num_slices = max_threads;
+    if (min_range > 0 && count / min_range < num_slices) num_slices = count / min_range;
+    if (num_slices <= 1) {
+      fn(0, count);
+      return;
+    }
+
+    std::vector<cWorker*> workers(num_slices - 1);
+    const int slice_size = count / num_slices;
+    for (int i = 0; i < num_slices - 1; i++) {
+      workers[i] = new cWorker(fn, i * slice_size, (i + 1) * slice_size);
+      if (!workers[i]->Start()) fn(i * slice_size, (i + 1) * slice_size);  // no thread to be had, do it here
+    }
+    fn((num_slices - 1) * slice_size, count);
+
+    for (int i = 0; i < num_slices - 1; i++) {
+      workers[i]->Join();
+      delete workers[i];
+    }
+  }
+};
+
+#endif
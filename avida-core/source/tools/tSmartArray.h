@@ -168,6 +168,26 @@ public:
     m_data[idx1] = m_data[idx2];
     m_data[idx2] = v;
   }  
+
+  // Exchange contents (including reserve settings) with another array, without copying any elements
+  void Swap(tSmartArray& other)
+  {
+    T* data = m_data;
+    m_data = other.m_data;
+    other.m_data = data;
+
+    int tmp = m_size;
+    m_size = other.m_size;
+    other.m_size = tmp;
+
+    tmp = m_active;
+    m_active = other.m_active;
+    other.m_active = tmp;
+
+    tmp = m_reserve;
+    m_reserve = other.m_reserve;
+    other.m_reserve = tmp;
+  }
   
   
   void SetAll(const T& value)
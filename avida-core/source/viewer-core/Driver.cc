@@ -39,11 +39,32 @@
 #include "cUserFeedback.h"
 #include "cWorld.h"
 
+#include "avida/private/viewer-core/ClassificationInfo.h"
+#include "avida/private/viewer-core/PopulationSnapshot.h"
+
 #include <iostream>
 
 
+// Drives the map and listeners from the snapshots handed over by the simulation thread
+class Avida::CoreView::Driver::SnapshotConsumer : public Apto::Thread
+{
+private:
+  Driver* m_driver;
+  
+public:
+  SnapshotConsumer(Driver* driver) : m_driver(driver) { ; }
+  
+protected:
+  void Run() { m_driver->consumeSnapshot(); }
+};
+
+
 Avida::CoreView::Driver::Driver(cWorld* world)
 : Apto::Thread(), m_world(world), m_pause_state(DRIVER_UNPAUSED), m_done(false), m_paused(false), m_map(NULL)
+, m_genotype_info(new ClassificationInfo(world, "genotype", PopulationSnapshot::NUM_GENOTYPE_COLORS))
+, m_snapshot_back(new PopulationSnapshot), m_snapshot_ready(new PopulationSnapshot)
+, m_snapshot_front(new PopulationSnapshot), m_snapshot_pending(false), m_snapshot_done(false), m_num_listeners(0)
+, m_consumer(NULL)
 {
   GlobalObjectManager::Register(this);
 }
@@ -56,7 +77,13 @@ Avida::CoreView::Driver::~Driver()
   m_pause_cv.Broadcast();
   Join();
   
+  stopConsumer();
+  
   delete m_map;
+  delete m_snapshot_back;
+  delete m_snapshot_ready;
+  delete m_snapshot_front;
+  delete m_genotype_info;
   
   GlobalObjectManager::Unregister(this);
   delete m_world;
@@ -113,6 +140,14 @@ void Avida::CoreView::Driver::Run()
   
   cAvidaContext ctx(m_world, m_world->GetRandom());
   
+#if APTO_PLATFORM(THREADS)
+  m_consumer = new SnapshotConsumer(this);
+  if (!m_consumer->Start()) {
+    delete m_consumer;
+    m_consumer = NULL;
+  }
+#endif
+  
   m_mutex.Lock();
   while (!m_done) {
     m_mutex.Unlock();
@@ -148,7 +183,8 @@ void Avida::CoreView::Driver::Run()
 //      }
 //    }
 //    else {
-      for (int i = 0; i < UD_size; i++) population.ProcessStep(ctx, step_size, population.ScheduleOrganism());
+      if (population.UsesDemePartitions()) population.ProcessDemePartitions(ctx, UD_size);
+      else for (int i = 0; i < UD_size; i++) population.ProcessStep(ctx, step_size, population.ScheduleOrganism());
 //    }
     
     
@@ -156,13 +192,7 @@ void Avida::CoreView::Driver::Run()
     population.ProcessPostUpdate(ctx);
     
     
-    if (m_map) m_map->UpdateMaps(population);
-    for (Apto::Set<Listener*>::Iterator it = m_listeners.Begin(); it.Next();) {
-      if ((*it.Get())->WantsMap()) {
-        (*it.Get())->NotifyMap(m_map);
-      }
-      if ((*it.Get())->WantsUpdate()) (*it.Get())->NotifyUpdate(stats.GetUpdate());
-    }
+    publishSnapshot();
     
     
     // Do Point Mutations
@@ -184,6 +214,76 @@ void Avida::CoreView::Driver::Run()
     m_paused = false;
   }  
   m_mutex.Unlock();
+  
+  stopConsumer();
+}
+
+
+void Avida::CoreView::Driver::publishSnapshot()
+{
+  m_snapshot_mutex.Lock();
+  const bool wanted = (m_num_listeners > 0);
+  m_snapshot_mutex.Unlock();
+  if (!wanted) return;
+  
+  m_snapshot_back->Capture(m_world, m_genotype_info);
+  
+  m_snapshot_mutex.Lock();
+  PopulationSnapshot* captured = m_snapshot_back;
+  m_snapshot_back = m_snapshot_ready;
+  m_snapshot_ready = captured;
+  m_snapshot_pending = true;
+  m_snapshot_mutex.Unlock();
+  
+  if (m_consumer) m_snapshot_cv.Signal();
+  else consumeSnapshot();
+}
+
+
+void Avida::CoreView::Driver::consumeSnapshot()
+{
+  // Running on the consumer thread this loops until stopped; consuming inline it handles what is pending and returns
+  m_snapshot_mutex.Lock();
+  while (true) {
+    while (m_consumer && !m_snapshot_pending && !m_snapshot_done) m_snapshot_cv.Wait(m_snapshot_mutex);
+    if (!m_snapshot_pending) break;
+    
+    PopulationSnapshot* snapshot = m_snapshot_ready;
+    m_snapshot_ready = m_snapshot_front;
+    m_snapshot_front = snapshot;
+    m_snapshot_pending = false;
+    m_snapshot_mutex.Unlock();
+    
+    m_listener_mutex.Lock();
+    if (m_map) m_map->UpdateMaps(*snapshot);
+    for (Apto::Set<Listener*>::Iterator it = m_listeners.Begin(); it.Next();) {
+      if ((*it.Get())->WantsMap()) {
+        (*it.Get())->NotifyMap(m_map);
+      }
+      if ((*it.Get())->WantsUpdate()) (*it.Get())->NotifyUpdate(snapshot->GetUpdate());
+    }
+    m_listener_mutex.Unlock();
+    
+    m_snapshot_mutex.Lock();
+    if (!m_consumer) break;
+  }
+  m_snapshot_mutex.Unlock();
+}
+
+
+void Avida::CoreView::Driver::stopConsumer()
+{
+  if (!m_consumer) return;
+  
+  // The consumer drains any snapshot still pending before it exits
+  m_snapshot_mutex.Lock();
+  m_snapshot_done = true;
+  m_snapshot_mutex.Unlock();
+  m_snapshot_cv.Broadcast();
+  m_consumer->Join();
+  
+  delete m_consumer;
+  m_consumer = NULL;
 }
 
 
@@ -211,9 +311,27 @@ void Avida::CoreView::Driver::NotifyWarning(const cString& in_string)
 
 void Avida::CoreView::Driver::AttachListener(Listener* listener)
 {
+  m_listener_mutex.Lock();
   m_listeners.Insert(listener);
-  
   if (listener->WantsMap() && !m_map) m_map = new Map(m_world);
+  const int num_listeners = m_listeners.GetSize();
+  m_listener_mutex.Unlock();
+  
+  m_snapshot_mutex.Lock();
+  m_num_listeners = num_listeners;
+  m_snapshot_mutex.Unlock();
+}
+
+void Avida::CoreView::Driver::DetachListener(Listener* listener)
+{
+  m_listener_mutex.Lock();
+  m_listeners.Remove(listener);
+  const int num_listeners = m_listeners.GetSize();
+  m_listener_mutex.Unlock();
+  
+  m_snapshot_mutex.Lock();
+  m_num_listeners = num_listeners;
+  m_snapshot_mutex.Unlock();
 }
 
 void Avida::CoreView::Driver::AttachRecorder(Data::RecorderPtr recorder)
@@ -27,12 +27,15 @@
 #include "cBioGroup.h"
 #include "cEnvironment.h"
 #include "cOrganism.h"
+#include "cPhenotype.h"
 #include "cPopulation.h"
 #include "cPopulationCell.h"
+#include "cStats.h"
 #include "cStringUtil.h"
 #include "cWorld.h"
 
 #include "avida/private/viewer-core/ClassificationInfo.h"
+#include "avida/private/viewer-core/PopulationSnapshot.h"
 
 #include <cmath>
 #include <iostream>
@@ -42,6 +45,49 @@ Avida::CoreView::MapMode::~MapMode() { ; }
 Avida::CoreView::DiscreteScale::~DiscreteScale() { ; }
 
 
+void Avida::CoreView::PopulationSnapshot::Capture(cWorld* world, ClassificationInfo* genotype_info)
+{
+  if (genotype_info) genotype_info->Update();
+
+  cPopulation& pop = world->GetPopulation();
+  const int num_cells = pop.GetSize();
+  m_update = world->GetStats().GetUpdate();
+  m_num_tasks = world->GetEnvironment().GetNumTasks();
+  m_task_words = (m_num_tasks + 31) / 32;
+  m_genotype_id.Resize(num_cells);
+  m_genotype_color.Resize(num_cells);
+  m_fitness.Resize(num_cells);
+  m_merit.Resize(num_cells);
+  m_tasks.Resize(num_cells * m_task_words);
+
+  for (int i = 0; i < num_cells; i++) {
+    unsigned int* tasks = &m_tasks[i * m_task_words];
+    for (int w = 0; w < m_task_words; w++) tasks[w] = 0;
+
+    cOrganism* org = pop.GetCell(i).GetOrganism();
+    if (org == NULL) {
+      m_genotype_id[i] = -1;
+      m_genotype_color[i] = -1;
+      m_fitness[i] = 0.0;
+      m_merit[i] = 0.0;
+      continue;
+    }
+
+    cBioGroup* genotype = org->GetBioGroup("genotype");
+    m_genotype_id[i] = genotype->GetID();
+    ClassificationInfo::MapColor* mapcolor = genotype_info ? genotype->GetData<ClassificationInfo::MapColor>() : NULL;
+    m_genotype_color[i] = mapcolor ? mapcolor->color : -1;
+
+    const cPhenotype& phenotype = org->GetPhenotype();
+    m_fitness[i] = phenotype.GetFitness();
+    m_merit[i] = phenotype.GetMerit().GetDouble();
+
+    const tArray<int>& task_count = phenotype.GetLastTaskCount();
+    for (int t = 0; t < m_num_tasks; t++) if (task_count[t] > 0) tasks[t / 32] |= (1u << (t % 32));
+  }
+}
+
+
 class cFitnessMapMode : public Avida::CoreView::MapMode, public Avida::CoreView::DiscreteScale
 {
 private:
@@ -80,7 +126,7 @@ public:
   int GetSupportedTypes() const { return Avida::CoreView::MAP_GRID_VIEW_COLOR; }
 
 
-  void Update(cPopulation& pop);
+  void Update(const Avida::CoreView::PopulationSnapshot& snapshot);
   
   
   // DiscreteScale Interface
@@ -92,9 +138,9 @@ public:
 const double cFitnessMapMode::RESCALE_TOLERANCE = 0.1;
 const double cFitnessMapMode::MAX_RESCALE_FACTOR = 0.03;
 
-void cFitnessMapMode::Update(cPopulation& pop)
+void cFitnessMapMode::Update(const Avida::CoreView::PopulationSnapshot& snapshot)
 {
-  m_color_grid.Resize(pop.GetSize());
+  m_color_grid.Resize(snapshot.GetSize());
   
   // Keep track of how many times each color was assigned.
   m_color_count.SetAll(0);
@@ -103,10 +149,9 @@ void cFitnessMapMode::Update(cPopulation& pop)
   double max_fit = 0.0;
   double min_fit = 0.0;
   
-  for (int i = 0; i < pop.GetSize(); i++) {
-    cOrganism* org = pop.GetCell(i).GetOrganism();
-    if (org == NULL) continue;
-    double fit = org->GetPhenotype().GetFitness();
+  for (int i = 0; i < snapshot.GetSize(); i++) {
+    if (!snapshot.IsOccupied(i)) continue;
+    double fit = snapshot.GetFitness(i);
     if (fit == 0.0) continue;
 //    fit = log2(fit);
     if (fit > max_fit) max_fit = fit;
@@ -155,15 +200,14 @@ void cFitnessMapMode::Update(cPopulation& pop)
   }
   
   // Now fill out the color grid.
-  for (int i = 0; i < pop.GetSize(); i++) {
-    cOrganism* org = pop.GetCell(i).GetOrganism();
-    if (org == NULL) {
+  for (int i = 0; i < snapshot.GetSize(); i++) {
+    if (!snapshot.IsOccupied(i)) {
       m_color_grid[i] = Avida::CoreView::MAP_RESERVED_COLOR_BLACK;
       m_color_count[Avida::CoreView::MAP_RESERVED_COLORS - Avida::CoreView::MAP_RESERVED_COLOR_BLACK]++;
       continue;
     }
 
-    double fit = org->GetPhenotype().GetFitness();
+    double fit = snapshot.GetFitness(i);
     if (fit == 0.0) {
       m_color_grid[i] = Avida::CoreView::MAP_RESERVED_COLOR_DARK_GRAY;
       m_color_count[Avida::CoreView::MAP_RESERVED_COLORS - Avida::CoreView::MAP_RESERVED_COLOR_DARK_GRAY]++;
@@ -199,19 +243,15 @@ const Apto::String& cFitnessMapMode::GetScaleLabel() const
 class cGenotypeMapMode : public Avida::CoreView::MapMode, public Avida::CoreView::DiscreteScale
 {
 private:
-  static const int NUM_COLORS = 10;
+  static const int NUM_COLORS = Avida::CoreView::PopulationSnapshot::NUM_GENOTYPE_COLORS;
 private:
-  Avida::CoreView::ClassificationInfo* m_info;
   Apto::Array<int> m_color_grid;
   Apto::Array<int> m_color_count;
   Apto::Array<DiscreteScale::Entry> m_scale_labels;
   
 public:
-  cGenotypeMapMode(cWorld* world)
-    : m_info(new Avida::CoreView::ClassificationInfo(world, "genotype", NUM_COLORS))
-    , m_color_count(NUM_COLORS + Avida::CoreView::MAP_RESERVED_COLORS)
-  { ; }
-  virtual ~cGenotypeMapMode() { delete m_info; }
+  cGenotypeMapMode(cWorld* world) : m_color_count(NUM_COLORS + Avida::CoreView::MAP_RESERVED_COLORS) { ; }
+  virtual ~cGenotypeMapMode() { ; }
   
   // MapMode Interface
   const Apto::String& GetName() const { static const Apto::String name("Genotypes"); return name; }
@@ -223,7 +263,7 @@ public:
   
   int GetSupportedTypes() const { return Avida::CoreView::MAP_GRID_VIEW_COLOR; }
   
-  void Update(cPopulation& pop);
+  void Update(const Avida::CoreView::PopulationSnapshot& snapshot);
   
   
   // DiscreteScale Interface
@@ -233,26 +273,21 @@ public:
 };
 
 
-void cGenotypeMapMode::Update(cPopulation& pop)
+void cGenotypeMapMode::Update(const Avida::CoreView::PopulationSnapshot& snapshot)
 {
-  m_info->Update();
-  m_color_grid.Resize(pop.GetSize());
+  // Colors were assigned by the snapshot's ClassificationInfo when it was captured
+  m_color_grid.Resize(snapshot.GetSize());
   m_color_count.SetAll(0);            // reset all color counts
-  for (int i = 0; i < pop.GetSize(); i++) {
-    cOrganism* org = pop.GetCell(i).GetOrganism();
-    if (org == NULL) {
+  for (int i = 0; i < snapshot.GetSize(); i++) {
+    if (!snapshot.IsOccupied(i)) {
       m_color_grid[i] = -4;
       m_color_count[0]++;
+    } else if (snapshot.GetGenotypeColor(i) >= 0) {
+      m_color_grid[i] = snapshot.GetGenotypeColor(i);
+      m_color_count[snapshot.GetGenotypeColor(i) + 4]++;
     } else {
-      Avida::CoreView::ClassificationInfo::MapColor* mapcolor =
-      org->GetBioGroup("genotype")->GetData<Avida::CoreView::ClassificationInfo::MapColor>();
-      if (mapcolor) {
-        m_color_grid[i] = mapcolor->color;
-        m_color_count[mapcolor->color + 4];
-      } else {
-        m_color_grid[i] = -1;
-        m_color_count[3]++;
-      }
+      m_color_grid[i] = -1;
+      m_color_count[3]++;
     }
   }
 }
@@ -299,11 +334,11 @@ Avida::CoreView::Map::~Map()
 
 
 
-void Avida::CoreView::Map::UpdateMaps(cPopulation& pop)
+void Avida::CoreView::Map::UpdateMaps(const PopulationSnapshot& snapshot)
 {
   m_rw_lock.WriteLock();
   
-  for (int i = 0; i < m_view_modes.GetSize(); i++) m_view_modes[i]->Update(pop);
+  for (int i = 0; i < m_view_modes.GetSize(); i++) m_view_modes[i]->Update(snapshot);
   
   m_rw_lock.WriteUnlock();
 }
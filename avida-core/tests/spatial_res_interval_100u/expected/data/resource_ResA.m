@@ -0,0 +1,132 @@
+ResA0000000 = [ ...
+0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 
+0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 
+0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 
+0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 
+0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 
+0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 
+0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 
+0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 
+0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 
+0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 0.2 
+];
+ResA0000010 = [ ...
+0.5 0.5 0.864981 0 0.864981 0.5 0.5 0 0.5 0.5 
+0 0.5 0.5 0.5 0 0.5 0.5 0.5 0.5 0 
+0.5 0.5 0.5 0.5 0.5 0.5 0.5 0.5 0.5 0.5 
+0.5 0.5 0.5 0.5 0.5 0.5 0.5 0.5 0.5 0 
+0.5 0.5 0.5 0.5 0.5 0.5 0.5 0.5 0.5 0.5 
+0 0.5 0.5 0 0 0.5 0.5 0.5 0.5 0.5 
+0.5 0.5 0.5 0.5 0 0 0.5 0.5 0.5 0.5 
+0.5 0 0.5 0.5 0.5 0.5 0.5 0.5 0.5 0.5 
+0.5 0.5 0 0.5 0.5 0.5 0.5 0.5 0.5 0.5 
+0.5 0.5 0.5 0.5 0.5 0.5 0.5 0.5 0.5 0.5 
+];
+ResA0000020 = [ ...
+0.795245 0.5 1.09685 0.795245 0.5 0 0.795245 0.5 0 0.5 
+0.5 0.5 0.5 0.795245 0.5 0.5 0.5 0.5 0.5 0 
+0.5 0.5 0.5 0 0.5 0.5 0.795245 0.5 0.795245 0.5 
+0.5 0.5 0.5 0.5 0 0 0.5 0.5 0.795245 0.5 
+0.5 0 0 0.5 0 0.5 0.5 0 0 0 
+0.5 0 0.5 0.5 0.5 0.5 0.5 0.5 0.5 0 
+0.795245 0.969584 0.5 0.5 0.5 0.5 0.5 0.795245 0.5 0.795245 
+0.5 0.5 0.5 0.5 0.795245 0.795245 0.5 0.5 0.5 0.5 
+0.5 0.5 0.5 0.795245 0.5 0.5 0.5 0.5 0.5 0.5 
+0.5 0.795245 0.795245 0.969584 0.969584 0.5 0.5 0.795245 0.5 0.5 
+];
+ResA0000030 = [ ...
+0.0725298 0.795245 1.17769 1.07253 0.5 0.5 0 0 0.5 0.5 
+0 0.5 0.5 1.07253 0.969584 0.795245 0.5 0 0 0.5 
+0.5 0.5 0.795245 0 0.5 0.5 1.07253 0.5 0 0.5 
+0.5 0.5 0.5 0.5 0.5 0.5 0.5 0.5 0 0.5 
+0.5 0 0 0.5 0.5 0.5 0.5 0 0.5 0.5 
+0 0 0 0.969584 0 0.5 0.5 0.5 0.5 0.795245 
+1.07253 0.5 0 0 0 0 0 0 0.5 1.07253 
+0.969584 0 0.5 0.5 0 1.07253 0.5 0 0 0 
+0.795245 0 0.5 0.5 0.5 0.969584 0.5 0 0.5 0 
+0.5 0 0.5 0.795245 0.5 0.5 0.5 0 0.5 0.795245 
+];
+ResA0000040 = [ ...
+0.5 0.5 0.615391 0.578723 0.969584 0.5 0.5 0.5 0.5 0 
+0.5 0.969584 0.5 1.16921 1.13332 1.07253 0.5 0.5 0.5 0 
+0.795245 0.795245 0.5 0.5 0.5 0.5 0.578723 0.5 0.795245 0.5 
+0.969584 0.969584 0.5 0.5 0.795245 0.5 0.5 0.5 0.5 0.795245 
+0.5 0.5 0.5 0 0.5 0.5 0.5 0 0.5 0.5 
+0.5 0.5 0 0.5 0.5 0.5 0.5 0 0.5 0.5 
+1.16921 0.5 0.795245 0.795245 0.5 0.5 0.5 0.5 0.5 0.5 
+0.542828 0.5 0.5 0.969584 0.5 1.16921 0.969584 0 0.5 0.795245 
+0.5 0.5 0.795245 0.795245 0.5 0.795245 0.795245 0.5 0 0.5 
+0.5 0.5 0 0.795245 0.969584 0.795245 0.5 0.795245 0.795245 0.5 
+];
+ResA0000050 = [ ...
+0.5 0.5 0.5 0 0.542828 0.795245 0.5 0.5 0.5 0.5 
+0.5 0.5 0.5 0.5 0.599919 1.16921 0.969584 0.795245 0.5 0.5 
+0.5 0.5 0.5 0.5 0.5 0.5 0.5 0.5 1.07253 0 
+0 0.5 0 0 0 0.5 0.5 0.5 0.5 0 
+0.5 0.795245 0 0 0.5 0.5 0.5 0.5 0 0 
+0 0 0.795245 0.5 0.5 0.5 0 0 0.5 0 
+1.20292 0.5 0.5 0.5 0.5 0.795245 0.5 0.5 0 0.5 
+0.5 0.5 0.5 0.5 0.5 1.20292 0.5 0.5 0.969584 0.795245 
+0.5 0.969584 1.07253 0.5 0.5 1.07253 0 0.5 0.5 0.5 
+0.5 0.795245 0.5 0.5 0 0 0.795245 1.07253 0.5 0.5 
+];
+ResA0000060 = [ ...
+0.5 0 0.5 0.5 0.795245 1.07253 0.5 0 0.795245 0.5 
+0.5 0 0 0.5 1.00442 1.20292 1.13332 1.07253 0.795245 0.5 
+0.969584 0.5 0.5 0.5 0 0.5 0.5 0.5 1.16921 0.5 
+0.5 0.5 0.5 0 0 0 0.969584 0.5 0.5 0.5 
+0.5 0 0.795245 0 0.795245 0.5 0 0.5 0.5 0.5 
+0.5 0 1.07253 0.5 0.969584 0.969584 0.5 0.5 0.969584 0 
+0 0.5 0.5 0 0 0.5 0.5 0.969584 0.5 0.969584 
+0.5 0.5 0.5 0.5 0 0 0.5 0.5 1.13332 1.07253 
+0.5 1.13332 1.16921 0.5 0.5 0.5 0.5 0.5 0.5 0.5 
+0.5 0 0.5 0.5 0.5 0.5 0.5 1.16921 0 0.5 
+];
+ResA0000070 = [ ...
+0.795245 0.5 0.5 0.795245 1.07253 0.578723 0.5 0.5 0.5 0.5 
+0.795245 0 0 0.969584 1.14547 0.866 1.19041 0.820535 1.07253 0 
+0.795245 0 0 0.5 0.5 0.5 0.5 0.5 1.20292 0.795245 
+0.795245 0.795245 0.795245 0.5 0.5 0 0.133318 0.5 0.5 0 
+0.795245 0 0.5 0 1.07253 0.5 0 0.5 0.5 0.5 
+0 0 0.578723 0.5 0.542828 0 0.969584 0.5 0.5 0.5 
+0.5 0.5 0.5 0.5 0.5 0.5 0 1.13332 0.5 1.13332 
+0.5 0.795245 0.969584 0.795245 0.5 0.5 0.5 0.5 0.599919 0.5 
+0.5 1.19041 0.612434 0 0 0.5 0.5 0.5 0.5 0.5 
+0.5 0.5 0 0 0.795245 0.5 0.5 0.5 0.5 0.5 
+];
+ResA0000080 = [ ...
+0.5 0 0.5 1.07253 0.5 0.5 0 0.5 0.795245 0.5 
+1.07253 0.5 0.5 0.542828 1.19464 0.5 0.5 0 0.578723 0 
+0.0725298 0.5 0.5 0 0 0.5 0.5 0.5 1.21468 1.07253 
+1.07253 0.5 1.07253 0.5 0.5 0.5 0.84173 0.5 0 0.795245 
+0.5 0.5 0.795245 0 1.16921 0 0.5 0.795245 0 0 
+0 0.5 0.5 0.795245 0 0.5 1.13332 0 0 0 
+0.5 0.795245 0.795245 0.969584 0.5 0.5 0.5 0.190409 0 0 
+0.795245 1.07253 1.13332 1.07253 0 0.5 0.5 0.5 0.5 0.5 
+0.5 0.619825 1.00879 0 0.5 0.5 0.969584 0.969584 0.5 0.5 
+0 0.5 0.795245 0.795245 1.07253 0.795245 0.5 0.795245 0.5 0.5 
+];
+ResA0000090 = [ ...
+0.5 0 0 1.16921 0.969584 0.969584 0.5 0.5 0 0.5 
+1.16921 0.5 0.5 0.795245 0.211792 0 0 0.5 0.5 0 
+0.5 0.969584 0.5 0.795245 0.5 0.5 0.5 0.5 0.628287 0.578723 
+0.5 0.5 0.5 0.5 0.5 0.5 0 0.5 0.795245 0.0725298 
+0.5 0.5 0.5 0.5 0.5 0.5 0 0.0725298 0 0 
+0.5 0.795245 0.5 0.5 0 0.5 1.19041 0.5 0.795245 0 
+0.5 1.07253 0.5 1.13332 0.5 0.5 0.795245 0.5 0.795245 0.5 
+0.5 1.16921 1.19041 1.16921 0.5 0.5 0.5 0.969584 0.5 0.795245 
+0.5 0.5 1.14699 0.5 0.795245 0.5 0.5 1.13332 0.969584 0.5 
+0.5 0.5 1.07253 1.07253 1.16921 0.5 0.969584 0.5 0.5 0.5 
+];
+ResA0000100 = [ ...
+0 0.5 0 1.20292 0.5 0 0.5 0.795245 0.5 0.5 
+0.5 0.5 0.969584 0 0.5 0.5 0 0.969584 0.795245 0.795245 
+0.5 0.5 0.5 1.07253 0.795245 0.5 0 0.5 0.5 0.5 
+0 0 0.5 0.5 0.795245 0.795245 0.5 0 0.5 0.5 
+0.5 0.5 0.5 0.5 0.969584 0.969584 0 0.5 0.5 0.5 
+0.5 0.5 0.969584 0.5 0.5 0.795245 0.210315 0.969584 0.5 0.5 
+0.5 1.16921 0.5 1.19041 0.5 0.969584 0.5 0.5 1.07253 0.5 
+0.795245 1.20292 0.5 0.202924 0.795245 0.795245 0.795245 0.5 0.5 1.07253 
+0.5 0.5 1.19517 0.5 0 0.795245 0.5 1.19041 0 0.5 
+0 0.795245 0.820535 0.578723 1.20292 0.5 1.13332 0 0.5 0.5 
+];
@@ -0,0 +1,132 @@
+ResB0000000 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+2 2 2 2 2 2 2 2 2 2 
+2 2 2 2 2 2 2 2 2 2 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+ResB0000010 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+7.05932 7.46883 7.46883 6.87834 7.46883 7.46883 5.87834 7.46883 7.46883 7.46883 
+7.05932 6.46883 8.05932 7.05932 7.05932 7.46883 7.05932 8.05932 8.05932 7.46883 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+ResB0000020 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+8.47471 8.6175 8.26882 9.76029 9.6175 9.26882 9.06293 8.6175 8.6175 9.6175 
+9.47471 9.26882 9.2329 9.47471 8.88422 9.6175 9.47471 9.12603 9.2329 9.85931 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+ResB0000030 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+10.5587 9.01802 8.30595 10.1747 9.42753 9.65463 9.93152 9.01802 10.018 9.60851 
+9.66559 10.1843 9.2326 11.2561 9.11102 10.018 9.96823 9.60484 8.88392 11.0415 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+ResB0000040 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+11.0436 10.1577 8.97022 10.561 9.70997 10.3796 10.8249 8.91586 10.2645 9.77307 
+10.3835 10.2156 9.05151 10.3475 10.1901 10.1577 10.1403 9.36228 9.11091 10.6214 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+ResB0000050 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+10.2734 11.1455 8.79233 9.34699 10.6407 10.0419 10.1972 8.88024 10.0018 9.42094 
+9.04328 9.92394 10.7598 10.6212 9.56635 10.555 10.549 10.8682 9.84138 8.77757 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+ResB0000060 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+10.0049 10.8387 10.6695 10.2724 11.6626 10.8634 9.9175 9.86782 9.31972 10.2982 
+11.1056 9.47354 11.7042 10.368 11.288 11.0423 9.34281 10.8028 11.3839 10.4225 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+ResB0000070 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+10.7436 9.79249 10.143 9.65587 12.019 11.7403 9.4713 10.0445 9.67238 10.9527 
+11.8247 8.72601 11.443 10.6284 11.8883 10.2122 11.2101 9.77998 10.3921 9.70822 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+ResB0000080 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+11.3498 10.4277 11.1404 8.78958 12.1432 12.046 10.3157 9.92508 9.38583 9.83225 
+9.78764 10.0559 11.3519 11.6583 10.568 11.1645 10.922 9.66516 9.28811 9.39833 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+ResB0000090 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+11.3194 11.2397 11.2464 9.48753 10.8987 11.5622 11.5493 11.4131 8.93724 9.79026 
+9.83553 11.11 9.79045 10.1391 9.34944 10.5574 10.8215 10.0346 10.8423 9.29028 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];
+ResB0000100 = [ ...
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+10.6114 11.281 9.34416 11.2605 11.7526 11.9839 11.6308 11.932 9.53901 10.0783 
+10.094 11.2358 11.3662 8.95809 10.8637 10.6944 9.78652 11.4513 11.3843 9.2526 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+0 0 0 0 0 0 0 0 0 0 
+];